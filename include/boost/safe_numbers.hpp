@@ -19,6 +19,17 @@
 #include <boost/safe_numbers/integer_utilities.hpp>
 #include <boost/safe_numbers/byte_conversions.hpp>
 #include <boost/safe_numbers/numeric.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/span_reductions.hpp>
+#include <boost/safe_numbers/divider.hpp>
+#include <boost/safe_numbers/conversions.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+#include <boost/safe_numbers/arithmetic_error.hpp>
+#include <boost/safe_numbers/expected.hpp>
+#include <boost/safe_numbers/policy_integers.hpp>
+#include <boost/safe_numbers/runtime_policy.hpp>
+#include <boost/safe_numbers/telemetry.hpp>
+#include <boost/safe_numbers/operation_profile.hpp>
 
 #undef BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
 
@@ -0,0 +1,220 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The exceptions thrown on the host, which carry the operation and its operands
+// so that they can be inspected and logged without parsing the message or allocating
+
+#ifndef BOOST_SAFE_NUMBERS_ARITHMETIC_ERROR_HPP
+#define BOOST_SAFE_NUMBERS_ARITHMETIC_ERROR_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/int128/int128.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <boost/assert/source_location.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+namespace detail {
+
+// A string of at most Capacity - 1 characters stored inline, for building error messages without allocating.
+// Text that does not fit is truncated.
+template <std::size_t Capacity>
+class message_buffer
+{
+private:
+
+    char buffer_[Capacity] {};
+    std::size_t size_ {};
+
+public:
+
+    constexpr message_buffer() noexcept = default;
+
+    explicit constexpr message_buffer(const char* str) noexcept
+    {
+        append(str);
+    }
+
+    constexpr auto append(const char* str) noexcept -> message_buffer&
+    {
+        for (; *str != '\0' && size_ < Capacity - 1U; ++str)
+        {
+            buffer_[size_++] = *str;
+        }
+
+        return *this;
+    }
+
+    constexpr auto append(const char c) noexcept -> message_buffer&
+    {
+        if (size_ < Capacity - 1U)
+        {
+            buffer_[size_++] = c;
+        }
+
+        return *this;
+    }
+
+    constexpr auto append(int128::uint128_t value) noexcept -> message_buffer&
+    {
+        char digits[40] {};
+        std::size_t count {};
+
+        do
+        {
+            digits[count++] = static_cast<char>('0' + static_cast<int>(value % 10U));
+            value /= 10U;
+        } while (value != 0U);
+
+        while (count > 0U)
+        {
+            append(digits[--count]);
+        }
+
+        return *this;
+    }
+
+    constexpr auto append(const std::size_t value) noexcept -> message_buffer&
+    {
+        return append(static_cast<int128::uint128_t>(value));
+    }
+
+    // The bits of an operand as reported in overflow_info, which are sign extended when is_signed
+    constexpr auto append_operand(const int128::uint128_t bits, const bool is_signed) noexcept -> message_buffer&
+    {
+        if (is_signed && static_cast<int128::int128_t>(bits) < 0)
+        {
+            return append('-').append(static_cast<int128::uint128_t>(int128::uint128_t{0U} - bits));
+        }
+
+        return append(bits);
+    }
+
+    [[nodiscard]] constexpr auto c_str() const noexcept -> const char* { return buffer_; }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return size_; }
+};
+
+inline constexpr std::size_t arithmetic_error_message_capacity {128U};
+
+// The message followed by both operands, each of which is at most 40 characters
+inline constexpr std::size_t arithmetic_error_what_capacity {arithmetic_error_message_capacity + 64U};
+
+} // namespace detail
+
+// Base of every exception that the library throws on the host for an error,
+// whatever the standard exception type it also derives from (std::overflow_error, std::domain_error, ...).
+// Like boost::exception it does not itself derive from std::exception, so that it can be caught in addition to the standard type.
+BOOST_SAFE_NUMBERS_EXPORT class arithmetic_error
+{
+private:
+
+    detail::message_buffer<detail::arithmetic_error_message_capacity> message_;
+    detail::message_buffer<detail::arithmetic_error_what_capacity> what_;
+
+    arithmetic_op op_;
+    const char* type_;
+    bool is_signed_;
+    int128::uint128_t lhs_;
+    int128::uint128_t rhs_;
+    boost::source_location location_;
+
+protected:
+
+    // The message is copied, since the message of errors that are not from a single operation may be a temporary.
+    // The operands are formatted here rather than in what(), so that what() only reads and may be called from any thread.
+    explicit arithmetic_error(const overflow_info& info) noexcept
+        : message_ {info.message}, what_ {info.message}, op_ {info.op}, type_ {info.type}, is_signed_ {info.is_signed},
+          lhs_ {info.lhs}, rhs_ {info.rhs}, location_ {info.location}
+    {
+        switch (op_)
+        {
+            case arithmetic_op::none:
+                return;
+            case arithmetic_op::inc:
+            case arithmetic_op::dec:
+            case arithmetic_op::neg:
+            case arithmetic_op::conversion:
+                what_.append(" (operand = ").append_operand(lhs_, is_signed_);
+                break;
+            default:
+                what_.append(" (lhs = ").append_operand(lhs_, is_signed_)
+                     .append(", rhs = ").append_operand(rhs_, is_signed_);
+                break;
+        }
+
+        what_.append(')');
+    }
+
+    arithmetic_error(const arithmetic_error&) noexcept = default;
+    auto operator=(const arithmetic_error&) noexcept -> arithmetic_error& = default;
+
+    // Virtual so that a caught arithmetic_error can be cast to the standard exception type, as with boost::exception
+    virtual ~arithmetic_error() = default;
+
+    // The message followed by the operands
+    [[nodiscard]] auto formatted_what() const noexcept -> const char* { return what_.c_str(); }
+
+public:
+
+    [[nodiscard]] auto op() const noexcept -> arithmetic_op { return op_; }
+
+    // The operand type, e.g. "u32", or nullptr when op() is arithmetic_op::none
+    [[nodiscard]] auto type_name() const noexcept -> const char* { return type_; }
+
+    [[nodiscard]] auto is_signed() const noexcept -> bool { return is_signed_; }
+
+    // The bits of the operands, sign extended when is_signed(), and zero for the missing operand of unary operations
+    [[nodiscard]] auto lhs() const noexcept -> int128::uint128_t { return lhs_; }
+
+    [[nodiscard]] auto rhs() const noexcept -> int128::uint128_t { return rhs_; }
+
+    // The message without the operands, e.g. "Overflow detected in u32 addition"
+    [[nodiscard]] auto message() const noexcept -> const char* { return message_.c_str(); }
+
+    [[nodiscard]] auto location() const noexcept -> const boost::source_location& { return location_; }
+
+    // The same description that was passed to the overflow handlers, whose message is valid for the lifetime of the exception
+    [[nodiscard]] auto info() const noexcept -> overflow_info
+    {
+        return overflow_info{op_, type_, is_signed_, lhs_, rhs_, message_.c_str(), location_};
+    }
+};
+
+// The exception thrown in place of StdException, which is still caught by handlers of StdException.
+// StdException is constructed from an empty message, since what() is overridden.
+BOOST_SAFE_NUMBERS_EXPORT template <typename StdException>
+class basic_arithmetic_error : public StdException, public arithmetic_error
+{
+    static_assert(std::is_base_of_v<std::exception, StdException> && std::is_constructible_v<StdException, const char*>,
+                  "StdException must be a standard exception type constructible from a message");
+
+public:
+
+    explicit basic_arithmetic_error(const overflow_info& info) noexcept
+        : StdException {""}, arithmetic_error {info} {}
+
+    [[nodiscard]] auto what() const noexcept -> const char* override
+    {
+        return formatted_what();
+    }
+};
+
+BOOST_SAFE_NUMBERS_EXPORT using arithmetic_overflow_error = basic_arithmetic_error<std::overflow_error>;
+
+BOOST_SAFE_NUMBERS_EXPORT using arithmetic_underflow_error = basic_arithmetic_error<std::underflow_error>;
+
+BOOST_SAFE_NUMBERS_EXPORT using arithmetic_domain_error = basic_arithmetic_error<std::domain_error>;
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_ARITHMETIC_ERROR_HPP
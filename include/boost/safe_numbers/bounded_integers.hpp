@@ -10,8 +10,10 @@
 #include <boost/safe_numbers/detail/throw_exception.hpp>
 #include <boost/safe_numbers/detail/int128/string.hpp>
 #include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/expected.hpp>
 #include <boost/safe_numbers/unsigned_integers.hpp>
 #include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
 
 #ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
 
@@ -20,32 +22,115 @@
 #include <compare>
 #include <limits>
 #include <stdexcept>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <utility>
 #include <optional>
-#include <string>
+#include <span>
 
 #endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
 
 namespace boost::safe_numbers {
 
+// Tag for constructing a bounded type from a value that has already been validated,
+// which skips the range check. Passing an out of range value is undefined behavior.
+BOOST_SAFE_NUMBERS_EXPORT struct unchecked_t
+{
+    explicit unchecked_t() = default;
+};
+
+BOOST_SAFE_NUMBERS_EXPORT inline constexpr unchecked_t unchecked {};
+
 namespace detail {
 
-template <fundamental_unsigned_integral T>
-auto to_string_val(T val) -> std::string
+// from_span validates this many elements at a time, and then copies them.
+// A value is in [min, max] exactly when (value - min) <= (max - min) in the unsigned lane type,
+// so each block is checked with one unsigned compare per element OR-reduced into a lane mask, which vectorizes.
+// Only a block that contains an out of range value is inspected element by element, to find its index.
+inline constexpr std::size_t bounded_from_span_block_size {256U};
+
+template <typename Bounded, typename UnderlyingType>
+constexpr auto bounded_from_span(const std::span<const UnderlyingType> source,
+                                 const std::span<Bounded> destination,
+                                 const UnderlyingType min_raw,
+                                 const UnderlyingType max_raw,
+                                 const char* const size_msg,
+                                 const char* const range_msg) -> void
 {
-    using std::to_string;
-    using boost::int128::to_string;
-    return to_string(val);
+    using lane = impl::span_lane_t<UnderlyingType>;
+
+    if (source.size() != destination.size())
+    {
+        if (std::is_constant_evaluated())
+        {
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, size_msg);
+        }
+        else
+        {
+            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, size_msg);
+        }
+    }
+
+    const auto min_lane {static_cast<lane>(min_raw)};
+    const auto range {static_cast<lane>(static_cast<lane>(max_raw) - min_lane)};
+
+    for (std::size_t first {}; first < source.size(); first += bounded_from_span_block_size)
+    {
+        const auto remaining {source.size() - first};
+        const auto block {source.subspan(first, remaining < bounded_from_span_block_size ? remaining : bounded_from_span_block_size)};
+
+        lane out_of_range {};
+        for (const auto value : block)
+        {
+            const auto offset {static_cast<lane>(static_cast<lane>(value) - min_lane)};
+            out_of_range |= static_cast<lane>(lane{0} - static_cast<lane>(offset > range));
+        }
+
+        if (out_of_range != 0U)
+        {
+            for (std::size_t i {}; i < block.size(); ++i)
+            {
+                if (block[i] < min_raw || block[i] > max_raw)
+                {
+                    if (std::is_constant_evaluated())
+                    {
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, range_msg);
+                    }
+                    else
+                    {
+                        message_buffer<arithmetic_error_message_capacity> msg {range_msg};
+                        msg.append(" at index ").append(first + i);
+                        BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, msg, conversion, block[i], UnderlyingType{0});
+                    }
+                }
+            }
+        }
+
+        for (std::size_t i {}; i < block.size(); ++i)
+        {
+            destination[first + i] = Bounded{unchecked, block[i]};
+        }
+    }
 }
 
-template <fundamental_signed_integral T>
-auto to_string_val(T val) -> std::string
+// Converts the result of an expected operation on the basis type of a bounded type,
+// failing with arithmetic_errc::out_of_range when the result is outside [min, max]
+template <typename Bounded, typename Basis>
+constexpr auto bounded_expected(const arithmetic_expected<Basis>& res, const Basis min, const Basis max) noexcept
+    -> arithmetic_expected<Bounded>
 {
-    using std::to_string;
-    using boost::int128::to_string;
-    return to_string(val);
+    if (!res.has_value()) [[unlikely]]
+    {
+        return make_arithmetic_error<Bounded>(res.error());
+    }
+
+    if (*res < min || *res > max) [[unlikely]]
+    {
+        return make_arithmetic_error<Bounded>(arithmetic_errc::out_of_range);
+    }
+
+    return Bounded{unchecked, *res};
 }
 
 } // namespace detail
@@ -81,11 +166,12 @@ public:
         {
             if (std::is_constant_evaluated())
             {
-                throw std::domain_error("bounded_uint value out of range");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint value out of range");
             }
             else
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint value out of range");
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_uint value out of range", conversion,
+                                                         static_cast<underlying_type>(val), underlying_type{0});
             }
         }
 
@@ -94,6 +180,23 @@ public:
 
     explicit constexpr bounded_uint(const underlying_type val) : bounded_uint{basis_type{val}} {}
 
+    constexpr bounded_uint(unchecked_t, const basis_type val) noexcept : basis_ {val} {}
+
+    constexpr bounded_uint(unchecked_t, const underlying_type val) noexcept : basis_ {val} {}
+
+    // Constructs destination[i] from source[i] for every index i, validating blocks of elements at a time.
+    // Throws std::domain_error naming the first out of range index, in which case
+    // the elements of destination before the block containing that index have been written.
+    static constexpr auto from_span(const std::span<const underlying_type> source, const std::span<bounded_uint> destination) -> void
+    {
+        constexpr auto min_raw {static_cast<underlying_type>(detail::raw_value(Min))};
+        constexpr auto max_raw {static_cast<underlying_type>(detail::raw_value(Max))};
+
+        detail::bounded_from_span(source, destination, min_raw, max_raw,
+                                  "bounded_uint from_span requires source and destination to have the same size",
+                                  "bounded_uint value out of range");
+    }
+
     template <typename OtherBasis>
         requires (detail::is_unsigned_library_type_v<OtherBasis> || detail::is_fundamental_unsigned_integral_v<OtherBasis>)
     [[nodiscard]] explicit constexpr operator OtherBasis() const
@@ -107,11 +210,11 @@ public:
             {
                 if (std::is_constant_evaluated())
                 {
-                    throw std::domain_error("bounded_uint conversion overflow");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint conversion overflow");
                 }
                 else
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint conversion overflow");
+                    BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint conversion overflow", conversion, raw, underlying_type{0});
                 }
             }
 
@@ -167,16 +270,26 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_uint<Min, Max>{unchecked, static_cast<underlying>(lhs_raw + rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     if (detail::impl::unsigned_no_intrin_add(lhs_raw, rhs_raw, res))
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_uint addition overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_uint addition overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_uint addition overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_uint addition overflow", add, lhs_raw, rhs_raw);
         }
     }
 
@@ -184,11 +297,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint addition result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint addition result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint addition result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint addition result out of range", add, lhs_raw, rhs_raw);
         }
     }
 
@@ -206,16 +319,26 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_uint<Min, Max>{unchecked, static_cast<underlying>(lhs_raw - rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     if (detail::impl::unsigned_no_intrin_sub(lhs_raw, rhs_raw, res))
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_uint subtraction underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_uint subtraction underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_uint subtraction underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_uint subtraction underflow", sub, lhs_raw, rhs_raw);
         }
     }
 
@@ -223,11 +346,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint subtraction result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint subtraction result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint subtraction result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint subtraction result out of range", sub, lhs_raw, rhs_raw);
         }
     }
 
@@ -245,16 +368,26 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_uint<Min, Max>{unchecked, static_cast<underlying>(lhs_raw * rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     if (detail::impl::no_intrin_mul(lhs_raw, rhs_raw, res))
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_uint multiplication overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_uint multiplication overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_uint multiplication overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_uint multiplication overflow", mul, lhs_raw, rhs_raw);
         }
     }
 
@@ -262,11 +395,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint multiplication result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint multiplication result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint multiplication result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint multiplication result out of range", mul, lhs_raw, rhs_raw);
         }
     }
 
@@ -288,11 +421,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint division by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint division by zero");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint division by zero");
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_uint division by zero", div, lhs_raw, rhs_raw);
         }
     }
 
@@ -310,11 +443,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint division result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint division result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint division result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint division result out of range", div, lhs_raw, rhs_raw);
         }
     }
 
@@ -336,11 +469,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint modulo by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint modulo by zero");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint modulo by zero");
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_uint modulo by zero", mod, lhs_raw, rhs_raw);
         }
     }
 
@@ -358,11 +491,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint modulo result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint modulo result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint modulo result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint modulo result out of range", mod, lhs_raw, rhs_raw);
         }
     }
 
@@ -425,11 +558,11 @@ constexpr auto bounded_uint<Min, Max>::operator++() -> bounded_uint&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_uint increment overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_uint increment overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_uint increment overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_uint increment overflow", inc, raw, underlying{0});
         }
     }
 
@@ -437,11 +570,11 @@ constexpr auto bounded_uint<Min, Max>::operator++() -> bounded_uint&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint increment result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint increment result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint increment result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint increment result out of range", inc, raw, underlying{0});
         }
     }
 
@@ -476,11 +609,11 @@ constexpr auto bounded_uint<Min, Max>::operator--() -> bounded_uint&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_uint decrement underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_uint decrement underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_uint decrement underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_uint decrement underflow", dec, raw, underlying{0});
         }
     }
 
@@ -488,11 +621,11 @@ constexpr auto bounded_uint<Min, Max>::operator--() -> bounded_uint&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_uint decrement result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_uint decrement result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_uint decrement result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_uint decrement result out of range", dec, raw, underlying{0});
         }
     }
 
@@ -558,11 +691,12 @@ public:
         {
             if (std::is_constant_evaluated())
             {
-                throw std::domain_error("bounded_int value out of range");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int value out of range");
             }
             else
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int value out of range");
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_int value out of range", conversion,
+                                                         static_cast<underlying_type>(val), underlying_type{0});
             }
         }
 
@@ -571,6 +705,23 @@ public:
 
     explicit constexpr bounded_int(const underlying_type val) : bounded_int{basis_type{val}} {}
 
+    constexpr bounded_int(unchecked_t, const basis_type val) noexcept : basis_ {val} {}
+
+    constexpr bounded_int(unchecked_t, const underlying_type val) noexcept : basis_ {val} {}
+
+    // Constructs destination[i] from source[i] for every index i, validating blocks of elements at a time.
+    // Throws std::domain_error naming the first out of range index, in which case
+    // the elements of destination before the block containing that index have been written.
+    static constexpr auto from_span(const std::span<const underlying_type> source, const std::span<bounded_int> destination) -> void
+    {
+        constexpr auto min_raw {static_cast<underlying_type>(detail::signed_raw_value(Min))};
+        constexpr auto max_raw {static_cast<underlying_type>(detail::signed_raw_value(Max))};
+
+        detail::bounded_from_span(source, destination, min_raw, max_raw,
+                                  "bounded_int from_span requires source and destination to have the same size",
+                                  "bounded_int value out of range");
+    }
+
     template <typename OtherBasis>
         requires (detail::is_signed_library_type_v<OtherBasis> || detail::is_fundamental_signed_integral_v<OtherBasis>)
     [[nodiscard]] explicit constexpr operator OtherBasis() const
@@ -585,11 +736,11 @@ public:
             {
                 if (std::is_constant_evaluated())
                 {
-                    throw std::domain_error("bounded_int conversion overflow");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int conversion overflow");
                 }
                 else
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int conversion overflow");
+                    BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int conversion overflow", conversion, raw, underlying_type{0});
                 }
             }
 
@@ -655,11 +806,11 @@ constexpr auto bounded_int<Min, Max>::operator-() const -> bounded_int
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int negation overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int negation overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int negation overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int negation overflow", neg, raw, underlying{0});
         }
     }
 
@@ -682,28 +833,38 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_int<Min, Max>{unchecked, static_cast<underlying>(lhs_raw + rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     const auto status {detail::impl::signed_no_intrin_add(lhs_raw, rhs_raw, res)};
     if (status == detail::impl::signed_overflow_status::overflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int addition overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int addition overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int addition overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int addition overflow", add, lhs_raw, rhs_raw);
         }
     }
     else if (status == detail::impl::signed_overflow_status::underflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_int addition underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_int addition underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_int addition underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_int addition underflow", add, lhs_raw, rhs_raw);
         }
     }
 
@@ -711,11 +872,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int addition result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int addition result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int addition result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int addition result out of range", add, lhs_raw, rhs_raw);
         }
     }
 
@@ -737,28 +898,38 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_int<Min, Max>{unchecked, static_cast<underlying>(lhs_raw - rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     const auto status {detail::impl::signed_no_intrin_sub(lhs_raw, rhs_raw, res)};
     if (status == detail::impl::signed_overflow_status::overflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int subtraction overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int subtraction overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int subtraction overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int subtraction overflow", sub, lhs_raw, rhs_raw);
         }
     }
     else if (status == detail::impl::signed_overflow_status::underflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_int subtraction underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_int subtraction underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_int subtraction underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_int subtraction underflow", sub, lhs_raw, rhs_raw);
         }
     }
 
@@ -766,11 +937,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int subtraction result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int subtraction result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int subtraction result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int subtraction result out of range", sub, lhs_raw, rhs_raw);
         }
     }
 
@@ -792,28 +963,38 @@ template <auto Min, auto Max>
     const auto lhs_raw {static_cast<underlying>(static_cast<basis>(lhs))};
     const auto rhs_raw {static_cast<underlying>(static_cast<basis>(rhs))};
 
+    #ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+    // The result is assumed to be in range, so the checks below are skipped at runtime rather than reduced to branches to unreachable code
+    if (!std::is_constant_evaluated())
+    {
+        return bounded_int<Min, Max>{unchecked, static_cast<underlying>(lhs_raw * rhs_raw)};
+    }
+
+    #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
     underlying res {};
     const auto status {detail::impl::signed_no_intrin_mul(lhs_raw, rhs_raw, res)};
     if (status == detail::impl::signed_overflow_status::overflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int multiplication overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int multiplication overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int multiplication overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int multiplication overflow", mul, lhs_raw, rhs_raw);
         }
     }
     else if (status == detail::impl::signed_overflow_status::underflow)
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_int multiplication underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_int multiplication underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_int multiplication underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_int multiplication underflow", mul, lhs_raw, rhs_raw);
         }
     }
 
@@ -821,11 +1002,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int multiplication result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int multiplication result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int multiplication result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int multiplication result out of range", mul, lhs_raw, rhs_raw);
         }
     }
 
@@ -851,11 +1032,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int division by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int division by zero");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int division by zero");
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_int division by zero", div, lhs_raw, rhs_raw);
         }
     }
 
@@ -864,11 +1045,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int division overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int division overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int division overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int division overflow", div, lhs_raw, rhs_raw);
         }
     }
 
@@ -892,11 +1073,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int division result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int division result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int division result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int division result out of range", div, lhs_raw, rhs_raw);
         }
     }
 
@@ -922,11 +1103,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int modulo by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int modulo by zero");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int modulo by zero");
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, "bounded_int modulo by zero", mod, lhs_raw, rhs_raw);
         }
     }
 
@@ -935,11 +1116,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int modulo overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int modulo overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int modulo overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int modulo overflow", mod, lhs_raw, rhs_raw);
         }
     }
 
@@ -963,11 +1144,11 @@ template <auto Min, auto Max>
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int modulo result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int modulo result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int modulo result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int modulo result out of range", mod, lhs_raw, rhs_raw);
         }
     }
 
@@ -1038,11 +1219,11 @@ constexpr auto bounded_int<Min, Max>::operator++() -> bounded_int&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::overflow_error("bounded_int increment overflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "bounded_int increment overflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, "bounded_int increment overflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::overflow_error, "bounded_int increment overflow", inc, raw, underlying{0});
         }
     }
 
@@ -1050,11 +1231,11 @@ constexpr auto bounded_int<Min, Max>::operator++() -> bounded_int&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int increment result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int increment result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int increment result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int increment result out of range", inc, raw, underlying{0});
         }
     }
 
@@ -1089,11 +1270,11 @@ constexpr auto bounded_int<Min, Max>::operator--() -> bounded_int&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::underflow_error("bounded_int decrement underflow");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "bounded_int decrement underflow");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, "bounded_int decrement underflow");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::underflow_error, "bounded_int decrement underflow", dec, raw, underlying{0});
         }
     }
 
@@ -1101,11 +1282,11 @@ constexpr auto bounded_int<Min, Max>::operator--() -> bounded_int&
     {
         if (std::is_constant_evaluated())
         {
-            throw std::domain_error("bounded_int decrement result out of range");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "bounded_int decrement result out of range");
         }
         else
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "bounded_int decrement result out of range");
+            BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(std::domain_error, "bounded_int decrement result out of range", dec, raw, underlying{0});
         }
     }
 
@@ -1124,6 +1305,72 @@ constexpr auto bounded_int<Min, Max>::operator--(int) -> bounded_int
     return tmp;
 }
 
+// ============================================================
+// Expected and generic policy-parameterized functions
+// ============================================================
+
+// The expected functions fail as those of the basis type do,
+// and with arithmetic_errc::out_of_range when the result is outside the bounds
+
+#define BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(BOUNDED_TYPE, RAW_VALUE, OP_NAME)                                                   \
+template <auto Min, auto Max>                                                                                                           \
+[[nodiscard]] constexpr auto OP_NAME(const BOUNDED_TYPE<Min, Max> lhs, const BOUNDED_TYPE<Min, Max> rhs) noexcept                      \
+    -> arithmetic_expected<BOUNDED_TYPE<Min, Max>>                                                                                      \
+{                                                                                                                                       \
+    using basis = typename BOUNDED_TYPE<Min, Max>::basis_type;                                                                          \
+    using underlying = detail::underlying_type_t<basis>;                                                                                \
+    constexpr basis min_val {static_cast<underlying>(detail::RAW_VALUE(Min))};                                                         \
+    constexpr basis max_val {static_cast<underlying>(detail::RAW_VALUE(Max))};                                                         \
+    return detail::bounded_expected<BOUNDED_TYPE<Min, Max>>(OP_NAME(static_cast<basis>(lhs), static_cast<basis>(rhs)), min_val, max_val); \
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_uint, raw_value, expected_add)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_uint, raw_value, expected_sub)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_uint, raw_value, expected_mul)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_uint, raw_value, expected_div)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_uint, raw_value, expected_mod)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_int, signed_raw_value, expected_add)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_int, signed_raw_value, expected_sub)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_int, signed_raw_value, expected_mul)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_int, signed_raw_value, expected_div)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP(bounded_int, signed_raw_value, expected_mod)
+
+#undef BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_EXPECTED_OP
+
+// Bounded types support the throw_exception policy, which is the operators, and the expected policy
+
+#define BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(BOUNDED_TYPE, OP_NAME, OP_SYMBOL)                                                    \
+template <overflow_policy Policy, auto Min, auto Max>                                                                                   \
+[[nodiscard]] constexpr auto OP_NAME(const BOUNDED_TYPE<Min, Max> lhs, const BOUNDED_TYPE<Min, Max> rhs)                               \
+    noexcept(Policy == overflow_policy::expected)                                                                                       \
+{                                                                                                                                       \
+    if constexpr (Policy == overflow_policy::throw_exception)                                                                           \
+    {                                                                                                                                   \
+        return lhs OP_SYMBOL rhs;                                                                                                       \
+    }                                                                                                                                   \
+    else if constexpr (Policy == overflow_policy::expected)                                                                             \
+    {                                                                                                                                   \
+        return expected_##OP_NAME(lhs, rhs);                                                                                            \
+    }                                                                                                                                   \
+    else                                                                                                                                \
+    {                                                                                                                                   \
+        static_assert(detail::dependent_false<BOUNDED_TYPE<Min, Max>>, "Policy is not supported for bounded types");                    \
+    }                                                                                                                                   \
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_uint, add, +)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_uint, sub, -)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_uint, mul, *)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_uint, div, /)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_uint, mod, %)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_int, add, +)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_int, sub, -)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_int, mul, *)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_int, div, /)
+BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP(bounded_int, mod, %)
+
+#undef BOOST_SAFE_NUMBERS_DEFINE_BOUNDED_POLICY_OP
+
 } // namespace boost::safe_numbers
 
 // Mixed-bounds blocking for bounded_int
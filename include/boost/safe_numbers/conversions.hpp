@@ -0,0 +1,448 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_CONVERSIONS_HPP
+#define BOOST_SAFE_NUMBERS_CONVERSIONS_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail::impl {
+
+// Whether a value of FromBasis can exceed the max, or fall below the min, of ToBasis.
+// When it can, the bound of ToBasis is representable in FromBasis, so the range checks compare in FromBasis.
+template <typename ToBasis, typename FromBasis>
+inline constexpr bool conversion_can_overflow_v {std::numeric_limits<ToBasis>::digits < std::numeric_limits<FromBasis>::digits};
+
+template <typename ToBasis, typename FromBasis>
+inline constexpr bool conversion_can_underflow_v {is_fundamental_signed_integral_v<FromBasis> &&
+                                                  (is_fundamental_unsigned_integral_v<ToBasis> || conversion_can_overflow_v<ToBasis, FromBasis>)};
+
+template <typename ToBasis, typename FromBasis>
+[[nodiscard]] constexpr auto conversion_overflows(const FromBasis value) noexcept -> bool
+{
+    if constexpr (conversion_can_overflow_v<ToBasis, FromBasis>)
+    {
+        return value > static_cast<FromBasis>(std::numeric_limits<ToBasis>::max());
+    }
+    else
+    {
+        static_cast<void>(value);
+        return false;
+    }
+}
+
+template <typename ToBasis, typename FromBasis>
+[[nodiscard]] constexpr auto conversion_underflows(const FromBasis value) noexcept -> bool
+{
+    if constexpr (!conversion_can_underflow_v<ToBasis, FromBasis>)
+    {
+        static_cast<void>(value);
+        return false;
+    }
+    else if constexpr (is_fundamental_unsigned_integral_v<ToBasis>)
+    {
+        return value < FromBasis{0};
+    }
+    else
+    {
+        return value < static_cast<FromBasis>(std::numeric_limits<ToBasis>::min());
+    }
+}
+
+// Non-zero if value is out of range of ToBasis, and zero otherwise.
+// Uses a shift of the bits that do not fit in ToBasis instead of the comparisons above,
+// since not all targets have vector compares of 64-bit lanes (e.g. x86 before SSE4.2),
+// and the result can be OR-reduced directly in the lane type.
+template <typename ToBasis, typename FromBasis>
+[[nodiscard]] constexpr auto conversion_range_mismatch(const FromBasis value) noexcept -> span_lane_t<FromBasis>
+{
+    using from_lane = span_lane_t<FromBasis>;
+
+    constexpr auto to_digits {std::numeric_limits<ToBasis>::digits};
+    constexpr auto from_digits {std::numeric_limits<FromBasis>::digits};
+
+    if constexpr (conversion_can_overflow_v<ToBasis, FromBasis>)
+    {
+        // The bits above those of ToBasis must be all zeros, or for signed values the sign extension
+        const auto high {static_cast<from_lane>(value >> to_digits)};
+
+        if constexpr (is_fundamental_signed_integral_v<FromBasis> && is_fundamental_signed_integral_v<ToBasis>)
+        {
+            return static_cast<from_lane>(high ^ static_cast<from_lane>(value >> from_digits));
+        }
+        else
+        {
+            return high;
+        }
+    }
+    else if constexpr (conversion_can_underflow_v<ToBasis, FromBasis>)
+    {
+        // All ones if the value is negative
+        return static_cast<from_lane>(value >> from_digits);
+    }
+    else
+    {
+        static_cast<void>(value);
+        return from_lane{0};
+    }
+}
+
+// The value modulo 2^N for an N-bit ToBasis, which for wider types is the value itself
+template <typename ToBasis, typename FromBasis>
+[[nodiscard]] constexpr auto wrapping_conversion(const FromBasis value) noexcept -> ToBasis
+{
+    return static_cast<ToBasis>(value);
+}
+
+template <typename ToBasis, typename FromBasis>
+[[nodiscard]] constexpr auto saturating_conversion(const FromBasis value) noexcept -> ToBasis
+{
+    const auto wrapped {wrapping_conversion<ToBasis>(value)};
+    const auto clamped_low {conversion_underflows<ToBasis>(value) ? std::numeric_limits<ToBasis>::min() : wrapped};
+    return conversion_overflows<ToBasis>(value) ? std::numeric_limits<ToBasis>::max() : clamped_low;
+}
+
+// Saturating narrowing of signed 16 and 32-bit elements has dedicated pack instructions
+// (packsswb, packuswb, and packssdw with SSE2, and vqmovn and vqmovun with NEON),
+// which the compiler does not select from the comparisons above.
+// These process as many full vectors as fit, and return the number of elements processed.
+
+#if defined(BOOST_SAFE_NUMBERS_HAS_SSE2_INTRIN)
+
+// 32-bit elements narrowed to 8 bits are packed twice, first to 16 bits with signed saturation
+template <typename ToBasis, typename FromBasis>
+inline constexpr bool has_saturating_pack_v {(std::is_same_v<FromBasis, std::int16_t> || std::is_same_v<FromBasis, std::int32_t>) &&
+                                             (std::is_same_v<ToBasis, std::int8_t> || std::is_same_v<ToBasis, std::uint8_t> ||
+                                              std::is_same_v<ToBasis, std::int16_t>) && sizeof(ToBasis) < sizeof(FromBasis)};
+
+// GCC diagnoses the unaligned vector loads as out of bounds when inlined into a call
+// whose span is shorter than one vector, even though the loop body is then never executed
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+template <typename To, typename From>
+auto span_saturating_pack_kernel(const std::span<const From> source, const std::span<To> destination) noexcept -> std::size_t
+{
+    using to_basis = underlying_type_t<To>;
+    using from_basis = underlying_type_t<From>;
+    static_assert(sizeof(To) == sizeof(to_basis) && sizeof(From) == sizeof(from_basis), "Library types must have the same layout as their basis type");
+
+    // One output vector per iteration, from two or four input vectors
+    constexpr std::size_t lanes {sizeof(__m128i) / sizeof(To)};
+    constexpr std::size_t from_lanes {sizeof(__m128i) / sizeof(From)};
+
+    const std::size_t vector_end {source.size() - source.size() % lanes};
+
+    std::size_t i {};
+    for (; i < vector_end; i += lanes)
+    {
+        const auto load {[&](const std::size_t vector) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i + vector * from_lanes));
+        }};
+
+        __m128i packed;
+        if constexpr (std::is_same_v<from_basis, std::int32_t> && std::is_same_v<to_basis, std::int16_t>)
+        {
+            packed = _mm_packs_epi32(load(0U), load(1U));
+        }
+        else
+        {
+            __m128i low;
+            __m128i high;
+
+            if constexpr (std::is_same_v<from_basis, std::int32_t>)
+            {
+                low = _mm_packs_epi32(load(0U), load(1U));
+                high = _mm_packs_epi32(load(2U), load(3U));
+            }
+            else
+            {
+                low = load(0U);
+                high = load(1U);
+            }
+
+            packed = std::is_same_v<to_basis, std::uint8_t> ? _mm_packus_epi16(low, high) : _mm_packs_epi16(low, high);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), packed);
+    }
+
+    return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+#elif defined(BOOST_SAFE_NUMBERS_HAS_NEON_INTRIN)
+
+template <typename ToBasis, typename FromBasis>
+inline constexpr bool has_saturating_pack_v {(std::is_same_v<FromBasis, std::int16_t> && (std::is_same_v<ToBasis, std::int8_t> || std::is_same_v<ToBasis, std::uint8_t>)) ||
+                                             (std::is_same_v<FromBasis, std::int32_t> && (std::is_same_v<ToBasis, std::int16_t> || std::is_same_v<ToBasis, std::uint16_t>)) ||
+                                             (std::is_same_v<FromBasis, std::uint16_t> && std::is_same_v<ToBasis, std::uint8_t>) ||
+                                             (std::is_same_v<FromBasis, std::uint32_t> && std::is_same_v<ToBasis, std::uint16_t>)};
+
+template <typename To, typename From>
+auto span_saturating_pack_kernel(const std::span<const From> source, const std::span<To> destination) noexcept -> std::size_t
+{
+    using to_basis = underlying_type_t<To>;
+    using from_basis = underlying_type_t<From>;
+    static_assert(sizeof(To) == sizeof(to_basis) && sizeof(From) == sizeof(from_basis), "Library types must have the same layout as their basis type");
+
+    // One full input vector narrowed to one half width output vector per iteration
+    constexpr std::size_t lanes {16U / sizeof(From)};
+
+    const auto source_ptr {reinterpret_cast<const from_basis*>(source.data())};
+    const auto destination_ptr {reinterpret_cast<to_basis*>(destination.data())};
+
+    const std::size_t vector_end {source.size() - source.size() % lanes};
+
+    std::size_t i {};
+    for (; i < vector_end; i += lanes)
+    {
+        if constexpr (std::is_same_v<from_basis, std::int16_t> && std::is_same_v<to_basis, std::int8_t>)
+        {
+            vst1_s8(destination_ptr + i, vqmovn_s16(vld1q_s16(source_ptr + i)));
+        }
+        else if constexpr (std::is_same_v<from_basis, std::int16_t>)
+        {
+            vst1_u8(destination_ptr + i, vqmovun_s16(vld1q_s16(source_ptr + i)));
+        }
+        else if constexpr (std::is_same_v<from_basis, std::int32_t> && std::is_same_v<to_basis, std::int16_t>)
+        {
+            vst1_s16(destination_ptr + i, vqmovn_s32(vld1q_s32(source_ptr + i)));
+        }
+        else if constexpr (std::is_same_v<from_basis, std::int32_t>)
+        {
+            vst1_u16(destination_ptr + i, vqmovun_s32(vld1q_s32(source_ptr + i)));
+        }
+        else if constexpr (std::is_same_v<from_basis, std::uint16_t>)
+        {
+            vst1_u8(destination_ptr + i, vqmovn_u16(vld1q_u16(source_ptr + i)));
+        }
+        else
+        {
+            static_assert(std::is_same_v<from_basis, std::uint32_t>, "No saturating pack instruction for this conversion");
+            vst1_u16(destination_ptr + i, vqmovn_u32(vld1q_u32(source_ptr + i)));
+        }
+    }
+
+    return i;
+}
+
+#else
+
+template <typename ToBasis, typename FromBasis>
+inline constexpr bool has_saturating_pack_v {false};
+
+template <typename To, typename From>
+auto span_saturating_pack_kernel(const std::span<const From>, const std::span<To>) noexcept -> std::size_t
+{
+    return 0U;
+}
+
+#endif
+
+template <typename To, typename From>
+constexpr auto span_conversion_size_check(const std::span<const From> source, const std::span<To> destination) -> void
+{
+    if (source.size() != destination.size())
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Span conversion requires source and destination to have the same size");
+    }
+}
+
+// Converts every element without any branch in the loop body, in the same way as span_kernel,
+// which lets the compiler use vector range compares and narrowing packs.
+// Returns true if any element was out of range, which is not meaningful when saturating.
+template <bool Saturate, typename To, typename From>
+[[nodiscard]] constexpr auto span_conversion_kernel(const std::span<const From> source, const std::span<To> destination) noexcept -> bool
+{
+    using to_basis = underlying_type_t<To>;
+    using from_basis = underlying_type_t<From>;
+
+    using from_lane = span_lane_t<from_basis>;
+
+    from_lane out_of_range_reduction {};
+    std::size_t first {};
+
+    if constexpr (Saturate && has_saturating_pack_v<to_basis, from_basis>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            first = span_saturating_pack_kernel(source, destination);
+        }
+    }
+
+    for (std::size_t i {first}; i < source.size(); ++i)
+    {
+        const auto value {static_cast<from_basis>(source[i])};
+
+        if constexpr (Saturate)
+        {
+            destination[i] = To{saturating_conversion<to_basis>(value)};
+        }
+        else
+        {
+            out_of_range_reduction |= conversion_range_mismatch<to_basis>(value);
+            destination[i] = To{wrapping_conversion<to_basis>(value)};
+        }
+    }
+
+    return out_of_range_reduction != from_lane{0};
+}
+
+// Same as the kernel above, but also records whether each element was out of range as one bit of a 64-bit word,
+// in the same way as span_bitmap_kernel
+template <typename To, typename From>
+[[nodiscard]] constexpr auto span_conversion_bitmap_kernel(const std::span<const From> source,
+                                                           const std::span<To> destination,
+                                                           const std::span<std::uint64_t> overflow_bitmap) noexcept -> bool
+{
+    using to_basis = underlying_type_t<To>;
+    using from_basis = underlying_type_t<From>;
+
+    std::uint64_t overflow_reduction {};
+
+    for (std::size_t first {}, word {}; first < source.size(); first += overflow_bitmap_word_bits, ++word)
+    {
+        const auto block_size {source.size() - first < overflow_bitmap_word_bits ? source.size() - first : overflow_bitmap_word_bits};
+
+        std::array<std::uint8_t, overflow_bitmap_word_bits> flags {};
+        for (std::size_t i {}; i < block_size; ++i)
+        {
+            const auto value {static_cast<from_basis>(source[first + i])};
+
+            flags[i] = static_cast<std::uint8_t>(conversion_range_mismatch<to_basis>(value) != 0U);
+            destination[first + i] = To{wrapping_conversion<to_basis>(value)};
+        }
+
+        const auto overflow_bits {pack_overflow_flags(flags)};
+        overflow_bitmap[word] = overflow_bits;
+        overflow_reduction |= overflow_bits;
+    }
+
+    return overflow_reduction != 0U;
+}
+
+} // namespace boost::safe_numbers::detail::impl
+
+namespace boost::safe_numbers {
+
+// Conversions between any two of the non-bounded types, across widths and signedness.
+// The conversion operators throw std::domain_error when the value is out of range of the target type,
+// and these are the non-throwing alternatives.
+
+// Returns std::nullopt if value is out of range of To
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, detail::non_bounded_integral_library_type From>
+[[nodiscard]] constexpr auto checked_cast(const From value BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept -> std::optional<To>
+{
+    using to_basis = detail::underlying_type_t<To>;
+    const auto basis {static_cast<detail::underlying_type_t<From>>(value)};
+
+    if (detail::impl::conversion_overflows<to_basis>(basis) || detail::impl::conversion_underflows<to_basis>(basis))
+    {
+        BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(true, check_failed, conversion, detail::underlying_type_t<From>);
+        return std::nullopt;
+    }
+
+    return To{detail::impl::wrapping_conversion<to_basis>(basis)};
+}
+
+// Returns the min or max of To if value is out of range of it
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, detail::non_bounded_integral_library_type From>
+[[nodiscard]] constexpr auto saturate_cast(const From value BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept -> To
+{
+    using to_basis = detail::underlying_type_t<To>;
+    const auto basis {static_cast<detail::underlying_type_t<From>>(value)};
+
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(detail::impl::conversion_overflows<to_basis>(basis) || detail::impl::conversion_underflows<to_basis>(basis),
+                                           saturated, conversion, detail::underlying_type_t<From>);
+
+    return To{detail::impl::saturating_conversion<to_basis>(basis)};
+}
+
+// Returns the value modulo 2^N for an N-bit To, and whether value was out of range of To
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, detail::non_bounded_integral_library_type From>
+[[nodiscard]] constexpr auto overflowing_cast(const From value BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept -> std::pair<To, bool>
+{
+    using to_basis = detail::underlying_type_t<To>;
+    const auto basis {static_cast<detail::underlying_type_t<From>>(value)};
+
+    const auto out_of_range {detail::impl::conversion_overflows<to_basis>(basis) || detail::impl::conversion_underflows<to_basis>(basis)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(out_of_range, overflowed, conversion, detail::underlying_type_t<From>);
+    return std::make_pair(To{detail::impl::wrapping_conversion<to_basis>(basis)}, out_of_range);
+}
+
+// Span equivalents of the scalar conversions.
+// From may be const qualified so that std::span{values} can be passed for both const and non-const containers,
+// and To is deduced from destination.
+// source and destination must have the same size, otherwise std::domain_error is thrown.
+
+// Converts every element, and returns false if any element was out of range of To.
+// Out of range elements hold the wrapped value.
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, typename From, std::size_t FromExtent, std::size_t ToExtent>
+    requires detail::non_bounded_integral_library_type<std::remove_const_t<From>>
+constexpr auto checked_cast(const std::span<From, FromExtent> source, const std::span<To, ToExtent> destination) -> bool
+{
+    const std::span<const std::remove_const_t<From>> values {source};
+    detail::impl::span_conversion_size_check<To>(values, destination);
+
+    return !detail::impl::span_conversion_kernel<false, To>(values, std::span<To>{destination});
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, typename From, std::size_t FromExtent, std::size_t ToExtent>
+    requires detail::non_bounded_integral_library_type<std::remove_const_t<From>>
+constexpr auto saturate_cast(const std::span<From, FromExtent> source, const std::span<To, ToExtent> destination) -> void
+{
+    const std::span<const std::remove_const_t<From>> values {source};
+    detail::impl::span_conversion_size_check<To>(values, destination);
+
+    static_cast<void>(detail::impl::span_conversion_kernel<true, To>(values, std::span<To>{destination}));
+}
+
+// Writes the wrapped value of every element, and sets bit (i % 64) of overflow_bitmap[i / 64]
+// if element i was out of range of To. Returns true if any element was out of range.
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type To, typename From, std::size_t FromExtent, std::size_t ToExtent>
+    requires detail::non_bounded_integral_library_type<std::remove_const_t<From>>
+constexpr auto overflowing_cast(const std::span<From, FromExtent> source,
+                                const std::span<To, ToExtent> destination,
+                                const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    const std::span<const std::remove_const_t<From>> values {source};
+    detail::impl::span_conversion_size_check<To>(values, destination);
+
+    if (overflow_bitmap.size() < overflow_bitmap_size(values.size()))
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Overflow bitmap is too small to hold one bit per element");
+    }
+
+    return detail::impl::span_conversion_bitmap_kernel<To>(values, std::span<To>{destination}, overflow_bitmap);
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_CONVERSIONS_HPP
@@ -46,6 +46,23 @@
 #endif
 
 
+#endif
+
+// 128-bit vector saturating arithmetic used by the span kernels
+#if (defined(__SSE2__) || defined(_M_AMD64)) && !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
+
+#define BOOST_SAFE_NUMBERS_HAS_SSE2_INTRIN
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+#  include <emmintrin.h>
+#endif
+
+#elif defined(__ARM_NEON) && !defined(_MSC_VER) && !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
+
+#define BOOST_SAFE_NUMBERS_HAS_NEON_INTRIN
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+#  include <arm_neon.h>
+#endif
+
 #endif
 
 #if defined(__GNUC__) || defined(__clang__)
@@ -56,6 +73,16 @@
 #  define BOOST_SAFE_NUMBERS_UNREACHABLE std::abort()
 #endif
 
+// Error reporting functions are never inlined, and with GCC and Clang are also placed away from the hot code,
+// with every branch leading to them predicted not taken
+#if defined(__GNUC__) || defined(__clang__)
+#  define BOOST_SAFE_NUMBERS_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#  define BOOST_SAFE_NUMBERS_COLD __declspec(noinline)
+#else
+#  define BOOST_SAFE_NUMBERS_COLD
+#endif
+
 namespace boost::safe_numbers::detail {
 
 // Workaround for static_assert(false, ...) in if constexpr branches.
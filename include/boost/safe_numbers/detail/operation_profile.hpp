@@ -0,0 +1,137 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The counters of BOOST_SAFE_NUMBERS_ENABLE_PROFILING, which count every operation executed by its operation, type, and policy.
+// Each thread counts into a shard of its own, see <boost/safe_numbers/detail/thread_shards.hpp>,
+// and the shards are read by <boost/safe_numbers/operation_profile.hpp>.
+
+#ifndef BOOST_SAFE_NUMBERS_DETAIL_OPERATION_PROFILE_HPP
+#define BOOST_SAFE_NUMBERS_DETAIL_OPERATION_PROFILE_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/thread_shards.hpp>
+#include <boost/safe_numbers/detail/int128/int128.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail {
+
+inline constexpr const char* profiled_type_names[] {"u8", "u16", "u32", "u64", "u128", "i8", "i16", "i32", "i64", "i128"};
+
+inline constexpr std::size_t profiled_type_count {std::size(profiled_type_names)};
+inline constexpr std::size_t profiled_op_count {static_cast<std::size_t>(arithmetic_op::conversion) + 1U};
+inline constexpr std::size_t profiled_policy_count {static_cast<std::size_t>(overflow_policy::expected) + 1U};
+
+inline constexpr std::size_t operation_profile_size {profiled_type_count * profiled_op_count * profiled_policy_count};
+
+template <typename BasisType>
+consteval auto profiled_type_index() noexcept -> std::size_t
+{
+    if constexpr (std::is_same_v<BasisType, std::uint8_t>)
+    {
+        return 0U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
+    {
+        return 1U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
+    {
+        return 2U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
+    {
+        return 3U;
+    }
+    else if constexpr (std::is_same_v<BasisType, int128::uint128_t>)
+    {
+        return 4U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::int8_t>)
+    {
+        return 5U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::int16_t>)
+    {
+        return 6U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::int32_t>)
+    {
+        return 7U;
+    }
+    else if constexpr (std::is_same_v<BasisType, std::int64_t>)
+    {
+        return 8U;
+    }
+    else
+    {
+        static_assert(std::is_same_v<BasisType, int128::int128_t>, "Only the basis types of the library are profiled");
+        return 9U;
+    }
+}
+
+constexpr auto operation_profile_index(const std::size_t type, const arithmetic_op op, const overflow_policy policy) noexcept -> std::size_t
+{
+    return (type * profiled_op_count + static_cast<std::size_t>(op)) * profiled_policy_count + static_cast<std::size_t>(policy);
+}
+
+struct operation_profile_shard
+{
+    std::atomic<std::uint64_t> counts[operation_profile_size] {};
+
+    std::atomic<bool> owned {true};
+    operation_profile_shard* next {nullptr};
+};
+
+inline void count_operation(const std::size_t index) noexcept
+{
+    auto* shard {thread_shard<operation_profile_shard>()};
+    if (shard != nullptr) [[likely]]
+    {
+        increment_owned_counter(shard->counts[index]);
+    }
+    else
+    {
+        thread_shards_unrecorded<operation_profile_shard>.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+} // namespace boost::safe_numbers::detail
+
+// BOOST_SAFE_NUMBERS_PROFILE_OPERATION(op, policy, BasisType) counts one execution of the operation,
+// and is placed at the entry points of the operations: the *_impl functions and the operators that do not call them.
+// Constant evaluation and device code are never counted.
+#if defined(BOOST_SAFE_NUMBERS_ENABLE_PROFILING) && !defined(__CUDACC__)
+
+#define BOOST_SAFE_NUMBERS_HAS_PROFILING
+
+#define BOOST_SAFE_NUMBERS_PROFILE_OPERATION(op, policy, basis_type)                                                    \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        if (!std::is_constant_evaluated())                                                                              \
+        {                                                                                                               \
+            constexpr auto operation_index {::boost::safe_numbers::detail::operation_profile_index(                      \
+                ::boost::safe_numbers::detail::profiled_type_index<basis_type>(),                                       \
+                ::boost::safe_numbers::arithmetic_op::op, policy)};                                                     \
+            ::boost::safe_numbers::detail::count_operation(operation_index);                                            \
+        }                                                                                                               \
+    } while (false)
+
+#else
+
+#define BOOST_SAFE_NUMBERS_PROFILE_OPERATION(op, policy, basis_type) static_cast<void>(0)
+
+#endif // BOOST_SAFE_NUMBERS_ENABLE_PROFILING
+
+#endif // BOOST_SAFE_NUMBERS_DETAIL_OPERATION_PROFILE_HPP
@@ -9,7 +9,10 @@
 #include <boost/safe_numbers/detail/type_traits.hpp>
 #include <boost/safe_numbers/detail/int128/bit.hpp>
 #include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/detail/operation_profile.hpp>
 #include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/error_context.hpp>
+#include <boost/safe_numbers/expected.hpp>
 
 #ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
 
@@ -327,11 +330,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE constexpr signed_integer_basis<BasisType>::operat
     {
         if (basis_ > static_cast<BasisType>(std::numeric_limits<OtherBasis>::max()))
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, (signed_overflow_conversion_msg<BasisType, OtherBasis>()));
+            BOOST_SAFE_NUMBERS_REPORT_ERROR(std::domain_error, (signed_overflow_conversion_msg<BasisType, OtherBasis>()), conversion, basis_, BasisType{0});
         }
         else if (basis_ < static_cast<BasisType>(std::numeric_limits<OtherBasis>::min()))
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, (signed_underflow_conversion_msg<BasisType, OtherBasis>()));
+            BOOST_SAFE_NUMBERS_REPORT_ERROR(std::domain_error, (signed_underflow_conversion_msg<BasisType, OtherBasis>()), conversion, basis_, BasisType{0});
         }
     }
 
@@ -347,9 +350,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE constexpr auto signed_integer_basis<BasisType>::o
 template <fundamental_signed_integral BasisType>
 BOOST_SAFE_NUMBERS_HOST_DEVICE constexpr auto signed_integer_basis<BasisType>::operator-() const -> signed_integer_basis
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(neg, overflow_policy::throw_exception, BasisType);
+
     if (basis_ == std::numeric_limits<BasisType>::min()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, signed_unary_minus_overflow_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::domain_error, signed_unary_minus_overflow_msg<BasisType>(), neg, basis_, BasisType{0});
     }
 
     return signed_integer_basis{static_cast<BasisType>(-basis_)};
@@ -502,7 +507,7 @@ struct signed_add_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType result {};
 
-        auto handle_error = [&result](signed_overflow_status status)
+        auto handle_error = [&](signed_overflow_status status)
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
             if (std::is_constant_evaluated())
@@ -511,46 +516,46 @@ struct signed_add_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i8 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i16 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i32 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i64 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 addition");
                     }
                     else
                     {
-                        throw std::overflow_error("Overflow detected in i128 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 addition");
                     }
                 }
                 else
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i8 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i16 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i32 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 addition");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i64 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 addition");
                     }
                     else
                     {
-                        throw std::underflow_error("Underflow detected in i128 addition");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 addition");
                     }
                 }
             }
@@ -563,11 +568,11 @@ struct signed_add_helper
 
                     if (status == signed_overflow_status::overflow)
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_add_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_add_msg<BasisType>(), add, lhs_basis, rhs_basis);
                     }
                     else
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, signed_underflow_add_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, signed_underflow_add_msg<BasisType>(), add, lhs_basis, rhs_basis);
                     }
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
@@ -594,6 +599,20 @@ struct signed_add_helper
             }
         };
 
+        #if defined(BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW) && !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
+
+        // Overflow is assumed not to happen, and the plain operation lets the optimizer treat it like that of a builtin,
+        // which it does not do with the unreachable branches of the check until after vectorization
+        if constexpr (Policy == overflow_policy::throw_exception && !std::is_same_v<BasisType, int128::int128_t>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return result_type{static_cast<BasisType>(lhs_basis + rhs_basis)};
+            }
+        }
+
+        #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
         #if BOOST_SAFE_NUMBERS_HAS_BUILTIN(__builtin_add_overflow) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X64_INTRIN) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X86_INTRIN)
 
         if constexpr (!std::is_same_v<BasisType, int128::int128_t>)
@@ -728,6 +747,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
              Policy == overflow_policy::checked || Policy == overflow_policy::strict ||
              Policy == overflow_policy::widen)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, Policy, BasisType);
     return signed_add_helper<Policy, BasisType>::apply(lhs,rhs);
 }
 
@@ -748,46 +768,46 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::overflow_error("Overflow detected in i8 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::overflow_error("Overflow detected in i16 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::overflow_error("Overflow detected in i32 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::overflow_error("Overflow detected in i64 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 addition");
             }
             else
             {
-                throw std::overflow_error("Overflow detected in i128 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 addition");
             }
         }
         else if (status == impl::signed_overflow_status::underflow)
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::underflow_error("Underflow detected in i8 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::underflow_error("Underflow detected in i16 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::underflow_error("Underflow detected in i32 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::underflow_error("Underflow detected in i64 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 addition");
             }
             else
             {
-                throw std::underflow_error("Underflow detected in i128 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 addition");
             }
         }
 
@@ -796,6 +816,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::throw_exception, BasisType);
     return impl::signed_add_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1115,7 +1136,7 @@ struct signed_sub_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType result {};
 
-        auto handle_error = [&result](signed_overflow_status status)
+        auto handle_error = [&](signed_overflow_status status)
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
             if (std::is_constant_evaluated())
@@ -1124,46 +1145,46 @@ struct signed_sub_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i8 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i16 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i32 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i64 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 subtraction");
                     }
                     else
                     {
-                        throw std::overflow_error("Overflow detected in i128 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 subtraction");
                     }
                 }
                 else
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i8 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i16 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i32 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 subtraction");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i64 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 subtraction");
                     }
                     else
                     {
-                        throw std::underflow_error("Underflow detected in i128 subtraction");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 subtraction");
                     }
                 }
             }
@@ -1176,11 +1197,11 @@ struct signed_sub_helper
 
                     if (status == signed_overflow_status::overflow)
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_sub_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_sub_msg<BasisType>(), sub, lhs_basis, rhs_basis);
                     }
                     else
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, signed_underflow_sub_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, signed_underflow_sub_msg<BasisType>(), sub, lhs_basis, rhs_basis);
                     }
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
@@ -1207,6 +1228,20 @@ struct signed_sub_helper
             }
         };
 
+        #if defined(BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW) && !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
+
+        // Overflow is assumed not to happen, and the plain operation lets the optimizer treat it like that of a builtin,
+        // which it does not do with the unreachable branches of the check until after vectorization
+        if constexpr (Policy == overflow_policy::throw_exception && !std::is_same_v<BasisType, int128::int128_t>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return result_type{static_cast<BasisType>(lhs_basis - rhs_basis)};
+            }
+        }
+
+        #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
         #if BOOST_SAFE_NUMBERS_HAS_BUILTIN(__builtin_sub_overflow) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X64_INTRIN) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X86_INTRIN)
 
         if constexpr (!std::is_same_v<BasisType, int128::int128_t>)
@@ -1324,6 +1359,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple ||
              Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, Policy, BasisType);
     return signed_sub_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1344,46 +1380,46 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::overflow_error("Overflow detected in i8 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::overflow_error("Overflow detected in i16 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::overflow_error("Overflow detected in i32 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::overflow_error("Overflow detected in i64 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 subtraction");
             }
             else
             {
-                throw std::overflow_error("Overflow detected in i128 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 subtraction");
             }
         }
         else if (status == impl::signed_overflow_status::underflow)
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::underflow_error("Underflow detected in i8 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::underflow_error("Underflow detected in i16 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::underflow_error("Underflow detected in i32 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::underflow_error("Underflow detected in i64 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 subtraction");
             }
             else
             {
-                throw std::underflow_error("Underflow detected in i128 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 subtraction");
             }
         }
 
@@ -1392,6 +1428,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::throw_exception, BasisType);
     return impl::signed_sub_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1671,7 +1708,7 @@ struct signed_mul_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType result {};
 
-        auto handle_error = [&result](signed_overflow_status status)
+        auto handle_error = [&](signed_overflow_status status)
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
             if (std::is_constant_evaluated())
@@ -1680,46 +1717,46 @@ struct signed_mul_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i8 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i16 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i32 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i64 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 multiplication");
                     }
                     else
                     {
-                        throw std::overflow_error("Overflow detected in i128 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 multiplication");
                     }
                 }
                 else
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i8 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i16 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i32 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 multiplication");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::underflow_error("Underflow detected in i64 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 multiplication");
                     }
                     else
                     {
-                        throw std::underflow_error("Underflow detected in i128 multiplication");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 multiplication");
                     }
                 }
             }
@@ -1732,11 +1769,11 @@ struct signed_mul_helper
 
                     if (status == signed_overflow_status::overflow)
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_mul_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_mul_msg<BasisType>(), mul, lhs_basis, rhs_basis);
                     }
                     else
                     {
-                        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, signed_underflow_mul_msg<BasisType>());
+                        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, signed_underflow_mul_msg<BasisType>(), mul, lhs_basis, rhs_basis);
                     }
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
@@ -1763,6 +1800,20 @@ struct signed_mul_helper
             }
         };
 
+        #if defined(BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW) && !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
+
+        // Overflow is assumed not to happen, and the plain operation lets the optimizer treat it like that of a builtin,
+        // which it does not do with the unreachable branches of the check until after vectorization
+        if constexpr (Policy == overflow_policy::throw_exception && !std::is_same_v<BasisType, int128::int128_t>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return result_type{static_cast<BasisType>(lhs_basis * rhs_basis)};
+            }
+        }
+
+        #endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
         #if BOOST_SAFE_NUMBERS_HAS_BUILTIN(__builtin_mul_overflow) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X64_INTRIN) || defined(BOOST_SAFENUMBERS_HAS_WINDOWS_X86_INTRIN)
 
         if constexpr (!std::is_same_v<BasisType, int128::int128_t>)
@@ -1897,6 +1948,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
              Policy == overflow_policy::checked || Policy == overflow_policy::strict ||
              Policy == overflow_policy::widen)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, Policy, BasisType);
     return signed_mul_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1917,46 +1969,46 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::overflow_error("Overflow detected in i8 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::overflow_error("Overflow detected in i16 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::overflow_error("Overflow detected in i32 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::overflow_error("Overflow detected in i64 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 multiplication");
             }
             else
             {
-                throw std::overflow_error("Overflow detected in i128 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 multiplication");
             }
         }
         else if (status == impl::signed_overflow_status::underflow)
         {
             if constexpr (std::is_same_v<BasisType, std::int8_t>)
             {
-                throw std::underflow_error("Underflow detected in i8 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i8 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int16_t>)
             {
-                throw std::underflow_error("Underflow detected in i16 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i16 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int32_t>)
             {
-                throw std::underflow_error("Underflow detected in i32 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i32 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::int64_t>)
             {
-                throw std::underflow_error("Underflow detected in i64 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i64 multiplication");
             }
             else
             {
-                throw std::underflow_error("Underflow detected in i128 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in i128 multiplication");
             }
         }
 
@@ -1965,6 +2017,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::throw_exception, BasisType);
     return impl::signed_mul_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -2063,29 +2116,29 @@ struct signed_div_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::domain_error("Division by zero in i8 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i8 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::domain_error("Division by zero in i16 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i16 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::domain_error("Division by zero in i32 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i32 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::domain_error("Division by zero in i64 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i64 division");
                     }
                     else
                     {
-                        throw std::domain_error("Division by zero in i128 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i128 division");
                     }
                 }
                 else
                 #endif
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, signed_div_by_zero_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, signed_div_by_zero_msg<BasisType>(), div, lhs_basis, rhs_basis);
                 }
             }
         }
@@ -2115,29 +2168,29 @@ struct signed_div_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i8 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i16 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i32 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 division");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i64 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 division");
                     }
                     else
                     {
-                        throw std::overflow_error("Overflow detected in i128 division");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 division");
                     }
                 }
                 else
                 #endif
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_div_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_div_msg<BasisType>(), div, lhs_basis, rhs_basis);
                 }
             }
         }
@@ -2162,7 +2215,7 @@ struct signed_div_helper<overflow_policy::overflow_tuple, BasisType>
 
         if (rhs_basis == BasisType{0}) [[unlikely]]
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, signed_div_by_zero_msg<BasisType>());
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, signed_div_by_zero_msg<BasisType>(), div, lhs_basis, rhs_basis);
         }
 
         if (lhs_basis == BasisType{0})
@@ -2221,6 +2274,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const signed_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, Policy, BasisType);
     return signed_div_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -2231,6 +2285,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 [[nodiscard]] constexpr auto operator/(const signed_integer_basis<BasisType> lhs,
                                        const signed_integer_basis<BasisType> rhs) -> signed_integer_basis<BasisType>
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::throw_exception, BasisType);
     return impl::signed_div_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -2329,29 +2384,29 @@ struct signed_mod_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::domain_error("Division by zero in i8 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i8 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::domain_error("Division by zero in i16 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i16 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::domain_error("Division by zero in i32 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i32 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::domain_error("Division by zero in i64 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i64 modulo");
                     }
                     else
                     {
-                        throw std::domain_error("Division by zero in i128 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Division by zero in i128 modulo");
                     }
                 }
                 else
                 #endif
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, signed_mod_by_zero_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, signed_mod_by_zero_msg<BasisType>(), mod, lhs_basis, rhs_basis);
                 }
             }
         }
@@ -2384,29 +2439,29 @@ struct signed_mod_helper
                 {
                     if constexpr (std::is_same_v<BasisType, std::int8_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i8 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i8 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int16_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i16 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i16 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int32_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i32 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i32 modulo");
                     }
                     else if constexpr (std::is_same_v<BasisType, std::int64_t>)
                     {
-                        throw std::overflow_error("Overflow detected in i64 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i64 modulo");
                     }
                     else
                     {
-                        throw std::overflow_error("Overflow detected in i128 modulo");
+                        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in i128 modulo");
                     }
                 }
                 else
                 #endif
                 {
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_mod_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_mod_msg<BasisType>(), mod, lhs_basis, rhs_basis);
                 }
             }
         }
@@ -2431,7 +2486,7 @@ struct signed_mod_helper<overflow_policy::overflow_tuple, BasisType>
 
         if (rhs_basis == BasisType{0}) [[unlikely]]
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, signed_mod_by_zero_msg<BasisType>());
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, signed_mod_by_zero_msg<BasisType>(), mod, lhs_basis, rhs_basis);
         }
 
         if (lhs_basis == BasisType{0})
@@ -2490,6 +2545,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const signed_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, Policy, BasisType);
     return signed_mod_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -2500,6 +2556,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 [[nodiscard]] constexpr auto operator%(const signed_integer_basis<BasisType> lhs,
                                        const signed_integer_basis<BasisType> rhs) -> signed_integer_basis<BasisType>
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::throw_exception, BasisType);
     return impl::signed_mod_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -2578,9 +2635,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto signed_integer_basis<BasisType>::operator++()
     -> signed_integer_basis&
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(inc, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::max()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_inc_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_inc_msg<BasisType>(), inc, this->basis_, BasisType{0});
     }
 
     ++this->basis_;
@@ -2592,9 +2651,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto signed_integer_basis<BasisType>::operator++(int)
     -> signed_integer_basis
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(inc, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::max()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, signed_overflow_inc_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, signed_overflow_inc_msg<BasisType>(), inc, this->basis_, BasisType{0});
     }
 
     const auto temp {*this};
@@ -2611,9 +2672,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto signed_integer_basis<BasisType>::operator--()
     -> signed_integer_basis&
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(dec, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::min()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, signed_underflow_dec_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, signed_underflow_dec_msg<BasisType>(), dec, this->basis_, BasisType{0});
     }
 
     --this->basis_;
@@ -2625,9 +2688,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto signed_integer_basis<BasisType>::operator--(int)
     -> signed_integer_basis
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(dec, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::min()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, signed_underflow_dec_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, signed_underflow_dec_msg<BasisType>(), dec, this->basis_, BasisType{0});
     }
 
     const auto temp {*this};
@@ -2643,52 +2708,151 @@ constexpr auto signed_integer_basis<BasisType>::operator--(int)
 
 namespace boost::safe_numbers {
 
+// With telemetry, the saturating operations are computed once with the overflow_tuple policy,
+// whose flag is both recorded and selects the bound that replaces the result
+
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto saturating_add(const detail::signed_integer_basis<BasisType> lhs,
-                                            const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                            const detail::signed_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::signed_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::saturate, BasisType);
+    const auto res {detail::impl::signed_add_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, add, BasisType);
+
+    if (res.second)
+    {
+        return detail::signed_integer_basis<BasisType>{static_cast<BasisType>(lhs) >= BasisType{0} ?
+               (std::numeric_limits<BasisType>::max()) :
+               (std::numeric_limits<BasisType>::min())};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::impl::add_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating addition", saturating_add)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto saturating_sub(const detail::signed_integer_basis<BasisType> lhs,
-                                            const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                            const detail::signed_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::signed_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::saturate, BasisType);
+    const auto res {detail::impl::signed_sub_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, sub, BasisType);
+
+    if (res.second)
+    {
+        return detail::signed_integer_basis<BasisType>{static_cast<BasisType>(lhs) >= BasisType{0} ?
+               (std::numeric_limits<BasisType>::max()) :
+               (std::numeric_limits<BasisType>::min())};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::impl::sub_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating subtraction", saturating_sub)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto saturating_mul(const detail::signed_integer_basis<BasisType> lhs,
-                                            const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                            const detail::signed_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::signed_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::saturate, BasisType);
+    const auto res {detail::impl::signed_mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, mul, BasisType);
+
+    if (res.second)
+    {
+        return detail::signed_integer_basis<BasisType>{(static_cast<BasisType>(lhs) < BasisType{0}) == (static_cast<BasisType>(rhs) < BasisType{0}) ?
+               (std::numeric_limits<BasisType>::max()) :
+               (std::numeric_limits<BasisType>::min())};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::impl::mul_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating multiplication", saturating_mul)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto saturating_div(const detail::signed_integer_basis<BasisType> lhs,
-                                            const detail::signed_integer_basis<BasisType> rhs)
+                                            const detail::signed_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> detail::signed_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::saturate, BasisType);
+    const auto res {detail::impl::signed_div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, div, BasisType);
+
+    if (res.second)
+    {
+        return detail::signed_integer_basis<BasisType>{std::numeric_limits<BasisType>::max()};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::impl::div_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating division", saturating_div)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto saturating_mod(const detail::signed_integer_basis<BasisType> lhs,
-                                            const detail::signed_integer_basis<BasisType> rhs)
+                                            const detail::signed_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> detail::signed_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::saturate, BasisType);
+    const auto res {detail::impl::signed_mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, mod, BasisType);
+
+    if (res.second)
+    {
+        return detail::signed_integer_basis<BasisType>{BasisType{0}};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::impl::mod_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating modulo", saturating_mod)
@@ -2699,50 +2863,65 @@ BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("saturating modulo", saturatin
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_add(const detail::signed_integer_basis<BasisType> lhs,
-                                             const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                             const detail::signed_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::signed_integer_basis<BasisType>, bool>
 {
-    return detail::impl::add_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::impl::add_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, add, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing addition", overflowing_add)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_sub(const detail::signed_integer_basis<BasisType> lhs,
-                                             const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                             const detail::signed_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::signed_integer_basis<BasisType>, bool>
 {
-    return detail::impl::sub_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::impl::sub_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, sub, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing subtraction", overflowing_sub)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_mul(const detail::signed_integer_basis<BasisType> lhs,
-                                             const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                             const detail::signed_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::signed_integer_basis<BasisType>, bool>
 {
-    return detail::impl::mul_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::impl::mul_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, mul, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing multiplication", overflowing_mul)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_div(const detail::signed_integer_basis<BasisType> lhs,
-                                             const detail::signed_integer_basis<BasisType> rhs)
+                                             const detail::signed_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> std::pair<detail::signed_integer_basis<BasisType>, bool>
 {
-    return detail::impl::div_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::impl::div_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, div, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing division", overflowing_div)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_mod(const detail::signed_integer_basis<BasisType> lhs,
-                                             const detail::signed_integer_basis<BasisType> rhs)
+                                             const detail::signed_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> std::pair<detail::signed_integer_basis<BasisType>, bool>
 {
-    return detail::impl::mod_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::impl::mod_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, mod, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing modulo", overflowing_mod)
@@ -2753,50 +2932,65 @@ BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("overflowing modulo", overflow
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto checked_add(const detail::signed_integer_basis<BasisType> lhs,
-                                         const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                         const detail::signed_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::signed_integer_basis<BasisType>>
 {
-    return detail::impl::add_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::impl::add_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, add, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("checked addition", checked_add)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto checked_sub(const detail::signed_integer_basis<BasisType> lhs,
-                                         const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                         const detail::signed_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::signed_integer_basis<BasisType>>
 {
-    return detail::impl::sub_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::impl::sub_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, sub, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("checked subtraction", checked_sub)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto checked_mul(const detail::signed_integer_basis<BasisType> lhs,
-                                         const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                         const detail::signed_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::signed_integer_basis<BasisType>>
 {
-    return detail::impl::mul_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::impl::mul_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, mul, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("checked multiplication", checked_mul)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto checked_div(const detail::signed_integer_basis<BasisType> lhs,
-                                         const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                         const detail::signed_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::signed_integer_basis<BasisType>>
 {
-    return detail::impl::div_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::impl::div_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, div, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("checked division", checked_div)
 
 template <detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto checked_mod(const detail::signed_integer_basis<BasisType> lhs,
-                                         const detail::signed_integer_basis<BasisType> rhs) noexcept
+                                         const detail::signed_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::signed_integer_basis<BasisType>>
 {
-    return detail::impl::mod_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::impl::mod_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, mod, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("checked modulo", checked_mod)
@@ -2877,13 +3071,326 @@ template <detail::fundamental_signed_integral BasisType>
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("widening mul", widening_mul)
 
+// ------------------------------
+// Sticky Math
+// ------------------------------
+
+// The sticky functions return the wrapped result as the overflowing functions do,
+// and OR the overflow flag into context, or into thread_error_context() when no context is passed
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto sticky_add(const detail::signed_integer_basis<BasisType> lhs,
+                                        const detail::signed_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::sticky, BasisType);
+
+    // Unlike the overflow builtins, the portable test vectorizes when called in a loop
+    BasisType res {};
+    context.record(detail::impl::signed_no_intrin_add(static_cast<BasisType>(lhs), static_cast<BasisType>(rhs), res) != detail::impl::signed_overflow_status::no_error);
+    return detail::signed_integer_basis<BasisType>{res};
+}
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] auto sticky_add(const detail::signed_integer_basis<BasisType> lhs,
+                              const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    return sticky_add(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("sticky addition", sticky_add)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto sticky_sub(const detail::signed_integer_basis<BasisType> lhs,
+                                        const detail::signed_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::sticky, BasisType);
+
+    // Unlike the overflow builtins, the portable test vectorizes when called in a loop
+    BasisType res {};
+    context.record(detail::impl::signed_no_intrin_sub(static_cast<BasisType>(lhs), static_cast<BasisType>(rhs), res) != detail::impl::signed_overflow_status::no_error);
+    return detail::signed_integer_basis<BasisType>{res};
+}
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] auto sticky_sub(const detail::signed_integer_basis<BasisType> lhs,
+                              const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    return sticky_sub(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("sticky subtraction", sticky_sub)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto sticky_mul(const detail::signed_integer_basis<BasisType> lhs,
+                                        const detail::signed_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] auto sticky_mul(const detail::signed_integer_basis<BasisType> lhs,
+                              const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    return sticky_mul(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("sticky multiplication", sticky_mul)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto sticky_div(const detail::signed_integer_basis<BasisType> lhs,
+                                        const detail::signed_integer_basis<BasisType> rhs,
+                                        error_context& context)
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] auto sticky_div(const detail::signed_integer_basis<BasisType> lhs,
+                              const detail::signed_integer_basis<BasisType> rhs)
+    -> detail::signed_integer_basis<BasisType>
+{
+    return sticky_div(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("sticky division", sticky_div)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto sticky_mod(const detail::signed_integer_basis<BasisType> lhs,
+                                        const detail::signed_integer_basis<BasisType> rhs,
+                                        error_context& context)
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] auto sticky_mod(const detail::signed_integer_basis<BasisType> lhs,
+                              const detail::signed_integer_basis<BasisType> rhs)
+    -> detail::signed_integer_basis<BasisType>
+{
+    return sticky_mod(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("sticky modulo", sticky_mod)
+
+// ------------------------------
+// Wrapping Math
+// ------------------------------
+
+// Modular arithmetic, returning the same value as the overflowing functions without computing the flag.
+// The operation is done on the unsigned type of the same width, where wrapping is defined.
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_add(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::wrap, BasisType);
+
+    using unsigned_type = detail::impl::make_unsigned_helper_t<BasisType>;
+    using promoted_type = detail::impl::wrapping_promoted_t<unsigned_type>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) + static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::signed_integer_basis<BasisType>{static_cast<BasisType>(static_cast<unsigned_type>(res))};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("wrapping addition", wrapping_add)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_sub(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::wrap, BasisType);
+
+    using unsigned_type = detail::impl::make_unsigned_helper_t<BasisType>;
+    using promoted_type = detail::impl::wrapping_promoted_t<unsigned_type>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) - static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::signed_integer_basis<BasisType>{static_cast<BasisType>(static_cast<unsigned_type>(res))};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("wrapping subtraction", wrapping_sub)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_mul(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::wrap, BasisType);
+
+    using unsigned_type = detail::impl::make_unsigned_helper_t<BasisType>;
+    using promoted_type = detail::impl::wrapping_promoted_t<unsigned_type>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) * static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::signed_integer_basis<BasisType>{static_cast<BasisType>(static_cast<unsigned_type>(res))};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("wrapping multiplication", wrapping_mul)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_div(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs)
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::wrap, BasisType);
+
+    return detail::impl::signed_div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs).first;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("wrapping division", wrapping_div)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_mod(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs)
+    -> detail::signed_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::wrap, BasisType);
+
+    return detail::impl::signed_mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs).first;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("wrapping modulo", wrapping_mod)
+
+// ------------------------------
+// Expected Math
+// ------------------------------
+
+// The expected functions return the result, or why the operation failed, without throwing.
+// The direction of an overflow follows from the signs of the operands.
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto expected_add(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::signed_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_add_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(
+            static_cast<BasisType>(rhs) < BasisType{0} ? arithmetic_errc::underflow : arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("expected addition", expected_add)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto expected_sub(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::signed_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_sub_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(
+            static_cast<BasisType>(rhs) > BasisType{0} ? arithmetic_errc::underflow : arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("expected subtraction", expected_sub)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto expected_mul(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::signed_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::impl::signed_mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(
+            (static_cast<BasisType>(lhs) < BasisType{0}) != (static_cast<BasisType>(rhs) < BasisType{0}) ? arithmetic_errc::underflow : arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("expected multiplication", expected_mul)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto expected_div(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::signed_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::expected, BasisType);
+
+    if (static_cast<BasisType>(rhs) == BasisType{0}) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(arithmetic_errc::division_by_zero);
+    }
+
+    // Only min / -1 overflows
+    const auto [res, overflowed] {detail::impl::signed_div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("expected division", expected_div)
+
+template <detail::fundamental_signed_integral BasisType>
+[[nodiscard]] constexpr auto expected_mod(const detail::signed_integer_basis<BasisType> lhs,
+                                          const detail::signed_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::signed_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::expected, BasisType);
+
+    if (static_cast<BasisType>(rhs) == BasisType{0}) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(arithmetic_errc::division_by_zero);
+    }
+
+    // Only min / -1 overflows
+    const auto [res, overflowed] {detail::impl::signed_mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::signed_integer_basis<BasisType>>(arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_SIGNED_INTEGER_OP("expected modulo", expected_mod)
+
 // ------------------------------
 // Generic policy-parameterized functions
 // ------------------------------
 
 template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto add(const detail::signed_integer_basis<BasisType> lhs,
-                                 const detail::signed_integer_basis<BasisType> rhs)
+                                 const detail::signed_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2892,15 +3399,15 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_add(lhs, rhs);
+        return saturating_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_add(lhs, rhs);
+        return overflowing_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_add(lhs, rhs);
+        return checked_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
@@ -2910,6 +3417,18 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     {
         return widening_add(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_add(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_add(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_add(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for addition");
@@ -2918,7 +3437,8 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 
 template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto sub(const detail::signed_integer_basis<BasisType> lhs,
-                                 const detail::signed_integer_basis<BasisType> rhs)
+                                 const detail::signed_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2927,20 +3447,32 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_sub(lhs, rhs);
+        return saturating_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_sub(lhs, rhs);
+        return overflowing_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_sub(lhs, rhs);
+        return checked_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_sub(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_sub(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_sub(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_sub(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for subtraction");
@@ -2949,7 +3481,8 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 
 template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto mul(const detail::signed_integer_basis<BasisType> lhs,
-                                 const detail::signed_integer_basis<BasisType> rhs)
+                                 const detail::signed_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2958,15 +3491,15 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_mul(lhs, rhs);
+        return saturating_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_mul(lhs, rhs);
+        return overflowing_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_mul(lhs, rhs);
+        return checked_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
@@ -2976,6 +3509,18 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     {
         return widening_mul(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_mul(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_mul(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_mul(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for multiplication");
@@ -2984,8 +3529,9 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 
 template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto div(const detail::signed_integer_basis<BasisType> lhs,
-                                 const detail::signed_integer_basis<BasisType> rhs)
-    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+                                 const detail::signed_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::expected)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
     {
@@ -2993,20 +3539,32 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_div(lhs, rhs);
+        return saturating_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_div(lhs, rhs);
+        return overflowing_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_div(lhs, rhs);
+        return checked_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_div(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_div(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_div(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_div(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for division");
@@ -3015,8 +3573,9 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 
 template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
 [[nodiscard]] constexpr auto mod(const detail::signed_integer_basis<BasisType> lhs,
-                                 const detail::signed_integer_basis<BasisType> rhs)
-    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+                                 const detail::signed_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::expected)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
     {
@@ -3024,20 +3583,32 @@ template <overflow_policy Policy, detail::fundamental_signed_integral BasisType>
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_mod(lhs, rhs);
+        return saturating_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_mod(lhs, rhs);
+        return overflowing_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_mod(lhs, rhs);
+        return checked_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_mod(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_mod(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_mod(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_mod(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for modulo");
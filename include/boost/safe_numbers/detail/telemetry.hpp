@@ -0,0 +1,166 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The counters of BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY, which count how often each call site saturates, overflows, fails a check, or reports an error.
+// Each thread counts into a shard of its own, see <boost/safe_numbers/detail/thread_shards.hpp>,
+// and the shards are read by <boost/safe_numbers/telemetry.hpp>.
+
+#ifndef BOOST_SAFE_NUMBERS_DETAIL_TELEMETRY_HPP
+#define BOOST_SAFE_NUMBERS_DETAIL_TELEMETRY_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/thread_shards.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+BOOST_SAFE_NUMBERS_EXPORT enum class telemetry_event
+{
+    saturated,      // A saturating_* function or saturate_cast returned a bound instead of the result
+    overflowed,     // An overflowing_* function or overflowing_cast returned true
+    check_failed,   // A checked_* function or checked_cast returned std::nullopt
+    error,          // An error was reported by throwing or to the overflow handlers, including the range errors of bounded types
+};
+
+namespace detail {
+
+// A site is keyed by the pointers of its strings, which are merged with those of the other shards when read
+struct telemetry_key
+{
+    const char* file {nullptr};
+    const char* function {nullptr};
+    std::uint_least32_t line {};
+    std::uint_least32_t column {};
+    telemetry_event event {telemetry_event::error};
+    arithmetic_op op {arithmetic_op::none};
+    const char* type {nullptr};
+
+    [[nodiscard]] friend constexpr auto operator==(const telemetry_key&, const telemetry_key&) noexcept -> bool = default;
+};
+
+inline constexpr std::size_t telemetry_shard_capacity {512U};
+
+// Only the thread that owns the shard writes to it, and it publishes the key of an entry before using it
+struct telemetry_entry
+{
+    telemetry_key key {};
+    std::atomic<bool> used {false};
+    std::atomic<std::uint64_t> count {};
+};
+
+struct telemetry_shard
+{
+    telemetry_entry entries[telemetry_shard_capacity] {};
+
+    // The events at sites that did not fit
+    std::atomic<std::uint64_t> unrecorded {};
+
+    std::atomic<bool> owned {true};
+    telemetry_shard* next {nullptr};
+};
+
+[[nodiscard]] inline auto telemetry_hash(const telemetry_key& key) noexcept -> std::size_t
+{
+    std::uint64_t hash {UINT64_C(0xCBF29CE484222325)};
+
+    for (const auto value : {static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(key.file)),
+                             static_cast<std::uint64_t>(key.line),
+                             static_cast<std::uint64_t>(key.column),
+                             static_cast<std::uint64_t>(key.event),
+                             static_cast<std::uint64_t>(key.op)})
+    {
+        hash = (hash ^ value) * UINT64_C(0x100000001B3);
+    }
+
+    return static_cast<std::size_t>(hash ^ (hash >> 32U));
+}
+
+inline void record_telemetry(const telemetry_key& key) noexcept
+{
+    auto* shard {thread_shard<telemetry_shard>()};
+    if (shard == nullptr)
+    {
+        thread_shards_unrecorded<telemetry_shard>.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto hash {telemetry_hash(key)};
+
+    for (std::size_t probe {}; probe < telemetry_shard_capacity; ++probe)
+    {
+        auto& entry {shard->entries[(hash + probe) % telemetry_shard_capacity]};
+
+        if (!entry.used.load(std::memory_order_relaxed))
+        {
+            entry.key = key;
+            entry.used.store(true, std::memory_order_release);
+        }
+        else if (entry.key != key)
+        {
+            continue;
+        }
+
+        increment_owned_counter(entry.count);
+        return;
+    }
+
+    shard->unrecorded.fetch_add(1U, std::memory_order_relaxed);
+}
+
+// Out of line and cold, so that an instrumented operation only gains a predicted not taken call
+BOOST_SAFE_NUMBERS_COLD inline void record_telemetry(const telemetry_event event, const arithmetic_op op, const char* type,
+                                                     const std::source_location& site) noexcept
+{
+    record_telemetry(telemetry_key{site.file_name(), site.function_name(), site.line(), site.column(), event, op, type});
+}
+
+} // namespace detail
+
+} // namespace boost::safe_numbers
+
+// The instrumented functions take the call site as a defaulted last parameter, and the functions that call them on behalf of the caller pass it on.
+// BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(condition, event, op, BasisType) counts the call site when condition holds,
+// and the condition is only evaluated in instrumented builds.
+// Device code is never instrumented.
+#if defined(BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY) && !defined(__CUDACC__)
+
+#define BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_SITE , [[maybe_unused]] const std::source_location& telemetry_site = std::source_location::current()
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE , telemetry_site
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(condition, event, op, basis_type)                                        \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        if (!std::is_constant_evaluated() && (condition)) [[unlikely]]                                                  \
+        {                                                                                                               \
+            ::boost::safe_numbers::detail::record_telemetry(::boost::safe_numbers::telemetry_event::event,              \
+                                                            ::boost::safe_numbers::arithmetic_op::op,                   \
+                                                            ::boost::safe_numbers::detail::operand_type_name<basis_type>(), \
+                                                            telemetry_site);                                            \
+        }                                                                                                               \
+    } while (false)
+
+#else
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_SITE
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE
+
+#define BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(condition, event, op, basis_type) static_cast<void>(0)
+
+#endif // BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY
+
+#endif // BOOST_SAFE_NUMBERS_DETAIL_TELEMETRY_HPP
@@ -0,0 +1,122 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Counters that each thread writes into a shard of its own, so that counting needs no read-modify-write operations.
+// The shards stay in a list that is never shrunk, so that they can be read at any time from any thread,
+// and the shard of a thread that exits is taken over, with its counts, by the next thread that needs one.
+
+#ifndef BOOST_SAFE_NUMBERS_DETAIL_THREAD_SHARDS_HPP
+#define BOOST_SAFE_NUMBERS_DETAIL_THREAD_SHARDS_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail {
+
+// Shard has the members:
+//   std::atomic<bool> owned {true};    released when the owning thread exits
+//   Shard* next {nullptr};             written once, before the shard is published
+template <typename Shard>
+inline std::atomic<Shard*> thread_shards {nullptr};
+
+// The events of threads that could not allocate a shard
+template <typename Shard>
+inline std::atomic<std::uint64_t> thread_shards_unrecorded {};
+
+template <typename Shard>
+auto acquire_thread_shard() noexcept -> Shard*
+{
+    for (auto* shard {thread_shards<Shard>.load(std::memory_order_acquire)}; shard != nullptr; shard = shard->next)
+    {
+        bool owned {false};
+        if (shard->owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+        {
+            return shard;
+        }
+    }
+
+    auto* shard {new (std::nothrow) Shard {}};
+    if (shard != nullptr)
+    {
+        shard->next = thread_shards<Shard>.load(std::memory_order_relaxed);
+        while (!thread_shards<Shard>.compare_exchange_weak(shard->next, shard, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    return shard;
+}
+
+// A plain pointer, so that reading it needs no check that a thread_local object has been constructed
+template <typename Shard>
+inline thread_local Shard* this_thread_shard {nullptr};
+
+template <typename Shard>
+inline thread_local bool this_thread_shard_released {false};
+
+template <typename Shard>
+struct thread_shard_owner
+{
+    Shard* shard {acquire_thread_shard<Shard>()};
+
+    thread_shard_owner() noexcept = default;
+    thread_shard_owner(const thread_shard_owner&) = delete;
+    auto operator=(const thread_shard_owner&) -> thread_shard_owner& = delete;
+
+    ~thread_shard_owner()
+    {
+        // Events counted by the destructors of other thread_local objects after this one are unrecorded
+        this_thread_shard<Shard> = nullptr;
+        this_thread_shard_released<Shard> = true;
+
+        if (shard != nullptr)
+        {
+            shard->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+// Acquires the shard of this thread on its first event, returning nullptr if there is none
+template <typename Shard>
+BOOST_SAFE_NUMBERS_COLD auto attach_thread_shard() noexcept -> Shard*
+{
+    if (this_thread_shard_released<Shard>)
+    {
+        return nullptr;
+    }
+
+    thread_local thread_shard_owner<Shard> owner {};
+    this_thread_shard<Shard> = owner.shard;
+
+    return owner.shard;
+}
+
+template <typename Shard>
+[[nodiscard]] inline auto thread_shard() noexcept -> Shard*
+{
+    auto* shard {this_thread_shard<Shard>};
+    if (shard == nullptr) [[unlikely]]
+    {
+        shard = attach_thread_shard<Shard>();
+    }
+
+    return shard;
+}
+
+// Only the thread that owns the shard writes its counters, and other threads only read them
+inline void increment_owned_counter(std::atomic<std::uint64_t>& counter) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
+} // namespace boost::safe_numbers::detail
+
+#endif // BOOST_SAFE_NUMBERS_DETAIL_THREAD_SHARDS_HPP
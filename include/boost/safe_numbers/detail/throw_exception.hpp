@@ -9,25 +9,150 @@
 #ifndef BOOST_SAFE_NUMBERS_THROW_EXCEPTION_HPP
 #define BOOST_SAFE_NUMBERS_THROW_EXCEPTION_HPP
 
+#include <boost/safe_numbers/detail/config.hpp>
 #include <boost/safe_numbers/cuda_error_reporting.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+#include <boost/safe_numbers/arithmetic_error.hpp>
+#include <boost/safe_numbers/detail/telemetry.hpp>
 
 #ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
 
 #include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <cstdlib>
 
 #endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
 
+// Errors found during constant evaluation throw so that the compiler reports the message.
+// Without exceptions the message is instead passed to a function that is not constexpr, which ends constant evaluation just the same.
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+
+#define BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(exc_type, msg) throw exc_type(msg)
+
+#else
+
+namespace boost::safe_numbers::detail {
+
+[[noreturn]] inline void constant_evaluation_failed(const char*) noexcept
+{
+    std::abort();
+}
+
+} // namespace boost::safe_numbers::detail
+
+#define BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(exc_type, msg) ::boost::safe_numbers::detail::constant_evaluation_failed(msg)
+
+#endif
+
 // Two-argument form: (exception_type, message)
-// On host: constructs and throws the exception with the message
+// Five-argument form for a single operation: (exception_type, message, arithmetic_op, lhs, rhs)
+// On host: passes the error to the overflow handlers, then throws basic_arithmetic_error<exception_type>
 // On CUDA device: passes the const char* message to the device error reporter
 #ifndef __CUDACC__
 
-#define BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg) BOOST_THROW_EXCEPTION(exc_type(msg))
+namespace boost::safe_numbers::detail {
+
+// Called with every error before it is reported: first the handler installed at runtime, if any,
+// then either the handler defined by the user with BOOST_SAFE_NUMBERS_ENABLE_OVERFLOW_HANDLER or boost::throw_exception.
+// The exception holds the description of the error inline rather than in a std::string.
+template <typename ExceptionType>
+[[noreturn]] BOOST_SAFE_NUMBERS_COLD void report_error(const overflow_info& info)
+{
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    record_telemetry(telemetry_key{info.location.file_name(), info.location.function_name(), info.location.line(), info.location.column(),
+                                   telemetry_event::error, info.op, info.type});
+
+    #endif
+
+    if (const auto handler {get_overflow_handler()}; handler != nullptr)
+    {
+        handler(info);
+    }
+
+    #ifdef BOOST_SAFE_NUMBERS_ENABLE_OVERFLOW_HANDLER
+
+    overflow_detected(info);
+    std::abort();
+
+    #else
+
+    boost::throw_exception(basic_arithmetic_error<ExceptionType>(info), info.location);
+
+    #endif
+}
+
+// Constructing and throwing an exception inline costs its constructor, destructor, and unwinding code at every operation.
+// These are instead out of line and cold, with one copy per exception type,
+// so that an operation only contains a predicted not taken call with the message and the source location.
+template <typename ExceptionType>
+[[noreturn]] BOOST_SAFE_NUMBERS_COLD void throw_exception_cold(const char* msg, const boost::source_location& loc)
+{
+    report_error<ExceptionType>(make_overflow_info(msg, loc));
+}
+
+template <typename ExceptionType, std::size_t Capacity>
+[[noreturn]] BOOST_SAFE_NUMBERS_COLD void throw_exception_cold(const message_buffer<Capacity>& msg, const boost::source_location& loc)
+{
+    report_error<ExceptionType>(make_overflow_info(msg.c_str(), loc));
+}
+
+// As above, but for errors of a single operation, whose operands are passed on to the handlers
+template <typename ExceptionType, typename T>
+[[noreturn]] BOOST_SAFE_NUMBERS_COLD void report_error_cold(const char* msg, const arithmetic_op op, const T lhs, const T rhs,
+                                                            const boost::source_location& loc)
+{
+    report_error<ExceptionType>(make_overflow_info(op, lhs, rhs, msg, loc));
+}
+
+template <typename ExceptionType, std::size_t Capacity, typename T>
+[[noreturn]] BOOST_SAFE_NUMBERS_COLD void report_error_cold(const message_buffer<Capacity>& msg, const arithmetic_op op, const T lhs, const T rhs,
+                                                            const boost::source_location& loc)
+{
+    report_error<ExceptionType>(make_overflow_info(op, lhs, rhs, msg.c_str(), loc));
+}
+
+} // namespace boost::safe_numbers::detail
+
+#define BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg) ::boost::safe_numbers::detail::throw_exception_cold<exc_type>(msg, BOOST_CURRENT_LOCATION)
+
+#define BOOST_SAFE_NUMBERS_REPORT_ERROR(exc_type, msg, op, lhs, rhs) ::boost::safe_numbers::detail::report_error_cold<exc_type>(msg, ::boost::safe_numbers::arithmetic_op::op, lhs, rhs, BOOST_CURRENT_LOCATION)
+
+#define BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(exc_type, msg, op, lhs, rhs) ::boost::safe_numbers::detail::report_error_cold<exc_type>(msg, ::boost::safe_numbers::arithmetic_op::op, lhs, rhs, BOOST_CURRENT_LOCATION)
+
+// As BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR, for code generic over the operation, which passes an arithmetic_op value rather than the name of one
+#define BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(exc_type, msg, op, lhs, rhs) ::boost::safe_numbers::detail::report_error_cold<exc_type>(msg, op, lhs, rhs, BOOST_CURRENT_LOCATION)
 
 #else
 
 #define BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg) boost::safe_numbers::detail::report_device_error(boost::safe_numbers::detail::to_exception_enum<exc_type>(), __FILE__, __LINE__, msg)
 
+#define BOOST_SAFE_NUMBERS_REPORT_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg)
+
+#define BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg)
+
+#define BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_THROW_EXCEPTION(exc_type, msg)
+
 #endif // __CUDACC__
 
+// BOOST_SAFE_NUMBERS_REPORT_ERROR reports the results of single operations that overflow, and BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR
+// the results of bounded types out of their range. With BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW the program promises that neither can happen,
+// and both become unreachable, so the compiler removes each check and may assume that the result is in range.
+// Errors in the arguments, such as a division by zero, a value out of the range of a bounded type, or mismatched span sizes,
+// and the errors of span operations are reported with BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR, BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR,
+// or BOOST_SAFE_NUMBERS_THROW_EXCEPTION whatever the mode.
+// Checks during constant evaluation do not use these macros, so an error there still fails to compile.
+#ifdef BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+#undef BOOST_SAFE_NUMBERS_REPORT_ERROR
+#define BOOST_SAFE_NUMBERS_REPORT_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_UNREACHABLE
+
+#define BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_UNREACHABLE
+
+#else
+
+#define BOOST_SAFE_NUMBERS_REPORT_RANGE_ERROR(exc_type, msg, op, lhs, rhs) BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(exc_type, msg, op, lhs, rhs)
+
+#endif // BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
 #endif // BOOST_SAFE_NUMBERS_THROW_EXCEPTION_HPP
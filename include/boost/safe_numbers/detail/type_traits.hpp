@@ -97,6 +97,15 @@ struct underlying<signed_integer_basis<T>>
 template <typename T>
 using underlying_type_t = typename impl::underlying<T>::type;
 
+// The type wrapping arithmetic is done in, so that types narrower than int are not promoted to int and overflow it
+
+namespace impl {
+
+template <fundamental_unsigned_integral T>
+using wrapping_promoted_t = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, T>;
+
+} // namespace impl
+
 // valid_bound concept
 
 template <typename T>
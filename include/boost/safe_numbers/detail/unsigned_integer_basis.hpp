@@ -8,8 +8,11 @@
 #include <boost/safe_numbers/detail/config.hpp>
 #include <boost/safe_numbers/detail/type_traits.hpp>
 #include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/detail/operation_profile.hpp>
 #include <boost/safe_numbers/detail/int128/bit.hpp>
 #include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/error_context.hpp>
+#include <boost/safe_numbers/expected.hpp>
 
 #ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
 
@@ -413,7 +416,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE constexpr unsigned_integer_basis<BasisType>::oper
     {
         if (basis_ > static_cast<BasisType>(std::numeric_limits<OtherBasis>::max()))
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, (overflow_conversion_msg<BasisType, OtherBasis>()));
+            BOOST_SAFE_NUMBERS_REPORT_ERROR(std::domain_error, (overflow_conversion_msg<BasisType, OtherBasis>()), conversion, basis_, BasisType{0U});
         }
     }
 
@@ -523,30 +526,30 @@ struct add_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType res {};
 
-        auto handle_overflow = [&res]
+        auto handle_overflow = [&]
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
             if (std::is_constant_evaluated())
             {
                 if constexpr (std::is_same_v<BasisType, std::uint8_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u8 addition");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u8 addition");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u16 addition");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u16 addition");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u32 addition");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u32 addition");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u64 addition");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u64 addition");
                 }
                 else
                 {
-                    throw std::overflow_error("Overflow detected in u128 addition");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u128 addition");
                 }
             }
             else
@@ -555,7 +558,7 @@ struct add_helper
                 if constexpr (Policy == overflow_policy::throw_exception)
                 {
                     static_cast<void>(res);
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, overflow_add_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, overflow_add_msg<BasisType>(), add, lhs_basis, rhs_basis);
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
                 {
@@ -682,7 +685,7 @@ struct add_helper<overflow_policy::widen, BasisType>
         static_assert(!std::is_same_v<promoted_type, bool>, "Widening policy with uint128_t is not supported");
 
         using result_type = unsigned_integer_basis<promoted_type>;
-        return result_type{static_cast<promoted_type>(static_cast<promoted_type>(lhs) + rhs)};
+        return result_type{static_cast<promoted_type>(static_cast<promoted_type>(lhs) + static_cast<promoted_type>(rhs))};
     }
 };
 
@@ -692,6 +695,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple || Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::widen)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, Policy, BasisType);
     return add_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -749,23 +753,23 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::uint8_t>)
             {
-                throw std::overflow_error("Overflow detected in u8 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u8 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
             {
-                throw std::overflow_error("Overflow detected in u16 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u16 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
             {
-                throw std::overflow_error("Overflow detected in u32 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u32 addition");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
             {
-                throw std::overflow_error("Overflow detected in u64 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u64 addition");
             }
             else
             {
-                throw std::overflow_error("Overflow detected in u128 addition");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u128 addition");
             }
         }
 
@@ -774,6 +778,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::throw_exception, BasisType);
     return add_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1031,7 +1036,7 @@ struct sub_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType res {};
 
-        auto handle_underflow = [&res]
+        auto handle_underflow = [&]
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
 
@@ -1039,23 +1044,23 @@ struct sub_helper
             {
                 if constexpr (std::is_same_v<BasisType, std::uint8_t>)
                 {
-                    throw std::underflow_error("Underflow detected in u8 subtraction");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u8 subtraction");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
                 {
-                    throw std::underflow_error("Underflow detected in u16 subtraction");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u16 subtraction");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
                 {
-                    throw std::underflow_error("Underflow detected in u32 subtraction");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u32 subtraction");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
                 {
-                    throw std::underflow_error("Underflow detected in u64 subtraction");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u64 subtraction");
                 }
                 else
                 {
-                    throw std::underflow_error("Underflow detected in u128 subtraction");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u128 subtraction");
                 }
             }
             else
@@ -1064,7 +1069,7 @@ struct sub_helper
                 if constexpr (Policy == overflow_policy::throw_exception)
                 {
                     static_cast<void>(res);
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, underflow_sub_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, underflow_sub_msg<BasisType>(), sub, lhs_basis, rhs_basis);
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
                 {
@@ -1181,6 +1186,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple || Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, Policy, BasisType);
     return sub_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1198,23 +1204,23 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::uint8_t>)
             {
-                throw std::underflow_error("Underflow detected in u8 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u8 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
             {
-                throw std::underflow_error("Underflow detected in u16 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u16 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
             {
-                throw std::underflow_error("Underflow detected in u32 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u32 subtraction");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
             {
-                throw std::underflow_error("Underflow detected in u64 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u64 subtraction");
             }
             else
             {
-                throw std::underflow_error("Underflow detected in u128 subtraction");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::underflow_error, "Underflow detected in u128 subtraction");
             }
         }
 
@@ -1223,6 +1229,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::throw_exception, BasisType);
     return sub_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1339,30 +1346,30 @@ struct mul_helper
         const auto rhs_basis {static_cast<BasisType>(rhs)};
         BasisType res {};
 
-        auto handle_overflow = [&res]
+        auto handle_overflow = [&]
         {
             #if !(defined(__CUDACC__) && defined(BOOST_SAFE_NUMBERS_ENABLE_CUDA))
             if (std::is_constant_evaluated())
             {
                 if constexpr (std::is_same_v<BasisType, std::uint8_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u8 multiplication");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u8 multiplication");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u16 multiplication");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u16 multiplication");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u32 multiplication");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u32 multiplication");
                 }
                 else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
                 {
-                    throw std::overflow_error("Overflow detected in u64 multiplication");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u64 multiplication");
                 }
                 else
                 {
-                    throw std::overflow_error("Overflow detected in u128 multiplication");
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u128 multiplication");
                 }
             }
             else
@@ -1371,7 +1378,7 @@ struct mul_helper
                 if constexpr (Policy == overflow_policy::throw_exception)
                 {
                     static_cast<void>(res);
-                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, overflow_mul_msg<BasisType>());
+                    BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, overflow_mul_msg<BasisType>(), mul, lhs_basis, rhs_basis);
                 }
                 else if constexpr (Policy == overflow_policy::saturate)
                 {
@@ -1494,7 +1501,7 @@ struct mul_helper<overflow_policy::widen, BasisType>
         static_assert(!std::is_same_v<promoted_type, bool>, "Widening policy with uint128_t is not supported");
 
         using result_type = unsigned_integer_basis<promoted_type>;
-        return result_type{static_cast<promoted_type>(static_cast<promoted_type>(lhs) * rhs)};
+        return result_type{static_cast<promoted_type>(static_cast<promoted_type>(lhs) * static_cast<promoted_type>(rhs))};
     }
 };
 
@@ -1504,6 +1511,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple || Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::widen)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, Policy, BasisType);
     return mul_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1521,23 +1529,23 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         {
             if constexpr (std::is_same_v<BasisType, std::uint8_t>)
             {
-                throw std::overflow_error("Overflow detected in u8 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u8 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
             {
-                throw std::overflow_error("Overflow detected in u16 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u16 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint32_t>)
             {
-                throw std::overflow_error("Overflow detected in u32 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u32 multiplication");
             }
             else if constexpr (std::is_same_v<BasisType, std::uint64_t>)
             {
-                throw std::overflow_error("Overflow detected in u64 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u64 multiplication");
             }
             else
             {
-                throw std::overflow_error("Overflow detected in u128 multiplication");
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in u128 multiplication");
             }
         }
 
@@ -1546,6 +1554,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::throw_exception, BasisType);
     return mul_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1581,11 +1590,11 @@ struct div_helper
         {
             if constexpr (Policy == overflow_policy::throw_exception)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, div_by_zero_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, div_by_zero_msg<BasisType>(), div, static_cast<BasisType>(lhs), static_cast<BasisType>(rhs));
             }
             else if constexpr (Policy == overflow_policy::saturate)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, div_by_zero_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, div_by_zero_msg<BasisType>(), div, static_cast<BasisType>(lhs), static_cast<BasisType>(rhs));
             }
             else if constexpr (Policy == overflow_policy::strict)
             {
@@ -1622,7 +1631,7 @@ struct div_helper<overflow_policy::overflow_tuple, BasisType>
         const auto divisor {static_cast<BasisType>(rhs)};
         if (divisor == 0U) [[unlikely]]
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, div_by_zero_msg<BasisType>());
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, div_by_zero_msg<BasisType>(), div, static_cast<BasisType>(lhs), divisor);
         }
 
         if constexpr (std::is_same_v<BasisType, std::uint8_t> || std::is_same_v<BasisType, std::uint16_t>)
@@ -1670,6 +1679,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, Policy, BasisType);
     return div_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1685,7 +1695,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         const auto divisor {static_cast<BasisType>(rhs)};
         if (divisor == 0U) [[unlikely]]
         {
-            throw std::domain_error("Unsigned division by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Unsigned division by zero");
         }
 
         if constexpr (std::is_same_v<BasisType, std::uint8_t> || std::is_same_v<BasisType, std::uint16_t>)
@@ -1700,6 +1710,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::throw_exception, BasisType);
     return div_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1735,11 +1746,11 @@ struct mod_helper
         {
             if constexpr (Policy == overflow_policy::throw_exception)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, mod_by_zero_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, mod_by_zero_msg<BasisType>(), mod, static_cast<BasisType>(lhs), static_cast<BasisType>(rhs));
             }
             else if constexpr (Policy == overflow_policy::saturate)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, mod_by_zero_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, mod_by_zero_msg<BasisType>(), mod, static_cast<BasisType>(lhs), static_cast<BasisType>(rhs));
             }
             else if constexpr (Policy == overflow_policy::strict)
             {
@@ -1776,7 +1787,7 @@ struct mod_helper<overflow_policy::overflow_tuple, BasisType>
         const auto divisor {static_cast<BasisType>(rhs)};
         if (divisor == 0U) [[unlikely]]
         {
-            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, div_by_zero_msg<BasisType>());
+            BOOST_SAFE_NUMBERS_REPORT_ARGUMENT_ERROR(std::domain_error, div_by_zero_msg<BasisType>(), mod, static_cast<BasisType>(lhs), divisor);
         }
 
         if constexpr (std::is_same_v<BasisType, std::uint8_t> || std::is_same_v<BasisType, std::uint16_t>)
@@ -1824,6 +1835,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, Policy, BasisType);
     return mod_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -1839,7 +1851,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
         const auto divisor {static_cast<BasisType>(rhs)};
         if (divisor == 0U) [[unlikely]]
         {
-            throw std::domain_error("Unsigned modulo by zero");
+            BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Unsigned modulo by zero");
         }
 
         if constexpr (std::is_same_v<BasisType, std::uint8_t> || std::is_same_v<BasisType, std::uint16_t>)
@@ -1854,6 +1866,7 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 
     #endif
 
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::throw_exception, BasisType);
     return mod_helper<overflow_policy::throw_exception, BasisType>::apply(lhs, rhs);
 }
 
@@ -1878,9 +1891,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto unsigned_integer_basis<BasisType>::operator++()
     -> unsigned_integer_basis&
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(inc, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::max()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, overflow_inc_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, overflow_inc_msg<BasisType>(), inc, this->basis_, BasisType{0U});
     }
 
     ++this->basis_;
@@ -1892,9 +1907,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto unsigned_integer_basis<BasisType>::operator++(int)
     -> unsigned_integer_basis
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(inc, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == std::numeric_limits<BasisType>::max()) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, overflow_inc_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, overflow_inc_msg<BasisType>(), inc, this->basis_, BasisType{0U});
     }
 
     const auto temp {*this};
@@ -1911,9 +1928,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto unsigned_integer_basis<BasisType>::operator--()
     -> unsigned_integer_basis&
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(dec, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == 0U) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, underflow_dec_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, underflow_dec_msg<BasisType>(), dec, this->basis_, BasisType{0U});
     }
 
     --this->basis_;
@@ -1925,9 +1944,11 @@ BOOST_SAFE_NUMBERS_HOST_DEVICE
 constexpr auto unsigned_integer_basis<BasisType>::operator--(int)
     -> unsigned_integer_basis
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(dec, overflow_policy::throw_exception, BasisType);
+
     if (this->basis_ == 0U) [[unlikely]]
     {
-        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, underflow_dec_msg<BasisType>());
+        BOOST_SAFE_NUMBERS_REPORT_ERROR(std::underflow_error, underflow_dec_msg<BasisType>(), dec, this->basis_, BasisType{0U});
     }
 
     const auto temp {*this};
@@ -1960,7 +1981,7 @@ struct shl_helper
         {
             if constexpr (Policy == overflow_policy::throw_exception)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, left_shift_overflow_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, left_shift_overflow_msg<BasisType>(), shl, raw_lhs, raw_rhs);
             }
             else if constexpr (Policy == overflow_policy::saturate)
             {
@@ -2031,6 +2052,7 @@ template <overflow_policy Policy, fundamental_unsigned_integral BasisType>
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple || Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shl, Policy, BasisType);
     return shl_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -2057,7 +2079,7 @@ struct shr_helper
         {
             if constexpr (Policy == overflow_policy::throw_exception)
             {
-                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, right_shift_overflow_msg<BasisType>());
+                BOOST_SAFE_NUMBERS_REPORT_ERROR(std::overflow_error, right_shift_overflow_msg<BasisType>(), shr, raw_lhs, raw_rhs);
             }
             else if constexpr (Policy == overflow_policy::saturate)
             {
@@ -2123,6 +2145,7 @@ template <overflow_policy Policy, fundamental_unsigned_integral BasisType>
                                       const unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy == overflow_policy::saturate || Policy == overflow_policy::overflow_tuple || Policy == overflow_policy::checked || Policy == overflow_policy::strict)
 {
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shr, Policy, BasisType);
     return shr_helper<Policy, BasisType>::apply(lhs, rhs);
 }
 
@@ -2134,152 +2157,263 @@ template <overflow_policy Policy, fundamental_unsigned_integral BasisType>
 
 namespace boost::safe_numbers {
 
+// With telemetry, the saturating operations are computed once with the overflow_tuple policy,
+// whose flag is both recorded and selects the bound that replaces the result
+
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_add(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::saturate, BasisType);
+    const auto res {detail::add_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, add, BasisType);
+
+    if (res.second)
+    {
+        return detail::unsigned_integer_basis<BasisType>{std::numeric_limits<BasisType>::max()};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::add_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating addition", saturating_add)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_sub(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::saturate, BasisType);
+    const auto res {detail::sub_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, sub, BasisType);
+
+    if (res.second)
+    {
+        return detail::unsigned_integer_basis<BasisType>{BasisType{0U}};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::sub_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating subtraction", saturating_sub)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_mul(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::saturate, BasisType);
+    const auto res {detail::mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, mul, BasisType);
+
+    if (res.second)
+    {
+        return detail::unsigned_integer_basis<BasisType>{std::numeric_limits<BasisType>::max()};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::mul_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating multiplication", saturating_mul)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_div(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs)
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::saturate, BasisType);
+    const auto res {detail::div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, div, BasisType);
+    return res.first;
+
+    #else
+
     return detail::div_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating division", saturating_div)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_mod(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs)
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::saturate, BasisType);
+    const auto res {detail::mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, mod, BasisType);
+    return res.first;
+
+    #else
+
     return detail::mod_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating modulo", saturating_mod)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_add(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::add_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::add_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, add, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing addition", overflowing_add)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_sub(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::sub_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::sub_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, sub, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing subtraction", overflowing_sub)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_mul(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::mul_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::mul_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, mul, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing multiplication", overflowing_mul)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_div(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs)
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::div_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::div_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, div, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing division", overflowing_div)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_mod(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs)
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::mod_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::mod_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, mod, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing modulo", overflowing_mod)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_add(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::add_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::add_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, add, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked addition", checked_add)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_sub(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::sub_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::sub_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, sub, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked subtraction", checked_sub)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_mul(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::mul_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::mul_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, mul, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked multiplication", checked_mul)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_div(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::div_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::div_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, div, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked division", checked_div)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_mod(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::mod_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::mod_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, mod, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked modulo", checked_mod)
@@ -2352,26 +2486,354 @@ template <detail::fundamental_unsigned_integral BasisType>
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("widening mul", widening_mul)
 
+// ------------------------------
+// Sticky Math
+// ------------------------------
+
+// The sticky functions return the wrapped result as the overflowing functions do,
+// and OR the overflow flag into context, or into thread_error_context() when no context is passed
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_add(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::sticky, BasisType);
+
+    // Unlike the overflow builtins, the portable test vectorizes when called in a loop
+    BasisType res {};
+    context.record(detail::impl::unsigned_no_intrin_add(static_cast<BasisType>(lhs), static_cast<BasisType>(rhs), res));
+    return detail::unsigned_integer_basis<BasisType>{res};
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_add(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_add(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky addition", sticky_add)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_sub(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::sticky, BasisType);
+
+    // Unlike the overflow builtins, the portable test vectorizes when called in a loop
+    BasisType res {};
+    context.record(detail::impl::unsigned_no_intrin_sub(static_cast<BasisType>(lhs), static_cast<BasisType>(rhs), res));
+    return detail::unsigned_integer_basis<BasisType>{res};
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_sub(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_sub(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky subtraction", sticky_sub)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_mul(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_mul(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_mul(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky multiplication", sticky_mul)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_div(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_div(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_div(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky division", sticky_div)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_mod(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_mod(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_mod(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky modulo", sticky_mod)
+
+// ------------------------------
+// Wrapping Math
+// ------------------------------
+
+// Modular arithmetic, returning the same value as the overflowing functions without computing the flag
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_add(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::wrap, BasisType);
+
+    using promoted_type = detail::impl::wrapping_promoted_t<BasisType>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) + static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::unsigned_integer_basis<BasisType>{static_cast<BasisType>(res)};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping addition", wrapping_add)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_sub(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::wrap, BasisType);
+
+    using promoted_type = detail::impl::wrapping_promoted_t<BasisType>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) - static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::unsigned_integer_basis<BasisType>{static_cast<BasisType>(res)};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping subtraction", wrapping_sub)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_mul(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::wrap, BasisType);
+
+    using promoted_type = detail::impl::wrapping_promoted_t<BasisType>;
+    const auto res {static_cast<promoted_type>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) * static_cast<promoted_type>(static_cast<BasisType>(rhs)))};
+    return detail::unsigned_integer_basis<BasisType>{static_cast<BasisType>(res)};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping multiplication", wrapping_mul)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_div(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::wrap, BasisType);
+
+    return detail::div_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs).first;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping division", wrapping_div)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_mod(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs)
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::wrap, BasisType);
+
+    return detail::mod_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs).first;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping modulo", wrapping_mod)
+
+// ------------------------------
+// Expected Math
+// ------------------------------
+
+// The expected functions return the result, or why the operation failed, without throwing
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_add(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(add, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::add_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected addition", expected_add)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_sub(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(sub, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::sub_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::underflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected subtraction", expected_sub)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_mul(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mul, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::mul_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected multiplication", expected_mul)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_div(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(div, overflow_policy::expected, BasisType);
+
+    const auto res {detail::div_helper<overflow_policy::checked, BasisType>::apply(lhs, rhs)};
+    if (!res.has_value()) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::division_by_zero);
+    }
+
+    return *res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected division", expected_div)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_mod(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(mod, overflow_policy::expected, BasisType);
+
+    const auto res {detail::mod_helper<overflow_policy::checked, BasisType>::apply(lhs, rhs)};
+    if (!res.has_value()) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::division_by_zero);
+    }
+
+    return *res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected modulo", expected_mod)
+
 // ------------------------------
 // Saturating Shift
 // ------------------------------
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_shl(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shl, overflow_policy::saturate, BasisType);
+    const auto res {detail::shl_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, shl, BasisType);
+
+    if (res.second)
+    {
+        return detail::unsigned_integer_basis<BasisType>{std::numeric_limits<BasisType>::max()};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::shl_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating left shift", saturating_shl)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto saturating_shr(const detail::unsigned_integer_basis<BasisType> lhs,
-                                            const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                            const detail::unsigned_integer_basis<BasisType> rhs
+                                            BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> detail::unsigned_integer_basis<BasisType>
 {
+    #ifdef BOOST_SAFE_NUMBERS_HAS_TELEMETRY
+
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shr, overflow_policy::saturate, BasisType);
+    const auto res {detail::shr_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, saturated, shr, BasisType);
+
+    if (res.second)
+    {
+        return detail::unsigned_integer_basis<BasisType>{BasisType{0U}};
+    }
+
+    return res.first;
+
+    #else
+
     return detail::shr_impl<overflow_policy::saturate>(lhs, rhs);
+
+    #endif
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating right shift", saturating_shr)
@@ -2382,20 +2844,26 @@ BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("saturating right shift", sa
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_shl(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::shl_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::shl_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, shl, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing left shift", overflowing_shl)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto overflowing_shr(const detail::unsigned_integer_basis<BasisType> lhs,
-                                             const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                             const detail::unsigned_integer_basis<BasisType> rhs
+                                             BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::pair<detail::unsigned_integer_basis<BasisType>, bool>
 {
-    return detail::shr_impl<overflow_policy::overflow_tuple>(lhs, rhs);
+    const auto res {detail::shr_impl<overflow_policy::overflow_tuple>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(res.second, overflowed, shr, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing right shift", overflowing_shr)
@@ -2406,20 +2874,26 @@ BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("overflowing right shift", o
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_shl(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::shl_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::shl_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, shl, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked left shift", checked_shl)
 
 template <detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto checked_shr(const detail::unsigned_integer_basis<BasisType> lhs,
-                                         const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+                                         const detail::unsigned_integer_basis<BasisType> rhs
+                                         BOOST_SAFE_NUMBERS_TELEMETRY_SITE) noexcept
     -> std::optional<detail::unsigned_integer_basis<BasisType>>
 {
-    return detail::shr_impl<overflow_policy::checked>(lhs, rhs);
+    const auto res {detail::shr_impl<overflow_policy::checked>(lhs, rhs)};
+    BOOST_SAFE_NUMBERS_TELEMETRY_RECORD_IF(!res.has_value(), check_failed, shr, BasisType);
+    return res;
 }
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("checked right shift", checked_shr)
@@ -2448,13 +2922,154 @@ template <detail::fundamental_unsigned_integral BasisType>
 
 BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("strict right shift", strict_shr)
 
+// ------------------------------
+// Sticky Shift
+// ------------------------------
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_shl(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shl, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::shl_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_shl(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_shl(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky left shift", sticky_shl)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto sticky_shr(const detail::unsigned_integer_basis<BasisType> lhs,
+                                        const detail::unsigned_integer_basis<BasisType> rhs,
+                                        error_context& context) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shr, overflow_policy::sticky, BasisType);
+
+    const auto [res, overflowed] {detail::shr_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    context.record(overflowed);
+    return res;
+}
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] auto sticky_shr(const detail::unsigned_integer_basis<BasisType> lhs,
+                              const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    return sticky_shr(lhs, rhs, thread_error_context());
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("sticky right shift", sticky_shr)
+
+// ------------------------------
+// Wrapping Shift
+// ------------------------------
+
+// Shifting by the type width or more clears every bit, as for overflowing_shl and overflowing_shr.
+// The amount is masked first so that the shift itself is always defined, and the result is then selected without a branch.
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_shl(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shl, overflow_policy::wrap, BasisType);
+
+    using promoted_type = detail::impl::wrapping_promoted_t<BasisType>;
+    constexpr auto digits {static_cast<BasisType>(std::numeric_limits<BasisType>::digits)};
+
+    const auto raw_rhs {static_cast<BasisType>(rhs)};
+    const auto amount {static_cast<BasisType>(raw_rhs & static_cast<BasisType>(digits - 1U))};
+    const auto res {static_cast<BasisType>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) << amount)};
+
+    return detail::unsigned_integer_basis<BasisType>{raw_rhs >= digits ? BasisType{0U} : res};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping left shift", wrapping_shl)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto wrapping_shr(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> detail::unsigned_integer_basis<BasisType>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shr, overflow_policy::wrap, BasisType);
+
+    using promoted_type = detail::impl::wrapping_promoted_t<BasisType>;
+    constexpr auto digits {static_cast<BasisType>(std::numeric_limits<BasisType>::digits)};
+
+    const auto raw_rhs {static_cast<BasisType>(rhs)};
+    const auto amount {static_cast<BasisType>(raw_rhs & static_cast<BasisType>(digits - 1U))};
+    const auto res {static_cast<BasisType>(static_cast<promoted_type>(static_cast<BasisType>(lhs)) >> amount)};
+
+    return detail::unsigned_integer_basis<BasisType>{raw_rhs >= digits ? BasisType{0U} : res};
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("wrapping right shift", wrapping_shr)
+
+// ------------------------------
+// Expected Shift
+// ------------------------------
+
+// Shifting by the type width or more is an invalid shift, and shifting set bits out of the left is an overflow
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_shl(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shl, overflow_policy::expected, BasisType);
+
+    constexpr auto digits {static_cast<BasisType>(std::numeric_limits<BasisType>::digits)};
+
+    const auto [res, overflowed] {detail::shl_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(
+            static_cast<BasisType>(rhs) >= digits ? arithmetic_errc::invalid_shift : arithmetic_errc::overflow);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected left shift", expected_shl)
+
+template <detail::fundamental_unsigned_integral BasisType>
+[[nodiscard]] constexpr auto expected_shr(const detail::unsigned_integer_basis<BasisType> lhs,
+                                          const detail::unsigned_integer_basis<BasisType> rhs) noexcept
+    -> arithmetic_expected<detail::unsigned_integer_basis<BasisType>>
+{
+    BOOST_SAFE_NUMBERS_PROFILE_OPERATION(shr, overflow_policy::expected, BasisType);
+
+    const auto [res, overflowed] {detail::shr_helper<overflow_policy::overflow_tuple, BasisType>::apply(lhs, rhs)};
+    if (overflowed) [[unlikely]]
+    {
+        return detail::make_arithmetic_error<detail::unsigned_integer_basis<BasisType>>(arithmetic_errc::invalid_shift);
+    }
+
+    return res;
+}
+
+BOOST_SAFE_NUMBERS_DEFINE_MIXED_UNSIGNED_INTEGER_OP("expected right shift", expected_shr)
+
 // ------------------------------
 // Generic policy-parameterized functions
 // ------------------------------
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto add(const detail::unsigned_integer_basis<BasisType> lhs,
-                                 const detail::unsigned_integer_basis<BasisType> rhs)
+                                 const detail::unsigned_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2463,15 +3078,15 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_add(lhs, rhs);
+        return saturating_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_add(lhs, rhs);
+        return overflowing_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_add(lhs, rhs);
+        return checked_add(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
@@ -2481,6 +3096,18 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     {
         return widening_add(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_add(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_add(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_add(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for addition");
@@ -2489,7 +3116,8 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto sub(const detail::unsigned_integer_basis<BasisType> lhs,
-                                 const detail::unsigned_integer_basis<BasisType> rhs)
+                                 const detail::unsigned_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2498,20 +3126,32 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_sub(lhs, rhs);
+        return saturating_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_sub(lhs, rhs);
+        return overflowing_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_sub(lhs, rhs);
+        return checked_sub(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_sub(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_sub(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_sub(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_sub(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for subtraction");
@@ -2520,7 +3160,8 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto mul(const detail::unsigned_integer_basis<BasisType> lhs,
-                                 const detail::unsigned_integer_basis<BasisType> rhs)
+                                 const detail::unsigned_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
     noexcept(Policy != overflow_policy::throw_exception)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
@@ -2529,15 +3170,15 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_mul(lhs, rhs);
+        return saturating_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_mul(lhs, rhs);
+        return overflowing_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_mul(lhs, rhs);
+        return checked_mul(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
@@ -2547,6 +3188,18 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     {
         return widening_mul(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_mul(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_mul(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_mul(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for multiplication");
@@ -2555,8 +3208,9 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto div(const detail::unsigned_integer_basis<BasisType> lhs,
-                                 const detail::unsigned_integer_basis<BasisType> rhs)
-    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+                                 const detail::unsigned_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::expected)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
     {
@@ -2564,20 +3218,32 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_div(lhs, rhs);
+        return saturating_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_div(lhs, rhs);
+        return overflowing_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_div(lhs, rhs);
+        return checked_div(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_div(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_div(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_div(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_div(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for division");
@@ -2586,8 +3252,9 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
 [[nodiscard]] constexpr auto mod(const detail::unsigned_integer_basis<BasisType> lhs,
-                                 const detail::unsigned_integer_basis<BasisType> rhs)
-    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+                                 const detail::unsigned_integer_basis<BasisType> rhs
+                                 BOOST_SAFE_NUMBERS_TELEMETRY_SITE)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict || Policy == overflow_policy::expected)
 {
     if constexpr (Policy == overflow_policy::throw_exception)
     {
@@ -2595,20 +3262,32 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
     }
     else if constexpr (Policy == overflow_policy::saturate)
     {
-        return saturating_mod(lhs, rhs);
+        return saturating_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::overflow_tuple)
     {
-        return overflowing_mod(lhs, rhs);
+        return overflowing_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::checked)
     {
-        return checked_mod(lhs, rhs);
+        return checked_mod(lhs, rhs BOOST_SAFE_NUMBERS_TELEMETRY_PASS_SITE);
     }
     else if constexpr (Policy == overflow_policy::strict)
     {
         return strict_mod(lhs, rhs);
     }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_mod(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_mod(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_mod(lhs, rhs);
+    }
     else
     {
         static_assert(detail::dependent_false<BasisType>, "Policy is not supported for modulo");
@@ -2620,7 +3299,22 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
                                  const detail::unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy != overflow_policy::throw_exception)
 {
-    return detail::shl_impl<Policy>(lhs, rhs);
+    if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_shl(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_shl(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_shl(lhs, rhs);
+    }
+    else
+    {
+        return detail::shl_impl<Policy>(lhs, rhs);
+    }
 }
 
 template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisType>
@@ -2628,7 +3322,22 @@ template <overflow_policy Policy, detail::fundamental_unsigned_integral BasisTyp
                                  const detail::unsigned_integer_basis<BasisType> rhs)
     noexcept(Policy != overflow_policy::throw_exception)
 {
-    return detail::shr_impl<Policy>(lhs, rhs);
+    if constexpr (Policy == overflow_policy::sticky)
+    {
+        return sticky_shr(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::wrap)
+    {
+        return wrapping_shr(lhs, rhs);
+    }
+    else if constexpr (Policy == overflow_policy::expected)
+    {
+        return expected_shr(lhs, rhs);
+    }
+    else
+    {
+        return detail::shr_impl<Policy>(lhs, rhs);
+    }
 }
 
 template <detail::fundamental_unsigned_integral BasisType>
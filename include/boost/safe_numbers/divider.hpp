@@ -0,0 +1,535 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_DIVIDER_HPP
+#define BOOST_SAFE_NUMBERS_DIVIDER_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/error_context.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail::impl {
+
+// Computes floor(high * 2^digits / divisor) for high < divisor, which always fits in the lane type.
+// This is only evaluated once per divider, so the 128-bit case uses a plain shift-subtract loop.
+template <typename LaneType>
+[[nodiscard]] constexpr auto divider_wide_div(const LaneType high, const LaneType divisor) noexcept -> LaneType
+{
+    constexpr auto digits {std::numeric_limits<LaneType>::digits};
+
+    if constexpr (digits <= 32)
+    {
+        return static_cast<LaneType>((static_cast<std::uint64_t>(high) << digits) / static_cast<std::uint64_t>(divisor));
+    }
+    else if constexpr (digits == 64)
+    {
+        return static_cast<LaneType>(int128::uint128_t{high, 0U} / int128::uint128_t{divisor});
+    }
+    else
+    {
+        // The remainder stays below the divisor, so only the bit shifted out of its top needs tracking
+        LaneType quotient {};
+        LaneType remainder {high};
+
+        for (int i {}; i < digits; ++i)
+        {
+            const auto carry {(remainder >> (digits - 1)) != 0U};
+            remainder <<= 1;
+            quotient <<= 1;
+
+            if (carry || remainder >= divisor)
+            {
+                remainder -= divisor;
+                quotient |= 1U;
+            }
+        }
+
+        return quotient;
+    }
+}
+
+// The high half of the full product of two lanes.
+// 8, 16, and 32-bit lanes use a widening multiply, which vectorizes (e.g. pmulhuw, pmuludq).
+template <typename LaneType>
+[[nodiscard]] constexpr auto divider_mulhi(const LaneType lhs, const LaneType rhs) noexcept -> LaneType
+{
+    constexpr auto digits {std::numeric_limits<LaneType>::digits};
+
+    if constexpr (digits <= 16)
+    {
+        return static_cast<LaneType>((static_cast<std::uint32_t>(lhs) * static_cast<std::uint32_t>(rhs)) >> digits);
+    }
+    else if constexpr (digits == 32)
+    {
+        return static_cast<LaneType>((static_cast<std::uint64_t>(lhs) * static_cast<std::uint64_t>(rhs)) >> digits);
+    }
+    else if constexpr (digits == 64)
+    {
+        return (int128::uint128_t{lhs} * int128::uint128_t{rhs}).high;
+    }
+    else
+    {
+        // Schoolbook multiplication of the 64-bit halves, keeping only the carries into the high half
+        const auto low_low {int128::uint128_t{lhs.low} * int128::uint128_t{rhs.low}};
+        const auto low_high {int128::uint128_t{lhs.low} * int128::uint128_t{rhs.high}};
+        const auto high_low {int128::uint128_t{lhs.high} * int128::uint128_t{rhs.low}};
+        const auto high_high {int128::uint128_t{lhs.high} * int128::uint128_t{rhs.high}};
+
+        const auto middle {int128::uint128_t{low_low.high} + int128::uint128_t{low_high.low} + int128::uint128_t{high_low.low}};
+
+        return high_high + int128::uint128_t{low_high.high} + int128::uint128_t{high_low.high} + int128::uint128_t{middle.high};
+    }
+}
+
+// Wrapping lane multiplication, promoting 8 and 16-bit lanes to unsigned int
+// so that the product can not overflow a signed int
+template <typename LaneType>
+[[nodiscard]] constexpr auto divider_lane_mul(const LaneType lhs, const LaneType rhs) noexcept -> LaneType
+{
+    if constexpr (sizeof(LaneType) < sizeof(std::uint32_t))
+    {
+        return static_cast<LaneType>(static_cast<std::uint32_t>(lhs) * static_cast<std::uint32_t>(rhs));
+    }
+    else
+    {
+        return static_cast<LaneType>(lhs * rhs);
+    }
+}
+
+// The precomputed reciprocal of a non-zero divisor (Granlund and Montgomery, "Division by Invariant Integers using Multiplication").
+// With l = ceil(log2(d)) and the multiplier m = floor(2^N * (2^l - d) / d) + 1, which fits in N bits,
+// the quotient of any N-bit x is (t + ((x - t) >> min(l, 1))) >> max(l - 1, 0) where t is the high half of m * x.
+// Signed division divides the magnitudes and then applies the sign, so it shares the unsigned reciprocal.
+template <typename BasisType>
+struct divider_magic
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    static constexpr auto digits {std::numeric_limits<lane_type>::digits};
+    static constexpr auto is_signed {is_fundamental_signed_integral_v<BasisType>};
+
+    lane_type multiplier {};
+    int pre_shift {};
+    int post_shift {};
+
+    // The divisor as a lane, needed for the remainder
+    lane_type divisor {};
+
+    // All ones if the divisor is negative, and zero otherwise
+    lane_type divisor_sign {};
+
+    // All ones if the divisor is -1, which is the only divisor that can overflow
+    lane_type minus_one {};
+
+    // All ones if the lane is negative as a BasisType, and zero otherwise
+    [[nodiscard]] static constexpr auto sign_mask(const lane_type lane) noexcept -> lane_type
+    {
+        return static_cast<lane_type>(lane_type{0} - static_cast<lane_type>(lane >> (digits - 1)));
+    }
+
+    // Requires a non-zero divisor
+    explicit constexpr divider_magic(const BasisType value) noexcept : divisor {static_cast<lane_type>(value)}
+    {
+        auto magnitude {divisor};
+
+        if constexpr (is_signed)
+        {
+            divisor_sign = sign_mask(divisor);
+            magnitude = static_cast<lane_type>(static_cast<lane_type>(divisor ^ divisor_sign) - divisor_sign);
+            minus_one = span_lane_mask<BasisType>(divisor == std::numeric_limits<lane_type>::max());
+        }
+
+        int log {};
+        if (magnitude != 1U)
+        {
+            if constexpr (digits == 128)
+            {
+                log = digits - int128::countl_zero(static_cast<lane_type>(magnitude - 1U));
+            }
+            else
+            {
+                log = digits - std::countl_zero(static_cast<lane_type>(magnitude - 1U));
+            }
+        }
+
+        // 2^l - d, where 2^l itself does not fit in the lane type when l == N
+        const auto high {log == digits ? static_cast<lane_type>(lane_type{0} - magnitude) :
+                                         static_cast<lane_type>(static_cast<lane_type>(lane_type{1} << log) - magnitude)};
+
+        multiplier = static_cast<lane_type>(divider_wide_div(high, magnitude) + 1U);
+        pre_shift = log < 1 ? log : 1;
+        post_shift = log - pre_shift;
+    }
+
+    [[nodiscard]] constexpr auto unsigned_quotient(const lane_type numerator) const noexcept -> lane_type
+    {
+        const auto high {divider_mulhi(multiplier, numerator)};
+        const auto half_difference {static_cast<lane_type>(static_cast<lane_type>(numerator - high) >> pre_shift)};
+        return static_cast<lane_type>(static_cast<lane_type>(high + half_difference) >> post_shift);
+    }
+
+    // The wrapped quotient, which differs from the exact quotient only for min / -1
+    [[nodiscard]] constexpr auto quotient(const lane_type numerator) const noexcept -> lane_type
+    {
+        if constexpr (is_signed)
+        {
+            const auto numerator_sign {sign_mask(numerator)};
+            const auto magnitude {static_cast<lane_type>(static_cast<lane_type>(numerator ^ numerator_sign) - numerator_sign)};
+            const auto quotient_sign {static_cast<lane_type>(numerator_sign ^ divisor_sign)};
+            return static_cast<lane_type>(static_cast<lane_type>(unsigned_quotient(magnitude) ^ quotient_sign) - quotient_sign);
+        }
+        else
+        {
+            return unsigned_quotient(numerator);
+        }
+    }
+
+    // The remainder, which has the sign of the numerator as for the built-in operator
+    [[nodiscard]] constexpr auto remainder(const lane_type numerator) const noexcept -> lane_type
+    {
+        return static_cast<lane_type>(numerator - divider_lane_mul(quotient(numerator), divisor));
+    }
+
+    // All ones if dividing numerator overflows (min / -1), and zero otherwise
+    [[nodiscard]] constexpr auto overflow_mask(const lane_type numerator) const noexcept -> lane_type
+    {
+        if constexpr (is_signed)
+        {
+            constexpr auto min_lane {static_cast<lane_type>(lane_type{1} << (digits - 1))};
+            return static_cast<lane_type>(minus_one & span_lane_mask<BasisType>(numerator == min_lane));
+        }
+        else
+        {
+            static_cast<void>(numerator);
+            return lane_type{0};
+        }
+    }
+};
+
+// Grants the span functions access to the reciprocal of a divider
+struct divider_access;
+
+} // namespace boost::safe_numbers::detail::impl
+
+namespace boost::safe_numbers {
+
+// A divisor that is validated once, and whose reciprocal is precomputed
+// so that each division or modulo by it is a multiply and a few shifts instead of a hardware divide
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T>
+class divider
+{
+public:
+
+    using value_type = T;
+
+private:
+
+    using basis_type = detail::underlying_type_t<T>;
+
+    friend struct detail::impl::divider_access;
+
+    T divisor_;
+    detail::impl::divider_magic<basis_type> magic_;
+
+    static constexpr auto validate(const T divisor) -> basis_type
+    {
+        const auto basis {static_cast<basis_type>(divisor)};
+
+        if (basis == basis_type{0})
+        {
+            if (std::is_constant_evaluated())
+            {
+                if constexpr (detail::is_fundamental_unsigned_integral_v<basis_type>)
+                {
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, detail::div_by_zero_msg<basis_type>());
+                }
+                else
+                {
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, detail::impl::signed_div_by_zero_msg<basis_type>());
+                }
+            }
+            else
+            {
+                if constexpr (detail::is_fundamental_unsigned_integral_v<basis_type>)
+                {
+                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, detail::div_by_zero_msg<basis_type>());
+                }
+                else
+                {
+                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, detail::impl::signed_div_by_zero_msg<basis_type>());
+                }
+            }
+        }
+
+        return basis;
+    }
+
+    template <bool IsDivision>
+    static constexpr auto throw_overflow() -> void
+    {
+        if constexpr (detail::is_fundamental_signed_integral_v<basis_type>)
+        {
+            constexpr auto msg {IsDivision ? detail::impl::signed_overflow_div_msg<basis_type>() :
+                                             detail::impl::signed_overflow_mod_msg<basis_type>()};
+
+            if (std::is_constant_evaluated())
+            {
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, msg);
+            }
+            else
+            {
+                // The only quotient that overflows is min / -1
+                BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, msg, IsDivision ? arithmetic_op::div : arithmetic_op::mod,
+                                                          std::numeric_limits<basis_type>::min(), static_cast<basis_type>(-1));
+            }
+        }
+    }
+
+public:
+
+    // Throws std::domain_error if divisor is zero, with the same message as the division operator
+    explicit constexpr divider(const T divisor) : divisor_ {divisor}, magic_ {validate(divisor)} {}
+
+    [[nodiscard]] constexpr auto divisor() const noexcept -> T { return divisor_; }
+
+    // Equivalent to lhs / rhs.divisor(), including the std::overflow_error thrown for min / -1
+    [[nodiscard]] friend constexpr auto operator/(const T lhs, const divider& rhs) -> T
+    {
+        const auto lane {static_cast<detail::impl::span_lane_t<basis_type>>(static_cast<basis_type>(lhs))};
+
+        if (rhs.magic_.overflow_mask(lane) != 0U) [[unlikely]]
+        {
+            throw_overflow<true>();
+        }
+
+        return T{static_cast<basis_type>(rhs.magic_.quotient(lane))};
+    }
+
+    // Equivalent to lhs % rhs.divisor(), including the std::overflow_error thrown for min % -1
+    [[nodiscard]] friend constexpr auto operator%(const T lhs, const divider& rhs) -> T
+    {
+        const auto lane {static_cast<detail::impl::span_lane_t<basis_type>>(static_cast<basis_type>(lhs))};
+
+        if (rhs.magic_.overflow_mask(lane) != 0U) [[unlikely]]
+        {
+            throw_overflow<false>();
+        }
+
+        return T{static_cast<basis_type>(rhs.magic_.remainder(lane))};
+    }
+};
+
+} // namespace boost::safe_numbers
+
+namespace boost::safe_numbers::detail::impl {
+
+struct divider_access
+{
+    template <typename T>
+    [[nodiscard]] static constexpr auto magic(const divider<T>& rhs) noexcept -> const divider_magic<underlying_type_t<T>>&
+    {
+        return rhs.magic_;
+    }
+};
+
+enum class divider_op
+{
+    div,
+    mod
+};
+
+// Processes the whole span without any branch in the loop body, in the same way as span_kernel.
+// Only signed division by -1 can overflow, so the return value is always false for unsigned types.
+template <divider_op Op, overflow_policy Policy, typename T>
+[[nodiscard]] constexpr auto span_divider_kernel(const std::span<const T> lhs,
+                                                 const divider_magic<underlying_type_t<T>>& rhs,
+                                                 const std::span<T> result) noexcept -> bool
+{
+    using basis_type = underlying_type_t<T>;
+    using lane_type = span_lane_t<basis_type>;
+
+    // A local copy, since the compiler can not otherwise prove that the stores to result do not modify it
+    const auto magic {rhs};
+    lane_type overflow_reduction {};
+
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        const auto lane {static_cast<lane_type>(static_cast<basis_type>(lhs[i]))};
+
+        auto res {Op == divider_op::div ? magic.quotient(lane) : magic.remainder(lane)};
+
+        if constexpr (is_fundamental_signed_integral_v<basis_type>)
+        {
+            const auto overflow_mask {magic.overflow_mask(lane)};
+
+            // min % -1 already wraps to 0, which is also the saturated value
+            if constexpr (Policy == overflow_policy::saturate && Op == divider_op::div)
+            {
+                constexpr auto max_lane {static_cast<lane_type>(std::numeric_limits<basis_type>::max())};
+                res = static_cast<lane_type>((res & static_cast<lane_type>(~overflow_mask)) | (max_lane & overflow_mask));
+            }
+
+            overflow_reduction |= overflow_mask;
+        }
+
+        result[i] = T{static_cast<basis_type>(res)};
+    }
+
+    return overflow_reduction != lane_type{0};
+}
+
+template <divider_op Op, overflow_policy Policy, typename T>
+constexpr auto span_divider_impl(const std::span<const T> lhs,
+                                 const divider<T>& rhs,
+                                 const std::span<T> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    using basis_type = underlying_type_t<T>;
+
+    static_assert(Policy == overflow_policy::throw_exception ||
+                  Policy == overflow_policy::saturate ||
+                  Policy == overflow_policy::checked ||
+                  Policy == overflow_policy::strict ||
+                  Policy == overflow_policy::sticky ||
+                  Policy == overflow_policy::wrap,
+                  "Policy is not supported for span division");
+
+    if (lhs.size() != result.size())
+    {
+        if constexpr (Policy == overflow_policy::checked)
+        {
+            return false;
+        }
+        else if constexpr (Policy == overflow_policy::strict)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+        else
+        {
+            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Span division requires lhs and result to have the same size");
+        }
+    }
+
+    const auto overflowed {span_divider_kernel<Op, Policy>(lhs, divider_access::magic(rhs), result)};
+
+    if constexpr (Policy == overflow_policy::throw_exception)
+    {
+        if constexpr (is_fundamental_signed_integral_v<basis_type>)
+        {
+            if (overflowed)
+            {
+                constexpr auto msg {Op == divider_op::div ? signed_overflow_div_msg<basis_type>() : signed_overflow_mod_msg<basis_type>()};
+                constexpr auto op {Op == divider_op::div ? arithmetic_op::div : arithmetic_op::mod};
+
+                // The divisor is -1, so the offending elements are the ones equal to min
+                constexpr auto min_val {std::numeric_limits<basis_type>::min()};
+                constexpr auto minus_one {static_cast<basis_type>(-1)};
+
+                if (std::is_constant_evaluated())
+                {
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, msg);
+                }
+                else if (span_operand_aliases(lhs, result))
+                {
+                    // The result overlaps lhs so the inputs needed to find the index may be gone
+                    BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, msg, op, min_val, minus_one);
+                }
+
+                for (std::size_t i {}; i < lhs.size(); ++i)
+                {
+                    if (static_cast<basis_type>(lhs[i]) == min_val)
+                    {
+                        BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, append_span_index(msg, i), op, min_val, minus_one);
+                    }
+                }
+
+                BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, msg, op, min_val, minus_one);
+            }
+        }
+        else
+        {
+            static_cast<void>(overflowed);
+        }
+    }
+    else if constexpr (Policy == overflow_policy::strict)
+    {
+        if (overflowed)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    else if constexpr (Policy == overflow_policy::checked)
+    {
+        return !overflowed;
+    }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        // The whole span is recorded with a single access to the thread local context
+        if (std::is_constant_evaluated())
+        {
+            if constexpr (is_fundamental_signed_integral_v<basis_type>)
+            {
+                if (overflowed)
+                {
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, Op == divider_op::div ? signed_overflow_div_msg<basis_type>() : signed_overflow_mod_msg<basis_type>());
+                }
+            }
+        }
+        else
+        {
+            thread_error_context().record(overflowed);
+        }
+    }
+    else
+    {
+        static_cast<void>(overflowed);
+    }
+}
+
+} // namespace boost::safe_numbers::detail::impl
+
+namespace boost::safe_numbers {
+
+// Computes result[i] = lhs[i] / rhs.divisor() for every index i with the precomputed reciprocal.
+// The element type is deduced from result, as for the span arithmetic functions.
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto div(const std::span<const std::type_identity_t<T>> lhs,
+                   const divider<std::type_identity_t<T>>& rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_divider_impl<detail::impl::divider_op::div, Policy, T>(lhs, rhs, result);
+}
+
+// Computes result[i] = lhs[i] % rhs.divisor() for every index i with the precomputed reciprocal
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto mod(const std::span<const std::type_identity_t<T>> lhs,
+                   const divider<std::type_identity_t<T>>& rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_divider_impl<detail::impl::divider_op::mod, Policy, T>(lhs, rhs, result);
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_DIVIDER_HPP
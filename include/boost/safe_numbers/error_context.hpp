@@ -0,0 +1,59 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_ERROR_CONTEXT_HPP
+#define BOOST_SAFE_NUMBERS_ERROR_CONTEXT_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+
+namespace boost::safe_numbers {
+
+// Accumulates the overflow status of any number of sticky operations,
+// which wrap as the overflowing functions do, so that it can be tested once after a loop or batch.
+// This is the host counterpart of the first error recorded by device_error_context.
+BOOST_SAFE_NUMBERS_EXPORT class error_context
+{
+private:
+
+    // A byte rather than a bool, so that the compiler vectorizes the OR reduction of a loop of sticky operations
+    unsigned char overflowed_ {0U};
+
+public:
+
+    constexpr error_context() noexcept = default;
+
+    // ORs in the status of a single operation without branching, so that recording does not stop a loop from vectorizing
+    constexpr auto record(const bool overflowed) noexcept -> void
+    {
+        overflowed_ = static_cast<unsigned char>(overflowed_ | static_cast<unsigned char>(overflowed));
+    }
+
+    // Adds everything recorded by another context, e.g. a local one used inside a hot loop
+    constexpr auto merge(const error_context& other) noexcept -> void
+    {
+        overflowed_ = static_cast<unsigned char>(overflowed_ | other.overflowed_);
+    }
+
+    // True if any operation recorded since construction or the last reset overflowed
+    [[nodiscard]] constexpr auto overflowed() const noexcept -> bool
+    {
+        return overflowed_ != 0U;
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        overflowed_ = 0U;
+    }
+};
+
+// The context of the calling thread, used by the sticky functions and policy when no context is passed
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto thread_error_context() noexcept -> error_context&
+{
+    thread_local error_context context {};
+    return context;
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_ERROR_CONTEXT_HPP
@@ -0,0 +1,173 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_EXPECTED_HPP
+#define BOOST_SAFE_NUMBERS_EXPECTED_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <version>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#  define BOOST_SAFE_NUMBERS_HAS_STD_EXPECTED
+#  ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+#    include <expected>
+#  endif
+#endif
+
+namespace boost::safe_numbers {
+
+// Why an operation with the expected policy failed
+BOOST_SAFE_NUMBERS_EXPORT enum class arithmetic_errc
+{
+    overflow = 1,
+    underflow,
+    division_by_zero,
+    invalid_shift,      // The shift amount is at least the width of the type
+    out_of_range,       // The result is representable but outside the bounds of a bounded type
+};
+
+#ifdef BOOST_SAFE_NUMBERS_HAS_STD_EXPECTED
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename T, typename E>
+using expected = std::expected<T, E>;
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename E>
+using unexpected = std::unexpected<E>;
+
+#else
+
+// Before C++23 a minimal equivalent of std::expected for the results of arithmetic operations.
+// T and E must be trivially copyable, which all library types and error codes are.
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename E>
+class unexpected
+{
+private:
+
+    E error_;
+
+public:
+
+    constexpr explicit unexpected(const E error) noexcept : error_ {error} {}
+
+    [[nodiscard]] constexpr auto error() const noexcept -> E { return error_; }
+
+    [[nodiscard]] friend constexpr auto operator==(const unexpected lhs, const unexpected rhs) noexcept -> bool
+    {
+        return lhs.error_ == rhs.error_;
+    }
+};
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename T, typename E>
+class expected
+{
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<E>,
+                  "The bundled expected only supports trivially copyable types");
+
+private:
+
+    // A union rather than two members, as the bounded types are not default constructible
+    union
+    {
+        T value_;
+        E error_;
+    };
+
+    bool has_value_;
+
+public:
+
+    using value_type = T;
+    using error_type = E;
+    using unexpected_type = unexpected<E>;
+
+    constexpr expected(const T value) noexcept : value_ {value}, has_value_ {true} {}
+
+    constexpr expected(const unexpected<E> error) noexcept : error_ {error.error()}, has_value_ {false} {}
+
+    [[nodiscard]] constexpr auto has_value() const noexcept -> bool { return has_value_; }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return has_value_; }
+
+    // The behavior is undefined when there is no value, as with std::expected
+    [[nodiscard]] constexpr auto operator*() const noexcept -> const T& { return value_; }
+
+    [[nodiscard]] constexpr auto operator->() const noexcept -> const T* { return &value_; }
+
+    // Throws std::domain_error when there is no value, where std::expected throws std::bad_expected_access
+    [[nodiscard]] constexpr auto value() const -> const T&
+    {
+        if (!has_value_)
+        {
+            if (std::is_constant_evaluated())
+            {
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, "Access to the value of an expected holding an error");
+            }
+            else
+            {
+                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Access to the value of an expected holding an error");
+            }
+        }
+
+        return value_;
+    }
+
+    // The behavior is undefined when there is a value, as with std::expected
+    [[nodiscard]] constexpr auto error() const noexcept -> const E& { return error_; }
+
+    template <typename U>
+    [[nodiscard]] constexpr auto value_or(U&& default_value) const -> T
+    {
+        return has_value_ ? value_ : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const expected& lhs, const expected& rhs) noexcept -> bool
+    {
+        if (lhs.has_value_ != rhs.has_value_)
+        {
+            return false;
+        }
+
+        return lhs.has_value_ ? lhs.value_ == rhs.value_ : lhs.error_ == rhs.error_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const expected& lhs, const T& rhs) noexcept -> bool
+    {
+        return lhs.has_value_ && lhs.value_ == rhs;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const expected& lhs, const unexpected<E>& rhs) noexcept -> bool
+    {
+        return !lhs.has_value_ && lhs.error_ == rhs.error();
+    }
+};
+
+#endif // BOOST_SAFE_NUMBERS_HAS_STD_EXPECTED
+
+// The result of an operation with the expected policy
+BOOST_SAFE_NUMBERS_EXPORT template <typename T>
+using arithmetic_expected = expected<T, arithmetic_errc>;
+
+namespace detail {
+
+template <typename T>
+[[nodiscard]] constexpr auto make_arithmetic_error(const arithmetic_errc error) noexcept -> arithmetic_expected<T>
+{
+    return arithmetic_expected<T>{unexpected<arithmetic_errc>{error}};
+}
+
+} // namespace detail
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_EXPECTED_HPP
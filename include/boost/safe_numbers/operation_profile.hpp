@@ -0,0 +1,299 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reads the counters of BOOST_SAFE_NUMBERS_ENABLE_PROFILING, which count every operation executed by its operation, type, and policy,
+// to find the operations that dominate a workload.
+
+#ifndef BOOST_SAFE_NUMBERS_OPERATION_PROFILE_HPP
+#define BOOST_SAFE_NUMBERS_OPERATION_PROFILE_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/operation_profile.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+BOOST_SAFE_NUMBERS_EXPORT struct operation_count
+{
+    arithmetic_op op;
+    const char* type;           // The operand type, e.g. "u64"
+    overflow_policy policy;
+    std::uint64_t count;
+};
+
+BOOST_SAFE_NUMBERS_EXPORT class operation_profile;
+
+BOOST_SAFE_NUMBERS_EXPORT auto take_operation_profile() -> operation_profile;
+
+BOOST_SAFE_NUMBERS_EXPORT auto this_thread_operation_profile() -> operation_profile;
+
+// The number of operations executed, by operation, type, and policy.
+// The operators of the library types count with the throw_exception policy.
+BOOST_SAFE_NUMBERS_EXPORT class operation_profile
+{
+private:
+
+    std::array<std::uint64_t, detail::operation_profile_size> counts_ {};
+    std::uint64_t unrecorded_ {};
+
+    friend auto take_operation_profile() -> operation_profile;
+    friend auto this_thread_operation_profile() -> operation_profile;
+
+    void add_shard(const detail::operation_profile_shard& shard) noexcept
+    {
+        for (std::size_t i {}; i < counts_.size(); ++i)
+        {
+            counts_[i] += shard.counts[i].load(std::memory_order_relaxed);
+        }
+    }
+
+public:
+
+    constexpr operation_profile() noexcept = default;
+
+    // T is a library type such as u64, or its basis type
+    template <typename T>
+    [[nodiscard]] constexpr auto count(const arithmetic_op op, const overflow_policy policy) const noexcept -> std::uint64_t
+    {
+        return counts_[detail::operation_profile_index(detail::profiled_type_index<detail::underlying_type_t<T>>(), op, policy)];
+    }
+
+    [[nodiscard]] constexpr auto total() const noexcept -> std::uint64_t
+    {
+        std::uint64_t total {};
+        for (const auto count : counts_)
+        {
+            total += count;
+        }
+
+        return total;
+    }
+
+    // The operations of threads that could not allocate their counters
+    [[nodiscard]] constexpr auto unrecorded() const noexcept -> std::uint64_t { return unrecorded_; }
+
+    // The counts that are not zero, the most frequent first
+    [[nodiscard]] auto counts() const -> std::vector<operation_count>
+    {
+        std::vector<operation_count> counts;
+
+        for (std::size_t type {}; type < detail::profiled_type_count; ++type)
+        {
+            for (std::size_t op {}; op < detail::profiled_op_count; ++op)
+            {
+                for (std::size_t policy {}; policy < detail::profiled_policy_count; ++policy)
+                {
+                    const auto count {counts_[(type * detail::profiled_op_count + op) * detail::profiled_policy_count + policy]};
+                    if (count != 0U)
+                    {
+                        counts.push_back(operation_count{static_cast<arithmetic_op>(op), detail::profiled_type_names[type],
+                                                         static_cast<overflow_policy>(policy), count});
+                    }
+                }
+            }
+        }
+
+        std::stable_sort(counts.begin(), counts.end(), [](const operation_count& lhs, const operation_count& rhs)
+        {
+            return lhs.count > rhs.count;
+        });
+
+        return counts;
+    }
+
+    constexpr auto operator+=(const operation_profile& rhs) noexcept -> operation_profile&
+    {
+        for (std::size_t i {}; i < counts_.size(); ++i)
+        {
+            counts_[i] += rhs.counts_[i];
+        }
+        unrecorded_ += rhs.unrecorded_;
+
+        return *this;
+    }
+
+    // rhs is an earlier profile of the same threads, so that the result counts the operations in between
+    constexpr auto operator-=(const operation_profile& rhs) noexcept -> operation_profile&
+    {
+        for (std::size_t i {}; i < counts_.size(); ++i)
+        {
+            counts_[i] -= rhs.counts_[i];
+        }
+        unrecorded_ -= rhs.unrecorded_;
+
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(operation_profile lhs, const operation_profile& rhs) noexcept -> operation_profile
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(operation_profile lhs, const operation_profile& rhs) noexcept -> operation_profile
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+};
+
+// The operations of every thread, including those that have exited.
+// It may be called at any time from any thread, while the counting continues, and is empty unless BOOST_SAFE_NUMBERS_ENABLE_PROFILING is defined.
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto take_operation_profile() -> operation_profile
+{
+    operation_profile profile {};
+    profile.unrecorded_ = detail::thread_shards_unrecorded<detail::operation_profile_shard>.load(std::memory_order_relaxed);
+
+    for (const auto* shard {detail::thread_shards<detail::operation_profile_shard>.load(std::memory_order_acquire)}; shard != nullptr; shard = shard->next)
+    {
+        profile.add_shard(*shard);
+    }
+
+    return profile;
+}
+
+// The operations of the calling thread.
+// A thread may take over the counters of one that has exited, in which case their operations are included.
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto this_thread_operation_profile() -> operation_profile
+{
+    operation_profile profile {};
+
+    if (const auto* shard {detail::thread_shard<detail::operation_profile_shard>()}; shard != nullptr)
+    {
+        profile.add_shard(*shard);
+    }
+
+    return profile;
+}
+
+// Adds the operations that the calling thread executes during its lifetime to a profile of a region of code,
+// so that one profile may collect the operations of every execution of the region, by any thread.
+// The profile is not synchronized, so each thread needs its own, which are then added together.
+BOOST_SAFE_NUMBERS_EXPORT class operation_profile_scope
+{
+private:
+
+    operation_profile& region_;
+    operation_profile start_ {this_thread_operation_profile()};
+
+public:
+
+    explicit operation_profile_scope(operation_profile& region) : region_ {region} {}
+
+    operation_profile_scope(const operation_profile_scope&) = delete;
+    auto operator=(const operation_profile_scope&) -> operation_profile_scope& = delete;
+
+    ~operation_profile_scope()
+    {
+        region_ += this_thread_operation_profile() - start_;
+    }
+};
+
+namespace detail {
+
+constexpr auto profiled_policy_name(const overflow_policy policy) noexcept -> const char*
+{
+    switch (policy)
+    {
+        case overflow_policy::throw_exception:
+            return "throw_exception";
+        case overflow_policy::saturate:
+            return "saturate";
+        case overflow_policy::overflow_tuple:
+            return "overflow_tuple";
+        case overflow_policy::checked:
+            return "checked";
+        case overflow_policy::strict:
+            return "strict";
+        case overflow_policy::widen:
+            return "widen";
+        case overflow_policy::sticky:
+            return "sticky";
+        case overflow_policy::wrap:
+            return "wrap";
+        case overflow_policy::expected:
+            return "expected";
+    }
+
+    return "unknown";
+}
+
+} // namespace detail
+
+// One line per count, the most frequent first, e.g. "u64 checked mul: 3100000000"
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto to_text(const operation_profile& profile) -> std::string
+{
+    std::string out;
+
+    for (const auto& count : profile.counts())
+    {
+        out += count.type;
+        out += ' ';
+        out += detail::profiled_policy_name(count.policy);
+        out += ' ';
+        out += to_string(count.op);
+        out += ": ";
+        out += std::to_string(count.count);
+        out += '\n';
+    }
+
+    if (profile.unrecorded() != 0U)
+    {
+        out += "unrecorded: ";
+        out += std::to_string(profile.unrecorded());
+        out += '\n';
+    }
+
+    return out;
+}
+
+// {"counts":[{"op":"mul","type":"u64","policy":"checked","count":3100000000},...],"unrecorded":0}
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto to_json(const operation_profile& profile) -> std::string
+{
+    std::string out {"{\"counts\":["};
+
+    bool first {true};
+    for (const auto& count : profile.counts())
+    {
+        if (!first)
+        {
+            out += ',';
+        }
+        first = false;
+
+        out += "{\"op\":\"";
+        out += to_string(count.op);
+        out += "\",\"type\":\"";
+        out += count.type;
+        out += "\",\"policy\":\"";
+        out += detail::profiled_policy_name(count.policy);
+        out += "\",\"count\":";
+        out += std::to_string(count.count);
+        out += '}';
+    }
+
+    out += "],\"unrecorded\":";
+    out += std::to_string(profile.unrecorded());
+    out += '}';
+
+    return out;
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_OPERATION_PROFILE_HPP
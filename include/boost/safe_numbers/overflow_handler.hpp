@@ -0,0 +1,200 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hooks called on the host when an operation detects an error that would throw,
+// so that builds without exceptions can log, count, trap, or abort instead.
+
+#ifndef BOOST_SAFE_NUMBERS_OVERFLOW_HANDLER_HPP
+#define BOOST_SAFE_NUMBERS_OVERFLOW_HANDLER_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/int128/int128.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <boost/assert/source_location.hpp>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+BOOST_SAFE_NUMBERS_EXPORT enum class arithmetic_op
+{
+    none,           // The error is not from a single operation, e.g. mismatched span sizes
+    add,
+    sub,
+    mul,
+    div,
+    mod,
+    shl,
+    shr,
+    inc,
+    dec,
+    neg,
+    conversion,
+};
+
+// The name of the enumerator, e.g. "add"
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] constexpr auto to_string(const arithmetic_op op) noexcept -> const char*
+{
+    switch (op)
+    {
+        case arithmetic_op::none:
+            return "none";
+        case arithmetic_op::add:
+            return "add";
+        case arithmetic_op::sub:
+            return "sub";
+        case arithmetic_op::mul:
+            return "mul";
+        case arithmetic_op::div:
+            return "div";
+        case arithmetic_op::mod:
+            return "mod";
+        case arithmetic_op::shl:
+            return "shl";
+        case arithmetic_op::shr:
+            return "shr";
+        case arithmetic_op::inc:
+            return "inc";
+        case arithmetic_op::dec:
+            return "dec";
+        case arithmetic_op::neg:
+            return "neg";
+        case arithmetic_op::conversion:
+            return "conversion";
+    }
+
+    return "unknown";
+}
+
+BOOST_SAFE_NUMBERS_EXPORT struct overflow_info
+{
+    arithmetic_op op;
+    const char* type;                   // The operand type, e.g. "u32", or nullptr when op is none
+    bool is_signed;
+    int128::uint128_t lhs;              // The bits of the operands, sign extended when is_signed,
+    int128::uint128_t rhs;              // and zero for the missing operand of unary operations
+    const char* message;                // The message of the exception that would be thrown
+    boost::source_location location;    // Where in the library the error was detected
+};
+
+BOOST_SAFE_NUMBERS_EXPORT using overflow_handler = void (*)(const overflow_info&);
+
+namespace detail {
+
+inline std::atomic<overflow_handler> installed_overflow_handler {nullptr};
+
+} // namespace detail
+
+// Installs a handler that is called before the default action, and returns the previously installed one.
+// Passing nullptr removes the handler.
+BOOST_SAFE_NUMBERS_EXPORT inline auto set_overflow_handler(const overflow_handler handler) noexcept -> overflow_handler
+{
+    return detail::installed_overflow_handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT inline auto get_overflow_handler() noexcept -> overflow_handler
+{
+    return detail::installed_overflow_handler.load(std::memory_order_acquire);
+}
+
+#ifdef BOOST_SAFE_NUMBERS_ENABLE_OVERFLOW_HANDLER
+
+// Defined by the user, and called instead of throwing.
+// The program is aborted if it returns.
+BOOST_SAFE_NUMBERS_EXPORT void overflow_detected(const overflow_info& info);
+
+#endif // BOOST_SAFE_NUMBERS_ENABLE_OVERFLOW_HANDLER
+
+namespace detail {
+
+template <typename T>
+constexpr auto operand_type_name() noexcept -> const char*
+{
+    if constexpr (std::is_same_v<T, std::uint8_t>)
+    {
+        return "u8";
+    }
+    else if constexpr (std::is_same_v<T, std::uint16_t>)
+    {
+        return "u16";
+    }
+    else if constexpr (std::is_same_v<T, std::uint32_t>)
+    {
+        return "u32";
+    }
+    else if constexpr (std::is_same_v<T, std::uint64_t>)
+    {
+        return "u64";
+    }
+    else if constexpr (std::is_same_v<T, int128::uint128_t>)
+    {
+        return "u128";
+    }
+    else if constexpr (std::is_same_v<T, std::int8_t>)
+    {
+        return "i8";
+    }
+    else if constexpr (std::is_same_v<T, std::int16_t>)
+    {
+        return "i16";
+    }
+    else if constexpr (std::is_same_v<T, std::int32_t>)
+    {
+        return "i32";
+    }
+    else if constexpr (std::is_same_v<T, std::int64_t>)
+    {
+        return "i64";
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, int128::int128_t>, "Unsupported operand type");
+        return "i128";
+    }
+}
+
+template <typename T>
+constexpr auto operand_bits(const T value) noexcept -> int128::uint128_t
+{
+    if constexpr (std::is_same_v<T, int128::uint128_t>)
+    {
+        return value;
+    }
+    else if constexpr (std::is_same_v<T, int128::int128_t>)
+    {
+        return static_cast<int128::uint128_t>(value);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<int128::uint128_t>(static_cast<int128::int128_t>(value));
+    }
+    else
+    {
+        return static_cast<int128::uint128_t>(value);
+    }
+}
+
+template <typename T>
+constexpr auto make_overflow_info(const arithmetic_op op, const T lhs, const T rhs,
+                                  const char* message, const boost::source_location& loc) noexcept -> overflow_info
+{
+    constexpr bool is_signed {std::is_same_v<T, int128::int128_t> || std::is_signed_v<T>};
+    return overflow_info{op, operand_type_name<T>(), is_signed, operand_bits(lhs), operand_bits(rhs), message, loc};
+}
+
+constexpr auto make_overflow_info(const char* message, const boost::source_location& loc) noexcept -> overflow_info
+{
+    return overflow_info{arithmetic_op::none, nullptr, false, int128::uint128_t{0U}, int128::uint128_t{0U}, message, loc};
+}
+
+} // namespace detail
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_OVERFLOW_HANDLER_HPP
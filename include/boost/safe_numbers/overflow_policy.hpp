@@ -15,6 +15,9 @@ enum class overflow_policy
     checked,
     strict,
     widen,
+    sticky,
+    wrap,
+    expected,
 };
 
 } // namespace boost::safe_numbers
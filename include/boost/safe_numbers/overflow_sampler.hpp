@@ -0,0 +1,357 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Captures the call stacks of a sample of the errors passed to the runtime overflow handler,
+// into a ring buffer allocated up front that is drained by another thread,
+// so that a storm of overflows costs a few atomic operations per error rather than an unwind and an allocation each.
+
+#ifndef BOOST_SAFE_NUMBERS_OVERFLOW_SAMPLER_HPP
+#define BOOST_SAFE_NUMBERS_OVERFLOW_SAMPLER_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/int128/int128.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+#include <boost/safe_numbers/arithmetic_error.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <boost/assert/source_location.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+#include <boost/stacktrace/stacktrace.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+// Which of the errors at each site have their call stack captured: the first `first`,
+// and after those one in every `every`, or none if every is zero
+struct overflow_sampling
+{
+    std::uint64_t first {1U};
+    std::uint64_t every {1000U};
+};
+
+inline constexpr std::size_t overflow_event_max_frames {32U};
+
+// A sampled error, with the call stack as unresolved frame addresses
+class overflow_event
+{
+private:
+
+    friend class overflow_sampler;
+
+    arithmetic_op op_ {arithmetic_op::none};
+    const char* type_ {nullptr};
+    bool is_signed_ {false};
+    int128::uint128_t lhs_ {};
+    int128::uint128_t rhs_ {};
+    detail::message_buffer<detail::arithmetic_error_message_capacity> message_ {};
+    boost::source_location location_ {};
+    std::uint64_t occurrence_ {};
+    std::size_t frame_count_ {};
+
+    // One more than the frames kept, since the dump is terminated by a null frame
+    const void* frames_[overflow_event_max_frames + 1U] {};
+
+public:
+
+    // The description that was passed to the handler, whose message is valid for the lifetime of the event
+    [[nodiscard]] auto info() const noexcept -> overflow_info
+    {
+        return overflow_info{op_, type_, is_signed_, lhs_, rhs_, message_.c_str(), location_};
+    }
+
+    // How many errors had been detected at the same site, including this one
+    [[nodiscard]] auto occurrence() const noexcept -> std::uint64_t { return occurrence_; }
+
+    // The return addresses from the sampler outwards, through the library to the operation and its callers,
+    // of which at most overflow_event_max_frames are kept
+    [[nodiscard]] auto frames() const noexcept -> std::span<const void* const>
+    {
+        return {frames_, frame_count_};
+    }
+
+    // Resolving the frames to functions and source lines is left to the consumer, since it allocates and is slow
+    [[nodiscard]] auto stacktrace() const -> boost::stacktrace::stacktrace
+    {
+        return boost::stacktrace::stacktrace::from_dump(frames_, frame_count_ * sizeof(const void*));
+    }
+};
+
+class overflow_sampler;
+
+namespace detail {
+
+inline std::atomic<overflow_sampler*> installed_overflow_sampler {nullptr};
+
+// The handler that was installed before the sampler, which is still called after each error is recorded.
+// It is kept here rather than in the sampler, since replacing one sampler with another passes it on
+// while threads reporting errors may be reading it.
+inline std::atomic<overflow_handler> chained_overflow_handler {nullptr};
+
+inline void sample_overflow(const overflow_info& info);
+
+} // namespace detail
+
+// Counts the errors at each site, and captures the call stacks of those chosen by the sampling into a ring buffer.
+// Any number of threads may record errors at once, while a single thread at a time drains the events.
+// All memory is allocated by the constructor: when the ring buffer is full, further sampled events are dropped and counted,
+// and when every site is taken, the errors of new sites share one count.
+class overflow_sampler
+{
+private:
+
+    struct alignas(64) slot
+    {
+        std::atomic<std::size_t> sequence {};
+        overflow_event event {};
+    };
+
+    // A key of zero marks an unused site
+    struct site
+    {
+        std::atomic<std::uint64_t> key {};
+        std::atomic<std::uint64_t> count {};
+    };
+
+    overflow_sampling sampling_;
+
+    std::size_t slot_mask_;
+    std::unique_ptr<slot[]> slots_;
+
+    std::size_t site_mask_;
+    std::unique_ptr<site[]> sites_;
+    std::atomic<std::uint64_t> unsited_count_ {};
+
+    alignas(64) std::atomic<std::size_t> enqueue_pos_ {};
+    alignas(64) std::size_t dequeue_pos_ {};
+
+    std::atomic<std::uint64_t> observed_ {};
+    std::atomic<std::uint64_t> dropped_ {};
+
+    // Errors are told apart by where the library detected them, and the operation and type, since one check may serve several
+    static auto site_key(const overflow_info& info) noexcept -> std::uint64_t
+    {
+        constexpr std::uint64_t prime {UINT64_C(0x100000001B3)};
+
+        std::uint64_t hash {UINT64_C(0xCBF29CE484222325)};
+        const auto mix {[&hash](const std::uint64_t value) noexcept { hash = (hash ^ value) * prime; }};
+
+        mix(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(info.location.file_name())));
+        mix(static_cast<std::uint64_t>(info.location.line()));
+        mix(static_cast<std::uint64_t>(info.location.column()));
+        mix(static_cast<std::uint64_t>(info.op));
+        mix(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(info.type)));
+
+        return hash == 0U ? 1U : hash;
+    }
+
+    auto site_count(const overflow_info& info) noexcept -> std::atomic<std::uint64_t>&
+    {
+        const auto key {site_key(info)};
+
+        for (std::size_t probe {}; probe <= site_mask_; ++probe)
+        {
+            auto& entry {sites_[(static_cast<std::size_t>(key) + probe) & site_mask_]};
+
+            auto current {entry.key.load(std::memory_order_acquire)};
+            if (current == 0U && entry.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                return entry.count;
+            }
+            if (current == key)
+            {
+                return entry.count;
+            }
+        }
+
+        return unsited_count_;
+    }
+
+    [[nodiscard]] auto is_sampled(const std::uint64_t occurrence) const noexcept -> bool
+    {
+        return occurrence <= sampling_.first ||
+               (sampling_.every != 0U && (occurrence - sampling_.first) % sampling_.every == 0U);
+    }
+
+    // The stack is captured into the slot that was claimed, so that nothing is copied
+    BOOST_NOINLINE static void capture(overflow_event& event, const overflow_info& info, const std::uint64_t occurrence) noexcept
+    {
+        event.op_ = info.op;
+        event.type_ = info.type;
+        event.is_signed_ = info.is_signed;
+        event.lhs_ = info.lhs;
+        event.rhs_ = info.rhs;
+        event.message_ = detail::message_buffer<detail::arithmetic_error_message_capacity> {info.message};
+        event.location_ = info.location;
+        event.occurrence_ = occurrence;
+
+        // Skips this function, so that the first frame is in record
+        auto count {boost::stacktrace::safe_dump_to(1U, event.frames_, sizeof(event.frames_))};
+
+        // The count includes the terminating null frame
+        while (count > 0U && event.frames_[count - 1U] == nullptr)
+        {
+            --count;
+        }
+
+        event.frame_count_ = count;
+    }
+
+    // A bounded queue of many producers (D. Vyukov), in which each slot's sequence tells
+    // whether it is free for the producer at that position or ready for the consumer
+    void push(const overflow_info& info, const std::uint64_t occurrence) noexcept
+    {
+        auto pos {enqueue_pos_.load(std::memory_order_relaxed)};
+
+        for (;;)
+        {
+            auto& s {slots_[pos & slot_mask_]};
+            const auto sequence {s.sequence.load(std::memory_order_acquire)};
+            const auto diff {static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos)};
+
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+                {
+                    capture(s.event, info, occurrence);
+                    s.sequence.store(pos + 1U, std::memory_order_release);
+                    return;
+                }
+            }
+            else if (diff < 0)
+            {
+                dropped_.fetch_add(1U, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+
+    // The capacity of the ring buffer and the number of sites are rounded up to powers of two
+    explicit overflow_sampler(const overflow_sampling sampling = {},
+                              const std::size_t capacity = 256U,
+                              const std::size_t sites = 64U)
+        : sampling_ {sampling},
+          slot_mask_ {std::bit_ceil(std::max(capacity, std::size_t{2U})) - 1U},
+          slots_ {std::make_unique<slot[]>(slot_mask_ + 1U)},
+          site_mask_ {std::bit_ceil(std::max(sites, std::size_t{1U})) - 1U},
+          sites_ {std::make_unique<site[]>(site_mask_ + 1U)}
+    {
+        for (std::size_t i {}; i <= slot_mask_; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    overflow_sampler(const overflow_sampler&) = delete;
+    auto operator=(const overflow_sampler&) -> overflow_sampler& = delete;
+
+    ~overflow_sampler()
+    {
+        uninstall();
+    }
+
+    // Records every error passed to the runtime handler, after which the handler that was installed before is still called.
+    // At most one sampler is installed at a time, and installing another replaces it.
+    void install() noexcept
+    {
+        auto* replaced {detail::installed_overflow_sampler.exchange(this, std::memory_order_acq_rel)};
+
+        if (replaced == nullptr)
+        {
+            detail::chained_overflow_handler.store(set_overflow_handler(detail::sample_overflow), std::memory_order_release);
+        }
+    }
+
+    // Restores the handler that was installed before.
+    // No other thread may be reporting an error, since it could still be recording into this sampler.
+    void uninstall() noexcept
+    {
+        auto* self {this};
+        if (detail::installed_overflow_sampler.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel))
+        {
+            set_overflow_handler(detail::chained_overflow_handler.exchange(nullptr, std::memory_order_acq_rel));
+        }
+    }
+
+    // Counts an error, and captures its call stack if it is sampled. Usable from a handler of the program's own.
+    void record(const overflow_info& info) noexcept
+    {
+        observed_.fetch_add(1U, std::memory_order_relaxed);
+
+        const auto occurrence {site_count(info).fetch_add(1U, std::memory_order_relaxed) + 1U};
+        if (is_sampled(occurrence))
+        {
+            push(info, occurrence);
+        }
+    }
+
+    // Calls consumer with each event that is ready, in the order they were recorded, and returns how many were consumed.
+    // If consumer throws, the event it was passed is consumed again by the next call.
+    template <typename Consumer>
+    auto drain(Consumer&& consumer) -> std::size_t
+    {
+        std::size_t consumed {};
+
+        for (;;)
+        {
+            auto& s {slots_[dequeue_pos_ & slot_mask_]};
+            if (s.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1U)
+            {
+                return consumed;
+            }
+
+            consumer(static_cast<const overflow_event&>(s.event));
+
+            s.sequence.store(dequeue_pos_ + slot_mask_ + 1U, std::memory_order_release);
+            ++dequeue_pos_;
+            ++consumed;
+        }
+    }
+
+    [[nodiscard]] auto sampling() const noexcept -> overflow_sampling { return sampling_; }
+
+    [[nodiscard]] auto capacity() const noexcept -> std::size_t { return slot_mask_ + 1U; }
+
+    // The errors recorded, whether sampled or not
+    [[nodiscard]] auto observed() const noexcept -> std::uint64_t { return observed_.load(std::memory_order_relaxed); }
+
+    // The sampled events lost because the ring buffer was full
+    [[nodiscard]] auto dropped() const noexcept -> std::uint64_t { return dropped_.load(std::memory_order_relaxed); }
+};
+
+namespace detail {
+
+inline void sample_overflow(const overflow_info& info)
+{
+    if (auto* sampler {installed_overflow_sampler.load(std::memory_order_acquire)}; sampler != nullptr)
+    {
+        sampler->record(info);
+    }
+
+    if (const auto previous {chained_overflow_handler.load(std::memory_order_acquire)}; previous != nullptr)
+    {
+        previous(info);
+    }
+}
+
+} // namespace detail
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_OVERFLOW_SAMPLER_HPP
@@ -0,0 +1,308 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_POLICY_INTEGERS_HPP
+#define BOOST_SAFE_NUMBERS_POLICY_INTEGERS_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <compare>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+namespace detail {
+
+// The policies whose operations return the operand type, so that they can be chained with operators
+template <overflow_policy Policy>
+inline constexpr bool is_operator_policy_v {Policy == overflow_policy::throw_exception ||
+                                            Policy == overflow_policy::saturate ||
+                                            Policy == overflow_policy::strict ||
+                                            Policy == overflow_policy::sticky ||
+                                            Policy == overflow_policy::wrap};
+
+} // namespace detail
+
+// A u8 to u128 or i8 to i128 whose operators all use Policy instead of throwing,
+// so that generic code written with operators gets the behavior of the named functions.
+// It has the layout of T, so arrays can be viewed as either with as_value_span and as_safe_span.
+BOOST_SAFE_NUMBERS_EXPORT template <typename T, overflow_policy Policy>
+    requires (detail::is_unsigned_library_type_v<T> || detail::is_signed_library_type_v<T>) && (!detail::is_bounded_type_v<T>)
+class safe
+{
+    static_assert(detail::is_operator_policy_v<Policy>,
+                  "Only the throw_exception, saturate, strict, sticky, and wrap policies return the operand type, "
+                  "use the generic functions (e.g. add<Policy>) for the others");
+
+public:
+
+    using value_type = T;
+    using basis_type = typename T::basis_type;
+
+    static constexpr overflow_policy policy {Policy};
+
+private:
+
+    T value_ {};
+
+    static constexpr bool is_unsigned {detail::is_unsigned_library_type_v<T>};
+
+    static constexpr T one {static_cast<basis_type>(1)};
+
+public:
+
+    constexpr safe() noexcept = default;
+
+    explicit constexpr safe(const T value) noexcept : value_ {value} {}
+
+    explicit constexpr safe(const basis_type value) noexcept : value_ {value} {}
+
+    template <typename U>
+        requires std::is_same_v<U, bool>
+    explicit constexpr safe(U) noexcept
+    {
+        static_assert(detail::dependent_false<U>, "Construction from bool is not allowed");
+    }
+
+    [[nodiscard]] explicit constexpr operator T() const noexcept { return value_; }
+
+    [[nodiscard]] explicit constexpr operator basis_type() const noexcept { return static_cast<basis_type>(value_); }
+
+    [[nodiscard]] friend constexpr auto operator<=>(safe lhs, safe rhs) noexcept -> std::strong_ordering = default;
+
+    // Arithmetic
+
+    [[nodiscard]] friend constexpr auto operator+(const safe lhs, const safe rhs)
+        noexcept(noexcept(add<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        return safe{add<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const safe lhs, const safe rhs)
+        noexcept(noexcept(sub<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        return safe{sub<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const safe lhs, const safe rhs)
+        noexcept(noexcept(mul<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        return safe{mul<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator/(const safe lhs, const safe rhs)
+        noexcept(noexcept(div<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        return safe{div<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator%(const safe lhs, const safe rhs)
+        noexcept(noexcept(mod<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        return safe{mod<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] constexpr auto operator+() const noexcept -> safe { return *this; }
+
+    // Negation is subtraction from zero with the policy, except for throw_exception which keeps the exception of T
+    [[nodiscard]] constexpr auto operator-() const noexcept(noexcept(sub<Policy>(std::declval<T>(), std::declval<T>())) &&
+                                                            Policy != overflow_policy::throw_exception) -> safe
+        requires (!is_unsigned)
+    {
+        if constexpr (Policy == overflow_policy::throw_exception)
+        {
+            return safe{-value_};
+        }
+        else
+        {
+            return safe{sub<Policy>(T{}, value_)};
+        }
+    }
+
+    constexpr auto operator+=(const safe rhs) noexcept(noexcept(std::declval<safe>() + rhs)) -> safe&
+    {
+        *this = *this + rhs;
+        return *this;
+    }
+
+    constexpr auto operator-=(const safe rhs) noexcept(noexcept(std::declval<safe>() - rhs)) -> safe&
+    {
+        *this = *this - rhs;
+        return *this;
+    }
+
+    constexpr auto operator*=(const safe rhs) noexcept(noexcept(std::declval<safe>() * rhs)) -> safe&
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr auto operator/=(const safe rhs) noexcept(noexcept(std::declval<safe>() / rhs)) -> safe&
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    constexpr auto operator%=(const safe rhs) noexcept(noexcept(std::declval<safe>() % rhs)) -> safe&
+    {
+        *this = *this % rhs;
+        return *this;
+    }
+
+    constexpr auto operator++() noexcept(noexcept(add<Policy>(std::declval<T>(), std::declval<T>()))) -> safe&
+    {
+        value_ = add<Policy>(value_, one);
+        return *this;
+    }
+
+    constexpr auto operator++(int) noexcept(noexcept(add<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        const auto temp {*this};
+        ++(*this);
+        return temp;
+    }
+
+    constexpr auto operator--() noexcept(noexcept(sub<Policy>(std::declval<T>(), std::declval<T>()))) -> safe&
+    {
+        value_ = sub<Policy>(value_, one);
+        return *this;
+    }
+
+    constexpr auto operator--(int) noexcept(noexcept(sub<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+    {
+        const auto temp {*this};
+        --(*this);
+        return temp;
+    }
+
+    // Shifts and bitwise operations, which like those of T are only for unsigned types
+
+    [[nodiscard]] friend constexpr auto operator<<(const safe lhs, const safe rhs)
+        noexcept(noexcept(shl<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+        requires is_unsigned
+    {
+        return safe{shl<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    [[nodiscard]] friend constexpr auto operator>>(const safe lhs, const safe rhs)
+        noexcept(noexcept(shr<Policy>(std::declval<T>(), std::declval<T>()))) -> safe
+        requires is_unsigned
+    {
+        return safe{shr<Policy>(lhs.value_, rhs.value_)};
+    }
+
+    constexpr auto operator<<=(const safe rhs) noexcept(noexcept(std::declval<safe>() << rhs)) -> safe&
+        requires is_unsigned
+    {
+        *this = *this << rhs;
+        return *this;
+    }
+
+    constexpr auto operator>>=(const safe rhs) noexcept(noexcept(std::declval<safe>() >> rhs)) -> safe&
+        requires is_unsigned
+    {
+        *this = *this >> rhs;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr auto operator&(const safe lhs, const safe rhs) noexcept -> safe
+        requires is_unsigned
+    {
+        return safe{lhs.value_ & rhs.value_};
+    }
+
+    [[nodiscard]] friend constexpr auto operator|(const safe lhs, const safe rhs) noexcept -> safe
+        requires is_unsigned
+    {
+        return safe{lhs.value_ | rhs.value_};
+    }
+
+    [[nodiscard]] friend constexpr auto operator^(const safe lhs, const safe rhs) noexcept -> safe
+        requires is_unsigned
+    {
+        return safe{lhs.value_ ^ rhs.value_};
+    }
+
+    [[nodiscard]] constexpr auto operator~() const noexcept -> safe
+        requires is_unsigned
+    {
+        return safe{~value_};
+    }
+
+    constexpr auto operator&=(const safe rhs) noexcept -> safe&
+        requires is_unsigned
+    {
+        value_ &= rhs.value_;
+        return *this;
+    }
+
+    constexpr auto operator|=(const safe rhs) noexcept -> safe&
+        requires is_unsigned
+    {
+        value_ |= rhs.value_;
+        return *this;
+    }
+
+    constexpr auto operator^=(const safe rhs) noexcept -> safe&
+        requires is_unsigned
+    {
+        value_ ^= rhs.value_;
+        return *this;
+    }
+};
+
+// Views of an array of T as an array of safe<T, Policy> and back.
+// safe<T, Policy> is a standard layout class whose only member is a T, so each element is pointer-interconvertible with its T.
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename T, overflow_policy Policy, std::size_t Extent>
+[[nodiscard]] auto as_value_span(const std::span<safe<T, Policy>, Extent> values) noexcept -> std::span<T, Extent>
+{
+    static_assert(sizeof(safe<T, Policy>) == sizeof(T) && alignof(safe<T, Policy>) == alignof(T) &&
+                  std::is_standard_layout_v<safe<T, Policy>>, "safe<T, Policy> must have the layout of T");
+
+    return std::span<T, Extent>{reinterpret_cast<T*>(values.data()), values.size()};
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <typename T, overflow_policy Policy, std::size_t Extent>
+[[nodiscard]] auto as_value_span(const std::span<const safe<T, Policy>, Extent> values) noexcept -> std::span<const T, Extent>
+{
+    static_assert(sizeof(safe<T, Policy>) == sizeof(T) && alignof(safe<T, Policy>) == alignof(T) &&
+                  std::is_standard_layout_v<safe<T, Policy>>, "safe<T, Policy> must have the layout of T");
+
+    return std::span<const T, Extent>{reinterpret_cast<const T*>(values.data()), values.size()};
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, typename T, std::size_t Extent>
+    requires (!std::is_const_v<T>)
+[[nodiscard]] auto as_safe_span(const std::span<T, Extent> values) noexcept -> std::span<safe<T, Policy>, Extent>
+{
+    static_assert(sizeof(safe<T, Policy>) == sizeof(T) && alignof(safe<T, Policy>) == alignof(T) &&
+                  std::is_standard_layout_v<safe<T, Policy>>, "safe<T, Policy> must have the layout of T");
+
+    return std::span<safe<T, Policy>, Extent>{reinterpret_cast<safe<T, Policy>*>(values.data()), values.size()};
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, typename T, std::size_t Extent>
+[[nodiscard]] auto as_safe_span(const std::span<const T, Extent> values) noexcept -> std::span<const safe<T, Policy>, Extent>
+{
+    static_assert(sizeof(safe<T, Policy>) == sizeof(T) && alignof(safe<T, Policy>) == alignof(T) &&
+                  std::is_standard_layout_v<safe<T, Policy>>, "safe<T, Policy> must have the layout of T");
+
+    return std::span<const safe<T, Policy>, Extent>{reinterpret_cast<const safe<T, Policy>*>(values.data()), values.size()};
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_POLICY_INTEGERS_HPP
@@ -0,0 +1,217 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Arithmetic with an overflow policy chosen at runtime, e.g. from configuration.
+// The policy is dispatched on once per call (or once per lookup of the scalar functions),
+// after which the same code runs as with the policy as a template argument.
+
+#ifndef BOOST_SAFE_NUMBERS_RUNTIME_POLICY_HPP
+#define BOOST_SAFE_NUMBERS_RUNTIME_POLICY_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/policy_integers.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+// The scalar functions of one policy, for the policies whose functions return the operand type
+BOOST_SAFE_NUMBERS_EXPORT template <typename T>
+    requires (detail::is_unsigned_library_type_v<T> || detail::is_signed_library_type_v<T>) && (!detail::is_bounded_type_v<T>)
+struct arithmetic_functions
+{
+    using function_type = T (*)(T, T);
+
+    overflow_policy policy;
+    function_type add;
+    function_type sub;
+    function_type mul;
+    function_type div;
+    function_type mod;
+};
+
+namespace detail {
+
+template <overflow_policy Policy, typename T>
+inline constexpr arithmetic_functions<T> arithmetic_functions_table {
+    Policy,
+    [](const T lhs, const T rhs) -> T { return safe_numbers::add<Policy>(lhs, rhs); },
+    [](const T lhs, const T rhs) -> T { return safe_numbers::sub<Policy>(lhs, rhs); },
+    [](const T lhs, const T rhs) -> T { return safe_numbers::mul<Policy>(lhs, rhs); },
+    [](const T lhs, const T rhs) -> T { return safe_numbers::div<Policy>(lhs, rhs); },
+    [](const T lhs, const T rhs) -> T { return safe_numbers::mod<Policy>(lhs, rhs); },
+};
+
+inline constexpr const char* runtime_scalar_policy_msg {
+    "Only the throw_exception, saturate, strict, sticky, and wrap policies can be selected at runtime for scalar operations"};
+
+inline constexpr const char* runtime_span_policy_msg {
+    "Only the throw_exception, saturate, checked, strict, sticky, and wrap policies can be selected at runtime for span arithmetic"};
+
+namespace impl {
+
+// The single dispatch of a span operation on the runtime policy.
+// Returns false only if the policy is checked and the operation failed.
+template <span_op Op, typename T, typename Rhs>
+constexpr auto span_runtime_policy_impl(const overflow_policy policy,
+                                        const std::span<const T> lhs,
+                                        const Rhs rhs,
+                                        const std::span<T> result) -> bool
+{
+    switch (policy)
+    {
+        case overflow_policy::throw_exception:
+            span_arithmetic_impl<Op, overflow_policy::throw_exception, T>(lhs, rhs, result);
+            return true;
+        case overflow_policy::saturate:
+            span_arithmetic_impl<Op, overflow_policy::saturate, T>(lhs, rhs, result);
+            return true;
+        case overflow_policy::checked:
+            return span_arithmetic_impl<Op, overflow_policy::checked, T>(lhs, rhs, result);
+        case overflow_policy::strict:
+            span_arithmetic_impl<Op, overflow_policy::strict, T>(lhs, rhs, result);
+            return true;
+        case overflow_policy::sticky:
+            span_arithmetic_impl<Op, overflow_policy::sticky, T>(lhs, rhs, result);
+            return true;
+        case overflow_policy::wrap:
+            span_arithmetic_impl<Op, overflow_policy::wrap, T>(lhs, rhs, result);
+            return true;
+        default:
+            break;
+    }
+
+    if (std::is_constant_evaluated())
+    {
+        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, runtime_span_policy_msg);
+    }
+    else
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, runtime_span_policy_msg);
+    }
+
+    return false;
+}
+
+} // namespace impl
+
+} // namespace detail
+
+// Returns the scalar functions of policy, which is throw_exception, saturate, strict, sticky, or wrap.
+// Looking them up once before a loop leaves a single indirect call per element, rather than a dispatch on the policy.
+BOOST_SAFE_NUMBERS_EXPORT template <typename T>
+    requires (detail::is_unsigned_library_type_v<T> || detail::is_signed_library_type_v<T>) && (!detail::is_bounded_type_v<T>)
+[[nodiscard]] constexpr auto arithmetic_functions_for(const overflow_policy policy) -> const arithmetic_functions<T>&
+{
+    switch (policy)
+    {
+        case overflow_policy::throw_exception:
+            return detail::arithmetic_functions_table<overflow_policy::throw_exception, T>;
+        case overflow_policy::saturate:
+            return detail::arithmetic_functions_table<overflow_policy::saturate, T>;
+        case overflow_policy::strict:
+            return detail::arithmetic_functions_table<overflow_policy::strict, T>;
+        case overflow_policy::sticky:
+            return detail::arithmetic_functions_table<overflow_policy::sticky, T>;
+        case overflow_policy::wrap:
+            return detail::arithmetic_functions_table<overflow_policy::wrap, T>;
+        default:
+            break;
+    }
+
+    if (std::is_constant_evaluated())
+    {
+        BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::domain_error, detail::runtime_scalar_policy_msg);
+    }
+    else
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, detail::runtime_scalar_policy_msg);
+    }
+
+    return detail::arithmetic_functions_table<overflow_policy::throw_exception, T>;
+}
+
+// Span arithmetic with the policy given at runtime, which dispatches once to the span function of that policy.
+// The policy is throw_exception, saturate, checked, strict, sticky, or wrap,
+// and the return value is false only if the policy is checked and an element overflowed or the sizes differ.
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto add(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::add, T>(policy, lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto sub(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::sub, T>(policy, lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto mul(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::mul, T>(policy, lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shl(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::shl, T>(policy, lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shl(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::type_identity_t<T> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::shl, T>(policy, lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shr(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::shr, T>(policy, lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shr(const overflow_policy policy,
+                   const std::span<const std::type_identity_t<T>> lhs,
+                   const std::type_identity_t<T> rhs,
+                   const std::span<T, Extent> result) -> bool
+{
+    return detail::impl::span_runtime_policy_impl<detail::impl::span_op::shr, T>(policy, lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_RUNTIME_POLICY_HPP
@@ -0,0 +1,1174 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_SPAN_ARITHMETIC_HPP
+#define BOOST_SAFE_NUMBERS_SPAN_ARITHMETIC_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/error_context.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail::impl {
+
+enum class span_op
+{
+    add,
+    sub,
+    mul,
+    shl,
+    shr,
+};
+
+// The operation reported to the overflow handlers for errors of each span operation
+template <span_op Op>
+constexpr auto span_arithmetic_op() noexcept -> arithmetic_op
+{
+    if constexpr (Op == span_op::add)
+    {
+        return arithmetic_op::add;
+    }
+    else if constexpr (Op == span_op::sub)
+    {
+        return arithmetic_op::sub;
+    }
+    else if constexpr (Op == span_op::mul)
+    {
+        return arithmetic_op::mul;
+    }
+    else if constexpr (Op == span_op::shl)
+    {
+        return arithmetic_op::shl;
+    }
+    else
+    {
+        return arithmetic_op::shr;
+    }
+}
+
+// The lane type is the unsigned type of the same width as the basis type.
+// All lane arithmetic is performed in it so that wrapping is well-defined,
+// and every lane operation is a plain add, sub, mul, xor, and, or shift that the
+// optimizer can map onto vector registers.
+template <typename BasisType>
+struct span_lane
+{
+    using type = BasisType;
+};
+
+template <fundamental_signed_integral BasisType>
+struct span_lane<BasisType>
+{
+    using type = make_unsigned_helper_t<BasisType>;
+};
+
+template <typename BasisType>
+using span_lane_t = typename span_lane<BasisType>::type;
+
+template <typename BasisType>
+[[nodiscard]] constexpr auto span_lane_mask(const bool overflowed) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+    return static_cast<lane_type>(lane_type{0} - static_cast<lane_type>(overflowed));
+}
+
+// A single rhs value applied to every element, such as a uniform shift amount.
+// It is indexed like a span so that the kernels accept either as rhs.
+template <typename T>
+struct span_uniform_operand
+{
+    T value;
+
+    [[nodiscard]] constexpr auto operator[](std::size_t) const noexcept -> T { return value; }
+};
+
+template <typename T>
+[[nodiscard]] constexpr auto span_operand_fits(const std::span<const T> rhs, const std::size_t size) noexcept -> bool
+{
+    return rhs.size() == size;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto span_operand_fits(const span_uniform_operand<T>, std::size_t) noexcept -> bool
+{
+    return true;
+}
+
+// True when result shares any element with the operand, either in place or at an offset.
+// std::less gives a total order over pointers into unrelated arrays.
+template <typename T>
+[[nodiscard]] constexpr auto span_operand_aliases(const std::span<const T> operand, const std::span<T> result) noexcept -> bool
+{
+    const std::less<const T*> before {};
+    return before(operand.data(), result.data() + result.size()) &&
+           before(result.data(), operand.data() + operand.size());
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto span_operand_aliases(const span_uniform_operand<T>, std::span<T>) noexcept -> bool
+{
+    return false;
+}
+
+// Multiplication of types up to 32 bits is done in the promoted type,
+// so the full product is available and overflow is a test of its high half.
+// This maps onto widening vector multiplies (e.g. pmuludq, pmullw/pmulhw).
+// 64 and 128-bit lanes have no vector equivalent and use the scalar primitives instead.
+template <typename BasisType>
+[[nodiscard]] constexpr auto span_lane_mul(const span_lane_t<BasisType> lhs,
+                                           const span_lane_t<BasisType> rhs,
+                                           span_lane_t<BasisType>& overflow_mask) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    if constexpr (sizeof(BasisType) <= sizeof(std::uint32_t))
+    {
+        if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+        {
+            using wide_type = promoted_type<BasisType>;
+
+            const auto wide {static_cast<wide_type>(static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs))};
+            const auto high {static_cast<lane_type>(wide >> std::numeric_limits<BasisType>::digits)};
+            overflow_mask = span_lane_mask<BasisType>(high != 0U);
+            return static_cast<lane_type>(wide);
+        }
+        else
+        {
+            using wide_type = signed_promoted_type<BasisType>;
+
+            const auto wide {static_cast<wide_type>(static_cast<wide_type>(static_cast<BasisType>(lhs)) *
+                                                    static_cast<wide_type>(static_cast<BasisType>(rhs)))};
+            const auto res {static_cast<lane_type>(wide)};
+
+            // The product fits if the high half is the sign extension of the low half.
+            // Both halves are compared in the lane type so that the test stays in narrow vector lanes.
+            const auto high {static_cast<lane_type>(wide >> std::numeric_limits<lane_type>::digits)};
+            const auto sign_extension {static_cast<lane_type>(lane_type{0} - static_cast<lane_type>(res >> std::numeric_limits<BasisType>::digits))};
+            overflow_mask = span_lane_mask<BasisType>(high != sign_extension);
+            return res;
+        }
+    }
+    else
+    {
+        if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+        {
+            lane_type res {};
+            overflow_mask = span_lane_mask<BasisType>(no_intrin_mul(lhs, rhs, res));
+            return res;
+        }
+        else
+        {
+            BasisType res {};
+            const auto status {signed_no_intrin_mul(static_cast<BasisType>(lhs), static_cast<BasisType>(rhs), res)};
+            overflow_mask = span_lane_mask<BasisType>(status != signed_overflow_status::no_error);
+            return static_cast<lane_type>(res);
+        }
+    }
+}
+
+// x86 has per-lane variable shifts only for 32 and 64-bit lanes (vpsllvd and vpsllvq with AVX2), and none at all with SSE2,
+// so 8 and 16-bit lanes are shifted by each power of two in turn instead, which needs only count shifts and selects.
+// NEON has variable shifts of every width (vshlq).
+#if defined(BOOST_SAFE_NUMBERS_HAS_NEON_INTRIN)
+template <typename BasisType>
+inline constexpr bool span_shift_by_steps_v {false};
+#else
+template <typename BasisType>
+inline constexpr bool span_shift_by_steps_v {sizeof(BasisType) <= sizeof(std::uint16_t)};
+#endif
+
+// Shifts are only defined for unsigned types, and both directions overflow when the shift amount is at least the type width.
+// A left shift also overflows when bit_width(lhs) + rhs >= digits, as the scalar operator does,
+// which is the same as a bit being shifted out of the lane or into its top bit, or lhs >> (digits - 1 - rhs) being non-zero.
+// The amount is masked to the type width so that no lane shift is undefined, and out of width lanes are then cleared.
+// When the amount is uniform, the variable shifts become a single count shift (psllw, pslld, psllq).
+template <span_op Op, typename BasisType>
+[[nodiscard]] constexpr auto span_lane_shift(const span_lane_t<BasisType> lhs,
+                                             const span_lane_t<BasisType> rhs,
+                                             span_lane_t<BasisType>& overflow_mask) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    constexpr auto digits {static_cast<lane_type>(std::numeric_limits<BasisType>::digits)};
+    constexpr auto max_amount {static_cast<lane_type>(digits - lane_type{1U})};
+
+    const auto out_of_width {span_lane_mask<BasisType>(rhs >= digits)};
+
+    lane_type res {};
+    lane_type lost_bits {};
+
+    if constexpr (span_shift_by_steps_v<BasisType>)
+    {
+        res = lhs;
+
+        // Unrolled so that the element loop vectorizes
+        const auto shift_step {[&](const lane_type step) noexcept
+        {
+            const auto selected {span_lane_mask<BasisType>((rhs & step) != lane_type{0U})};
+
+            if constexpr (Op == span_op::shl)
+            {
+                lost_bits |= static_cast<lane_type>(static_cast<lane_type>(res >> static_cast<lane_type>(digits - step)) & selected);
+                res = static_cast<lane_type>((static_cast<lane_type>(res << step) & selected) | (res & static_cast<lane_type>(~selected)));
+            }
+            else
+            {
+                res = static_cast<lane_type>((static_cast<lane_type>(res >> step) & selected) | (res & static_cast<lane_type>(~selected)));
+            }
+        }};
+
+        [&]<std::size_t... Steps>(std::index_sequence<Steps...>) noexcept
+        {
+            (shift_step(static_cast<lane_type>(lane_type{1U} << Steps)), ...);
+        }(std::make_index_sequence<static_cast<std::size_t>(std::bit_width(static_cast<unsigned>(max_amount)))>{});
+
+        lost_bits |= static_cast<lane_type>(res >> max_amount);
+    }
+    else
+    {
+        const auto amount {static_cast<lane_type>(rhs & max_amount)};
+
+        if constexpr (Op == span_op::shl)
+        {
+            lost_bits = static_cast<lane_type>(lhs >> static_cast<lane_type>(max_amount - amount));
+            res = static_cast<lane_type>(lhs << amount);
+        }
+        else
+        {
+            res = static_cast<lane_type>(lhs >> amount);
+        }
+    }
+
+    if constexpr (Op == span_op::shl)
+    {
+        overflow_mask = static_cast<lane_type>(out_of_width | span_lane_mask<BasisType>(lost_bits != lane_type{0U}));
+    }
+    else
+    {
+        overflow_mask = out_of_width;
+    }
+
+    return static_cast<lane_type>(res & static_cast<lane_type>(~out_of_width));
+}
+
+// Computes the wrapped result of a single lane,
+// and sets overflow_mask to all ones if the operation overflowed and to zero otherwise
+template <span_op Op, typename BasisType>
+[[nodiscard]] constexpr auto span_lane_op(const span_lane_t<BasisType> lhs,
+                                          const span_lane_t<BasisType> rhs,
+                                          span_lane_t<BasisType>& overflow_mask) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    if constexpr (Op == span_op::mul)
+    {
+        return span_lane_mul<BasisType>(lhs, rhs, overflow_mask);
+    }
+    else if constexpr (Op == span_op::shl || Op == span_op::shr)
+    {
+        return span_lane_shift<Op, BasisType>(lhs, rhs, overflow_mask);
+    }
+    else
+    {
+        const auto res {Op == span_op::add ? static_cast<lane_type>(lhs + rhs) : static_cast<lane_type>(lhs - rhs)};
+
+        if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+        {
+            overflow_mask = span_lane_mask<BasisType>(Op == span_op::add ? res < lhs : res > lhs);
+        }
+        else
+        {
+            // Addition overflows when both operands share a sign and the result does not,
+            // subtraction when the operands differ in sign and the result differs from lhs
+            const auto sign_bits {Op == span_op::add ?
+                                  static_cast<lane_type>(~(lhs ^ rhs) & (lhs ^ res)) :
+                                  static_cast<lane_type>((lhs ^ rhs) & (lhs ^ res))};
+
+            overflow_mask = static_cast<lane_type>(lane_type{0} - static_cast<lane_type>(sign_bits >> std::numeric_limits<BasisType>::digits));
+        }
+
+        return res;
+    }
+}
+
+// Computes the wrapped result of a single lane without an overflow test.
+// The overflow masks of add, sub, and shifts are removed as dead code when unused,
+// but mul would otherwise still compute the full width product to find them.
+template <span_op Op, typename BasisType>
+[[nodiscard]] constexpr auto span_lane_wrapping_op(const span_lane_t<BasisType> lhs,
+                                                   const span_lane_t<BasisType> rhs) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    if constexpr (Op == span_op::mul)
+    {
+        using promoted_type = wrapping_promoted_t<lane_type>;
+        return static_cast<lane_type>(static_cast<promoted_type>(lhs) * static_cast<promoted_type>(rhs));
+    }
+    else
+    {
+        lane_type overflow_mask {};
+        return span_lane_op<Op, BasisType>(lhs, rhs, overflow_mask);
+    }
+}
+
+// The value a lane saturates to when it overflows
+template <span_op Op, typename BasisType>
+[[nodiscard]] constexpr auto span_lane_saturation_value(const span_lane_t<BasisType> lhs,
+                                                        const span_lane_t<BasisType> rhs) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+    {
+        static_cast<void>(lhs);
+        static_cast<void>(rhs);
+        return Op == span_op::sub || Op == span_op::shr ? lane_type{0} : std::numeric_limits<lane_type>::max();
+    }
+    else
+    {
+        // Signed add and sub can only overflow in the direction of lhs,
+        // and mul in the direction of the sign of the product.
+        // The saturation value is max for a positive direction and max + 1 (== min) for a negative one.
+        const auto negative_bits {Op == span_op::mul ? static_cast<lane_type>(lhs ^ rhs) : lhs};
+
+        return static_cast<lane_type>(static_cast<lane_type>(std::numeric_limits<BasisType>::max()) +
+                                      static_cast<lane_type>(negative_bits >> std::numeric_limits<BasisType>::digits));
+    }
+}
+
+// All ones if a lane that overflows does so towards min, and zero if it does so towards max.
+// Unsigned subtraction is the only unsigned operation that underflows,
+// and signed operations fail in the same direction as their saturation value.
+template <span_op Op, typename BasisType>
+[[nodiscard]] constexpr auto span_lane_underflow_mask(const span_lane_t<BasisType> lhs,
+                                                      const span_lane_t<BasisType> rhs) noexcept -> span_lane_t<BasisType>
+{
+    using lane_type = span_lane_t<BasisType>;
+
+    if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+    {
+        static_cast<void>(lhs);
+        static_cast<void>(rhs);
+        return span_lane_mask<BasisType>(Op == span_op::sub);
+    }
+    else
+    {
+        const auto negative_bits {Op == span_op::mul ? static_cast<lane_type>(lhs ^ rhs) : lhs};
+        return static_cast<lane_type>(lane_type{0} - static_cast<lane_type>(negative_bits >> std::numeric_limits<BasisType>::digits));
+    }
+}
+
+// 8 and 16-bit saturating add and sub have dedicated vector instructions
+// (paddusb, psubsw, vqaddq_u8, ...) which compilers do not reliably select from the generic lane code.
+// These process as many full vectors as fit, and return the number of elements processed.
+template <span_op Op, typename BasisType>
+inline constexpr bool has_saturating_vector_op_v {(Op == span_op::add || Op == span_op::sub) && sizeof(BasisType) <= sizeof(std::uint16_t)};
+
+#if defined(BOOST_SAFE_NUMBERS_HAS_SSE2_INTRIN)
+
+// GCC diagnoses the unaligned vector loads as out of bounds when inlined into a call
+// whose span is shorter than one vector, even though the loop body is then never executed
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+template <span_op Op, typename BasisType>
+inline auto saturating_vector_op(const __m128i lhs, const __m128i rhs) noexcept -> __m128i
+{
+    if constexpr (std::is_same_v<BasisType, std::uint8_t>)
+    {
+        return Op == span_op::add ? _mm_adds_epu8(lhs, rhs) : _mm_subs_epu8(lhs, rhs);
+    }
+    else if constexpr (std::is_same_v<BasisType, std::uint16_t>)
+    {
+        return Op == span_op::add ? _mm_adds_epu16(lhs, rhs) : _mm_subs_epu16(lhs, rhs);
+    }
+    else if constexpr (std::is_same_v<BasisType, std::int8_t>)
+    {
+        return Op == span_op::add ? _mm_adds_epi8(lhs, rhs) : _mm_subs_epi8(lhs, rhs);
+    }
+    else
+    {
+        static_assert(std::is_same_v<BasisType, std::int16_t>, "No saturating vector instruction for this type");
+        return Op == span_op::add ? _mm_adds_epi16(lhs, rhs) : _mm_subs_epi16(lhs, rhs);
+    }
+}
+
+template <span_op Op, typename T>
+auto span_saturating_vector_kernel(const std::span<const T> lhs,
+                                   const std::span<const T> rhs,
+                                   const std::span<T> result) noexcept -> std::size_t
+{
+    using basis_type = underlying_type_t<T>;
+    static_assert(sizeof(T) == sizeof(basis_type), "Library types must have the same layout as their basis type");
+
+    constexpr std::size_t lanes {sizeof(__m128i) / sizeof(T)};
+
+    const std::size_t vector_end {lhs.size() - lhs.size() % lanes};
+
+    std::size_t i {};
+    for (; i < vector_end; i += lanes)
+    {
+        const auto lhs_vec {_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.data() + i))};
+        const auto rhs_vec {_mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.data() + i))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + i), saturating_vector_op<Op, basis_type>(lhs_vec, rhs_vec));
+    }
+
+    return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+#elif defined(BOOST_SAFE_NUMBERS_HAS_NEON_INTRIN)
+
+template <span_op Op, typename T>
+auto span_saturating_vector_kernel(const std::span<const T> lhs,
+                                   const std::span<const T> rhs,
+                                   const std::span<T> result) noexcept -> std::size_t
+{
+    using basis_type = underlying_type_t<T>;
+    static_assert(sizeof(T) == sizeof(basis_type), "Library types must have the same layout as their basis type");
+
+    constexpr std::size_t lanes {16U / sizeof(T)};
+
+    const auto lhs_ptr {reinterpret_cast<const basis_type*>(lhs.data())};
+    const auto rhs_ptr {reinterpret_cast<const basis_type*>(rhs.data())};
+    const auto res_ptr {reinterpret_cast<basis_type*>(result.data())};
+
+    const std::size_t vector_end {lhs.size() - lhs.size() % lanes};
+
+    std::size_t i {};
+    for (; i < vector_end; i += lanes)
+    {
+        if constexpr (std::is_same_v<basis_type, std::uint8_t>)
+        {
+            const auto lhs_vec {vld1q_u8(lhs_ptr + i)};
+            const auto rhs_vec {vld1q_u8(rhs_ptr + i)};
+            vst1q_u8(res_ptr + i, Op == span_op::add ? vqaddq_u8(lhs_vec, rhs_vec) : vqsubq_u8(lhs_vec, rhs_vec));
+        }
+        else if constexpr (std::is_same_v<basis_type, std::uint16_t>)
+        {
+            const auto lhs_vec {vld1q_u16(lhs_ptr + i)};
+            const auto rhs_vec {vld1q_u16(rhs_ptr + i)};
+            vst1q_u16(res_ptr + i, Op == span_op::add ? vqaddq_u16(lhs_vec, rhs_vec) : vqsubq_u16(lhs_vec, rhs_vec));
+        }
+        else if constexpr (std::is_same_v<basis_type, std::int8_t>)
+        {
+            const auto lhs_vec {vld1q_s8(lhs_ptr + i)};
+            const auto rhs_vec {vld1q_s8(rhs_ptr + i)};
+            vst1q_s8(res_ptr + i, Op == span_op::add ? vqaddq_s8(lhs_vec, rhs_vec) : vqsubq_s8(lhs_vec, rhs_vec));
+        }
+        else
+        {
+            static_assert(std::is_same_v<basis_type, std::int16_t>, "No saturating vector instruction for this type");
+            const auto lhs_vec {vld1q_s16(lhs_ptr + i)};
+            const auto rhs_vec {vld1q_s16(rhs_ptr + i)};
+            vst1q_s16(res_ptr + i, Op == span_op::add ? vqaddq_s16(lhs_vec, rhs_vec) : vqsubq_s16(lhs_vec, rhs_vec));
+        }
+    }
+
+    return i;
+}
+
+#else
+
+template <span_op Op, typename T>
+auto span_saturating_vector_kernel(const std::span<const T>, const std::span<const T>, const std::span<T>) noexcept -> std::size_t
+{
+    return 0U;
+}
+
+#endif
+
+// Processes the whole span without any branch in the loop body.
+// The per-lane overflow masks are OR-reduced, and the return value is no_error if no lane overflowed.
+// With the throw_exception policy the masks of lanes failing towards max and towards min are reduced separately,
+// so that the error can still be classified once an in place operation has overwritten its inputs.
+// Which lane failed first is not known, so underflow is returned only when no lane failed towards max.
+// The return value is not meaningful for the saturate and wrap policies.
+template <span_op Op, overflow_policy Policy, typename T, typename Rhs>
+[[nodiscard]] constexpr auto span_kernel(const std::span<const T> lhs,
+                                         const Rhs rhs,
+                                         const std::span<T> result) noexcept -> signed_overflow_status
+{
+    using basis_type = underlying_type_t<T>;
+    using lane_type = span_lane_t<basis_type>;
+
+    lane_type overflow_reduction {};
+    lane_type underflow_reduction {};
+    std::size_t first {};
+
+    if constexpr (Policy == overflow_policy::saturate && has_saturating_vector_op_v<Op, basis_type>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            first = span_saturating_vector_kernel<Op>(lhs, rhs, result);
+        }
+    }
+
+    for (std::size_t i {first}; i < lhs.size(); ++i)
+    {
+        const auto lhs_lane {static_cast<lane_type>(static_cast<basis_type>(lhs[i]))};
+        const auto rhs_lane {static_cast<lane_type>(static_cast<basis_type>(rhs[i]))};
+
+        if constexpr (Policy == overflow_policy::wrap)
+        {
+            result[i] = T{static_cast<basis_type>(span_lane_wrapping_op<Op, basis_type>(lhs_lane, rhs_lane))};
+            continue;
+        }
+
+        lane_type overflow_mask {};
+        auto res {span_lane_op<Op, basis_type>(lhs_lane, rhs_lane, overflow_mask)};
+
+        if constexpr (Policy == overflow_policy::saturate)
+        {
+            const auto saturated {span_lane_saturation_value<Op, basis_type>(lhs_lane, rhs_lane)};
+            res = static_cast<lane_type>((res & static_cast<lane_type>(~overflow_mask)) | (saturated & overflow_mask));
+        }
+
+        if constexpr (Policy == overflow_policy::throw_exception)
+        {
+            const auto underflow_mask {static_cast<lane_type>(overflow_mask & span_lane_underflow_mask<Op, basis_type>(lhs_lane, rhs_lane))};
+            overflow_mask = static_cast<lane_type>(overflow_mask & static_cast<lane_type>(~underflow_mask));
+            underflow_reduction |= underflow_mask;
+        }
+
+        overflow_reduction |= overflow_mask;
+        result[i] = T{static_cast<basis_type>(res)};
+    }
+
+    if (overflow_reduction != lane_type{0})
+    {
+        return signed_overflow_status::overflow;
+    }
+
+    return underflow_reduction != lane_type{0} ? signed_overflow_status::underflow : signed_overflow_status::no_error;
+}
+
+// Same as the kernel above with wrapping results, but also records the overflow mask of every element
+// as one bit of a 64-bit word. Each block of 64 elements first stores one flag byte per element,
+// which keeps the lane loop vectorizable, and the flags are then packed 8 at a time into the word.
+inline constexpr std::size_t overflow_bitmap_word_bits {64U};
+
+[[nodiscard]] constexpr auto pack_overflow_flags(const std::array<std::uint8_t, overflow_bitmap_word_bits>& flags) noexcept -> std::uint64_t
+{
+    std::uint64_t bits {};
+
+    if (std::is_constant_evaluated() || std::endian::native != std::endian::little)
+    {
+        for (std::size_t i {}; i < flags.size(); ++i)
+        {
+            bits |= static_cast<std::uint64_t>(flags[i]) << i;
+        }
+    }
+    else
+    {
+        // With each byte of octet holding 0 or 1, the multiply gathers byte j into bit 56 + j
+        constexpr std::uint64_t gather {UINT64_C(0x0102040810204080)};
+
+        for (std::size_t i {}; i < flags.size(); i += 8U)
+        {
+            std::uint64_t octet;
+            std::memcpy(&octet, flags.data() + i, sizeof(octet));
+            bits |= ((octet * gather) >> 56U) << i;
+        }
+    }
+
+    return bits;
+}
+
+template <span_op Op, typename T, typename Rhs>
+[[nodiscard]] constexpr auto span_bitmap_kernel(const std::span<const T> lhs,
+                                                const Rhs rhs,
+                                                const std::span<T> result,
+                                                const std::span<std::uint64_t> overflow_bitmap) noexcept -> bool
+{
+    using basis_type = underlying_type_t<T>;
+    using lane_type = span_lane_t<basis_type>;
+
+    std::uint64_t overflow_reduction {};
+
+    for (std::size_t first {}, word {}; first < lhs.size(); first += overflow_bitmap_word_bits, ++word)
+    {
+        const auto block_size {lhs.size() - first < overflow_bitmap_word_bits ? lhs.size() - first : overflow_bitmap_word_bits};
+
+        std::array<std::uint8_t, overflow_bitmap_word_bits> flags {};
+        for (std::size_t i {}; i < block_size; ++i)
+        {
+            const auto lhs_lane {static_cast<lane_type>(static_cast<basis_type>(lhs[first + i]))};
+            const auto rhs_lane {static_cast<lane_type>(static_cast<basis_type>(rhs[first + i]))};
+
+            lane_type overflow_mask {};
+            const auto res {span_lane_op<Op, basis_type>(lhs_lane, rhs_lane, overflow_mask)};
+
+            flags[i] = static_cast<std::uint8_t>(overflow_mask & lane_type{1});
+            result[first + i] = T{static_cast<basis_type>(res)};
+        }
+
+        const auto overflow_bits {pack_overflow_flags(flags)};
+        overflow_bitmap[word] = overflow_bits;
+        overflow_reduction |= overflow_bits;
+    }
+
+    return overflow_reduction != 0U;
+}
+
+template <span_op Op, typename BasisType>
+constexpr auto span_overflow_msg() noexcept -> const char*
+{
+    if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+    {
+        if constexpr (Op == span_op::add)
+        {
+            return overflow_add_msg<BasisType>();
+        }
+        else if constexpr (Op == span_op::sub)
+        {
+            return underflow_sub_msg<BasisType>();
+        }
+        else if constexpr (Op == span_op::shl)
+        {
+            return left_shift_overflow_msg<BasisType>();
+        }
+        else if constexpr (Op == span_op::shr)
+        {
+            return right_shift_overflow_msg<BasisType>();
+        }
+        else
+        {
+            return overflow_mul_msg<BasisType>();
+        }
+    }
+    else
+    {
+        if constexpr (Op == span_op::add)
+        {
+            return signed_overflow_add_msg<BasisType>();
+        }
+        else if constexpr (Op == span_op::sub)
+        {
+            return signed_overflow_sub_msg<BasisType>();
+        }
+        else
+        {
+            return signed_overflow_mul_msg<BasisType>();
+        }
+    }
+}
+
+template <span_op Op, typename BasisType>
+constexpr auto span_underflow_msg() noexcept -> const char*
+{
+    if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+    {
+        return underflow_sub_msg<BasisType>();
+    }
+    else
+    {
+        if constexpr (Op == span_op::add)
+        {
+            return signed_underflow_add_msg<BasisType>();
+        }
+        else if constexpr (Op == span_op::sub)
+        {
+            return signed_underflow_sub_msg<BasisType>();
+        }
+        else
+        {
+            return signed_underflow_mul_msg<BasisType>();
+        }
+    }
+}
+
+// Classifies a single element with the scalar primitives.
+// Unsigned subtraction is the only unsigned operation that underflows.
+template <span_op Op, typename BasisType>
+constexpr auto span_scalar_status(const BasisType lhs, const BasisType rhs) noexcept -> signed_overflow_status
+{
+    BasisType res {};
+
+    if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+    {
+        if constexpr (Op == span_op::add)
+        {
+            return unsigned_no_intrin_add(lhs, rhs, res) ? signed_overflow_status::overflow : signed_overflow_status::no_error;
+        }
+        else if constexpr (Op == span_op::sub)
+        {
+            return unsigned_no_intrin_sub(lhs, rhs, res) ? signed_overflow_status::underflow : signed_overflow_status::no_error;
+        }
+        else if constexpr (Op == span_op::shl || Op == span_op::shr)
+        {
+            using basis = unsigned_integer_basis<BasisType>;
+            const auto overflowed {Op == span_op::shl ?
+                                   shl_helper<overflow_policy::overflow_tuple, BasisType>::apply(basis{lhs}, basis{rhs}).second :
+                                   shr_helper<overflow_policy::overflow_tuple, BasisType>::apply(basis{lhs}, basis{rhs}).second};
+
+            return overflowed ? signed_overflow_status::overflow : signed_overflow_status::no_error;
+        }
+        else
+        {
+            return no_intrin_mul(lhs, rhs, res) ? signed_overflow_status::overflow : signed_overflow_status::no_error;
+        }
+    }
+    else
+    {
+        if constexpr (Op == span_op::add)
+        {
+            return signed_no_intrin_add(lhs, rhs, res);
+        }
+        else if constexpr (Op == span_op::sub)
+        {
+            return signed_no_intrin_sub(lhs, rhs, res);
+        }
+        else
+        {
+            return signed_no_intrin_mul(lhs, rhs, res);
+        }
+    }
+}
+
+inline auto append_span_index(const char* msg, const std::size_t index) noexcept -> message_buffer<arithmetic_error_message_capacity>
+{
+    message_buffer<arithmetic_error_message_capacity> res {msg};
+    res.append(" at index ").append(index);
+    return res;
+}
+
+// Only called once the kernel has reported that at least one lane overflowed.
+// Re-scans the inputs with the scalar primitives to find the first offending index,
+// and reports it with its operands and the same exception type the scalar operator would have.
+// Callers only rescan when the result does not overlap either input;
+// if no offending element is found anyway the error is reported without an index.
+template <span_op Op, typename T, typename Rhs>
+void span_report_first_error(const std::span<const T> lhs, const Rhs rhs)
+{
+    using basis_type = underlying_type_t<T>;
+
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        const auto lhs_basis {static_cast<basis_type>(lhs[i])};
+        const auto rhs_basis {static_cast<basis_type>(rhs[i])};
+        const auto status {span_scalar_status<Op>(lhs_basis, rhs_basis)};
+
+        if (status == signed_overflow_status::overflow)
+        {
+            BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, append_span_index(span_overflow_msg<Op, basis_type>(), i),
+                                                      span_arithmetic_op<Op>(), lhs_basis, rhs_basis);
+        }
+        else if (status == signed_overflow_status::underflow)
+        {
+            BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::underflow_error, append_span_index(span_underflow_msg<Op, basis_type>(), i),
+                                                      span_arithmetic_op<Op>(), lhs_basis, rhs_basis);
+        }
+    }
+
+    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, (span_overflow_msg<Op, basis_type>()));
+}
+
+template <span_op Op, overflow_policy Policy, typename T, typename Rhs>
+constexpr auto span_arithmetic_impl(const std::span<const T> lhs,
+                                    const Rhs rhs,
+                                    const std::span<T> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    using basis_type = underlying_type_t<T>;
+
+    static_assert(Policy == overflow_policy::throw_exception ||
+                  Policy == overflow_policy::saturate ||
+                  Policy == overflow_policy::checked ||
+                  Policy == overflow_policy::strict ||
+                  Policy == overflow_policy::sticky ||
+                  Policy == overflow_policy::wrap,
+                  "Policy is not supported for span arithmetic (the span overloads of overflowing_add/sub/mul replace overflow_tuple)");
+
+    if (!span_operand_fits(rhs, lhs.size()) || lhs.size() != result.size())
+    {
+        if constexpr (Policy == overflow_policy::checked)
+        {
+            return false;
+        }
+        else if constexpr (Policy == overflow_policy::strict)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+        else
+        {
+            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Span arithmetic requires lhs, rhs, and result to have the same size");
+        }
+    }
+
+    const auto status {span_kernel<Op, Policy>(lhs, rhs, result)};
+    const auto overflowed {status != signed_overflow_status::no_error};
+
+    if constexpr (Policy == overflow_policy::throw_exception)
+    {
+        if (overflowed)
+        {
+            if (std::is_constant_evaluated())
+            {
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, (span_overflow_msg<Op, basis_type>()));
+            }
+            else if (span_operand_aliases(lhs, result) || span_operand_aliases(rhs, result))
+            {
+                // The result overlaps an input so the inputs needed to find the index may be gone,
+                // but the kernel still knows the direction of the failure
+                if (status == signed_overflow_status::underflow)
+                {
+                    BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::underflow_error, (span_underflow_msg<Op, basis_type>()));
+                }
+
+                BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::overflow_error, (span_overflow_msg<Op, basis_type>()));
+            }
+            else
+            {
+                span_report_first_error<Op>(lhs, rhs);
+            }
+        }
+    }
+    else if constexpr (Policy == overflow_policy::strict)
+    {
+        if (overflowed)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    else if constexpr (Policy == overflow_policy::checked)
+    {
+        return !overflowed;
+    }
+    else if constexpr (Policy == overflow_policy::sticky)
+    {
+        // The whole span is recorded with a single access to the thread local context
+        if (std::is_constant_evaluated())
+        {
+            if (overflowed)
+            {
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, (span_overflow_msg<Op, basis_type>()));
+            }
+        }
+        else
+        {
+            thread_error_context().record(overflowed);
+        }
+    }
+    else
+    {
+        static_cast<void>(overflowed);
+    }
+}
+
+template <span_op Op, typename T, typename Rhs>
+constexpr auto span_overflowing_impl(const std::span<const T> lhs,
+                                     const Rhs rhs,
+                                     const std::span<T> result,
+                                     const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    if (!span_operand_fits(rhs, lhs.size()) || lhs.size() != result.size())
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Span arithmetic requires lhs, rhs, and result to have the same size");
+    }
+
+    if (overflow_bitmap.size() < (lhs.size() + overflow_bitmap_word_bits - 1U) / overflow_bitmap_word_bits)
+    {
+        BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Overflow bitmap is too small to hold one bit per element");
+    }
+
+    return span_bitmap_kernel<Op>(lhs, rhs, result, overflow_bitmap);
+}
+
+} // namespace boost::safe_numbers::detail::impl
+
+namespace boost::safe_numbers {
+
+// Number of 64-bit words required to hold one overflow bit for each of size elements
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] constexpr auto overflow_bitmap_size(const std::size_t size) noexcept -> std::size_t
+{
+    return (size + detail::impl::overflow_bitmap_word_bits - 1U) / detail::impl::overflow_bitmap_word_bits;
+}
+
+// The element type is deduced from result only,
+// so that lhs and rhs accept anything convertible to a span of const elements (e.g. a std::vector or std::array)
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto add(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::add, Policy, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto sub(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::sub, Policy, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto mul(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::mul, Policy, T>(lhs, rhs, result);
+}
+
+// Span equivalents of the scalar saturating functions.
+// 8 and 16-bit add and sub use the hardware saturating vector instructions where available.
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto saturating_add(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::add, overflow_policy::saturate, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto saturating_sub(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::sub, overflow_policy::saturate, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto saturating_mul(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::mul, overflow_policy::saturate, T>(lhs, rhs, result);
+}
+
+// Span equivalents of the scalar wrapping functions, which write the same results as the overflowing functions
+// without computing or storing the overflow of each element.
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto wrapping_add(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::span<const std::type_identity_t<T>> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::add, overflow_policy::wrap, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto wrapping_sub(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::span<const std::type_identity_t<T>> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::sub, overflow_policy::wrap, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto wrapping_mul(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::span<const std::type_identity_t<T>> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::mul, overflow_policy::wrap, T>(lhs, rhs, result);
+}
+
+// Span equivalents of the scalar overflowing functions.
+// Instead of a pair per element, the wrapped results are written to result,
+// and bit (i % 64) of overflow_bitmap[i / 64] is set if element i overflowed.
+// Returns true if any element overflowed.
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto overflowing_add(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::span<const std::type_identity_t<T>> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::add, T>(lhs, rhs, result, overflow_bitmap);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto overflowing_sub(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::span<const std::type_identity_t<T>> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::sub, T>(lhs, rhs, result, overflow_bitmap);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_integral_library_type T, std::size_t Extent>
+constexpr auto overflowing_mul(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::span<const std::type_identity_t<T>> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::mul, T>(lhs, rhs, result, overflow_bitmap);
+}
+
+// Span equivalents of the shift operators, which as with the scalar operators are only defined for the unsigned types.
+// The shift amount is either one per element in rhs, or a single amount applied to every element.
+// A shift overflows as the scalar one does: when rhs is at least the type width,
+// and for a left shift also when bits of lhs would be shifted out.
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shl(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, Policy, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shl(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::type_identity_t<T> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, Policy, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shr(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::span<const std::type_identity_t<T>> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, Policy, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto shr(const std::span<const std::type_identity_t<T>> lhs,
+                   const std::type_identity_t<T> rhs,
+                   const std::span<T, Extent> result)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, Policy, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto saturating_shl(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, overflow_policy::saturate, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto saturating_shl(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::type_identity_t<T> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, overflow_policy::saturate, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto saturating_shr(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, overflow_policy::saturate, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto saturating_shr(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::type_identity_t<T> rhs,
+                              const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, overflow_policy::saturate, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto wrapping_shl(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::span<const std::type_identity_t<T>> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, overflow_policy::wrap, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto wrapping_shl(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::type_identity_t<T> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shl, overflow_policy::wrap, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto wrapping_shr(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::span<const std::type_identity_t<T>> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, overflow_policy::wrap, T>(lhs, rhs, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto wrapping_shr(const std::span<const std::type_identity_t<T>> lhs,
+                            const std::type_identity_t<T> rhs,
+                            const std::span<T, Extent> result) -> void
+{
+    detail::impl::span_arithmetic_impl<detail::impl::span_op::shr, overflow_policy::wrap, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto overflowing_shl(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::span<const std::type_identity_t<T>> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::shl, T>(lhs, rhs, result, overflow_bitmap);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto overflowing_shl(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::type_identity_t<T> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::shl, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result, overflow_bitmap);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto overflowing_shr(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::span<const std::type_identity_t<T>> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::shr, T>(lhs, rhs, result, overflow_bitmap);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <detail::non_bounded_unsigned_library_type T, std::size_t Extent>
+constexpr auto overflowing_shr(const std::span<const std::type_identity_t<T>> lhs,
+                               const std::type_identity_t<T> rhs,
+                               const std::span<T, Extent> result,
+                               const std::span<std::uint64_t> overflow_bitmap) -> bool
+{
+    return detail::impl::span_overflowing_impl<detail::impl::span_op::shr, T>(lhs, detail::impl::span_uniform_operand<T>{rhs}, result, overflow_bitmap);
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_SPAN_ARITHMETIC_HPP
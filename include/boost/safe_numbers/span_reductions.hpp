@@ -0,0 +1,608 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_SAFE_NUMBERS_SPAN_REDUCTIONS_HPP
+#define BOOST_SAFE_NUMBERS_SPAN_REDUCTIONS_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/type_traits.hpp>
+#include <boost/safe_numbers/detail/throw_exception.hpp>
+#include <boost/safe_numbers/overflow_policy.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/bounded_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers::detail::impl {
+
+// An exact sum of any number of elements, held as low + high * 2^digits
+// where low is the wrapped sum in the lane type and high counts the carries out of it.
+// The high word is signed for signed basis types so that it also absorbs the sign extension of every element.
+template <typename BasisType>
+struct span_wide_sum
+{
+    using lane_type = span_lane_t<BasisType>;
+    using high_type = std::conditional_t<is_fundamental_signed_integral_v<BasisType>, std::int64_t, std::uint64_t>;
+
+    static constexpr auto digits {std::numeric_limits<lane_type>::digits};
+
+    lane_type low {};
+    high_type high {};
+
+    constexpr auto add(const lane_type lane_low, const high_type lane_high) noexcept -> void
+    {
+        low = static_cast<lane_type>(low + lane_low);
+        high += static_cast<high_type>(low < lane_low) + lane_high;
+    }
+
+    // Classifies the sum against the range of BasisType
+    [[nodiscard]] constexpr auto status() const noexcept -> signed_overflow_status
+    {
+        if constexpr (is_fundamental_unsigned_integral_v<BasisType>)
+        {
+            return high == 0U ? signed_overflow_status::no_error : signed_overflow_status::overflow;
+        }
+        else
+        {
+            const auto low_is_negative {(low >> (digits - 1)) != lane_type{0}};
+
+            if ((high == 0 && !low_is_negative) || (high == -1 && low_is_negative))
+            {
+                return signed_overflow_status::no_error;
+            }
+
+            return high < 0 ? signed_overflow_status::underflow : signed_overflow_status::overflow;
+        }
+    }
+
+    [[nodiscard]] constexpr auto wrapped() const noexcept -> BasisType
+    {
+        return static_cast<BasisType>(low);
+    }
+};
+
+// Computes the exact sum of term(i) for every i in [0, size).
+// Terms of up to 32 bits are summed in blocks into a 64-bit accumulator,
+// whose length is chosen so that the block sum can not overflow, which lets the inner loop vectorize as a plain widening add.
+// Each block sum is then split into its low and high parts and folded into the exact sum.
+// 64-bit terms are split into their 32-bit halves which are summed in the same way.
+// 128-bit terms are accumulated directly into the low and high words.
+template <typename BasisType, typename Term>
+[[nodiscard]] constexpr auto span_exact_sum_of(const std::size_t size, Term term) noexcept -> span_wide_sum<BasisType>
+{
+    using wide_sum = span_wide_sum<BasisType>;
+    using lane_type = typename wide_sum::lane_type;
+    using high_type = typename wide_sum::high_type;
+    using block_type = std::conditional_t<is_fundamental_signed_integral_v<BasisType>, std::int64_t, std::uint64_t>;
+
+    wide_sum sum {};
+
+    if constexpr (sizeof(BasisType) <= sizeof(std::uint32_t))
+    {
+        constexpr std::uint64_t block_elements {std::uint64_t{1} << (64 - wide_sum::digits)};
+
+        for (std::size_t first {}; first < size;)
+        {
+            const auto remaining {static_cast<std::uint64_t>(size - first)};
+            const auto block_size {static_cast<std::size_t>(remaining < block_elements ? remaining : block_elements)};
+
+            block_type block_sum {};
+            for (std::size_t i {}; i < block_size; ++i)
+            {
+                block_sum += static_cast<block_type>(term(first + i));
+            }
+
+            sum.add(static_cast<lane_type>(block_sum), static_cast<high_type>(block_sum >> wide_sum::digits));
+            first += block_size;
+        }
+    }
+    else if constexpr (sizeof(BasisType) == sizeof(std::uint64_t))
+    {
+        // The low halves are always unsigned, and the high halves carry the sign
+        constexpr std::uint64_t block_elements {std::uint64_t{1} << 32U};
+
+        for (std::size_t first {}; first < size;)
+        {
+            const auto remaining {static_cast<std::uint64_t>(size - first)};
+            const auto block_size {static_cast<std::size_t>(remaining < block_elements ? remaining : block_elements)};
+
+            std::uint64_t low_sum {};
+            block_type high_sum {};
+            for (std::size_t i {}; i < block_size; ++i)
+            {
+                const auto raw {static_cast<BasisType>(term(first + i))};
+                low_sum += static_cast<std::uint64_t>(raw) & UINT64_C(0xFFFFFFFF);
+                high_sum += raw >> 32U;
+            }
+
+            sum.add(low_sum, high_type{0});
+            sum.add(static_cast<lane_type>(static_cast<std::uint64_t>(high_sum) << 32U), static_cast<high_type>(high_sum >> 32U));
+            first += block_size;
+        }
+    }
+    else
+    {
+        for (std::size_t i {}; i < size; ++i)
+        {
+            const auto raw {static_cast<BasisType>(term(i))};
+
+            if constexpr (is_fundamental_signed_integral_v<BasisType>)
+            {
+                sum.add(static_cast<lane_type>(raw), raw < 0 ? high_type{-1} : high_type{0});
+            }
+            else
+            {
+                sum.add(raw, high_type{0});
+            }
+        }
+    }
+
+    return sum;
+}
+
+template <typename BasisType>
+struct span_reduction_value
+{
+    BasisType value;
+    signed_overflow_status status;
+};
+
+// Classifies an exact wide result against the range of the narrower NarrowBasis.
+// The value is the result modulo 2^digits of NarrowBasis.
+template <typename NarrowBasis, typename WideBasis>
+[[nodiscard]] constexpr auto span_narrow(const span_wide_sum<WideBasis>& sum) noexcept -> span_reduction_value<NarrowBasis>
+{
+    auto status {sum.status()};
+    const auto wide {sum.wrapped()};
+
+    if constexpr (sizeof(NarrowBasis) < sizeof(WideBasis))
+    {
+        if (status == signed_overflow_status::no_error)
+        {
+            if (wide > static_cast<WideBasis>(std::numeric_limits<NarrowBasis>::max()))
+            {
+                status = signed_overflow_status::overflow;
+            }
+            else if (wide < static_cast<WideBasis>(std::numeric_limits<NarrowBasis>::min()))
+            {
+                status = signed_overflow_status::underflow;
+            }
+        }
+    }
+
+    return {static_cast<NarrowBasis>(static_cast<span_lane_t<NarrowBasis>>(static_cast<span_lane_t<WideBasis>>(wide))), status};
+}
+
+enum class reduction_op
+{
+    sum,
+    dot,
+};
+
+template <typename BasisType>
+constexpr auto span_type_name() noexcept -> const char*
+{
+    if constexpr (std::is_same_v<BasisType, std::uint8_t>) { return "u8"; }
+    else if constexpr (std::is_same_v<BasisType, std::uint16_t>) { return "u16"; }
+    else if constexpr (std::is_same_v<BasisType, std::uint32_t>) { return "u32"; }
+    else if constexpr (std::is_same_v<BasisType, std::uint64_t>) { return "u64"; }
+    else if constexpr (std::is_same_v<BasisType, int128::uint128_t>) { return "u128"; }
+    else if constexpr (std::is_same_v<BasisType, std::int8_t>) { return "i8"; }
+    else if constexpr (std::is_same_v<BasisType, std::int16_t>) { return "i16"; }
+    else if constexpr (std::is_same_v<BasisType, std::int32_t>) { return "i32"; }
+    else if constexpr (std::is_same_v<BasisType, std::int64_t>) { return "i64"; }
+    else { return "i128"; }
+}
+
+inline auto reduction_error_msg(const char* kind, const char* type_name, const char* operation) noexcept
+    -> message_buffer<arithmetic_error_message_capacity>
+{
+    message_buffer<arithmetic_error_message_capacity> res {kind};
+    res.append(" detected in ").append(type_name).append(' ').append(operation);
+    return res;
+}
+
+template <typename T>
+constexpr auto bounded_sum_out_of_range_msg() noexcept -> const char*
+{
+    if constexpr (is_unsigned_library_type_v<T>)
+    {
+        return "bounded_uint sum result out of range";
+    }
+    else
+    {
+        return "bounded_int sum result out of range";
+    }
+}
+
+// Applies the overflow policy to the classified result of a reduction
+template <reduction_op Op, overflow_policy Policy, typename T>
+constexpr auto span_reduction_result(span_reduction_value<underlying_type_t<T>> result)
+    noexcept(Policy != overflow_policy::throw_exception)
+{
+    using basis_type = underlying_type_t<T>;
+
+    static_assert(Policy == overflow_policy::throw_exception ||
+                  Policy == overflow_policy::saturate ||
+                  Policy == overflow_policy::overflow_tuple ||
+                  Policy == overflow_policy::checked ||
+                  Policy == overflow_policy::strict,
+                  "Policy is not supported for span reductions");
+
+    static_assert(Policy != overflow_policy::overflow_tuple || !is_bounded_type_v<T>,
+                  "The overflow_tuple policy is not supported for bounded types since the wrapped result may not be representable");
+
+    auto status {result.status};
+    const auto res {result.value};
+
+    // For bounded types an in range result of the basis type must also lie within the bounds,
+    // which is reported as a domain error in the same way as the scalar operators
+    bool out_of_bounds {false};
+    if constexpr (is_bounded_type_v<T>)
+    {
+        constexpr auto min_raw {static_cast<basis_type>(std::numeric_limits<T>::min())};
+        constexpr auto max_raw {static_cast<basis_type>(std::numeric_limits<T>::max())};
+
+        if (status == signed_overflow_status::no_error && (res < min_raw || res > max_raw))
+        {
+            out_of_bounds = true;
+            status = res < min_raw ? signed_overflow_status::underflow : signed_overflow_status::overflow;
+        }
+    }
+
+    if constexpr (Policy == overflow_policy::throw_exception)
+    {
+        if (status != signed_overflow_status::no_error)
+        {
+            // A reduction has no single pair of operands, so the handlers are passed the result,
+            // modulo 2^digits if it left the basis type, and the limit that it passed
+            constexpr auto op {Op == reduction_op::sum ? arithmetic_op::add : arithmetic_op::mul};
+            auto limit {status == signed_overflow_status::overflow ? std::numeric_limits<basis_type>::max() : std::numeric_limits<basis_type>::min()};
+            if constexpr (is_bounded_type_v<T>)
+            {
+                if (out_of_bounds)
+                {
+                    limit = static_cast<basis_type>(status == signed_overflow_status::overflow ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min());
+                }
+            }
+
+            if (std::is_constant_evaluated())
+            {
+                BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in span reduction");
+            }
+            else if (out_of_bounds)
+            {
+                BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::domain_error, bounded_sum_out_of_range_msg<T>(), op, res, limit);
+            }
+            else if constexpr (Op == reduction_op::sum)
+            {
+                if (status == signed_overflow_status::overflow)
+                {
+                    BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, (span_overflow_msg<span_op::add, basis_type>()), op, res, limit);
+                }
+                else
+                {
+                    BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::underflow_error, (span_underflow_msg<span_op::add, basis_type>()), op, res, limit);
+                }
+            }
+            else
+            {
+                if (status == signed_overflow_status::overflow)
+                {
+                    BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, reduction_error_msg("Overflow", span_type_name<basis_type>(), "dot product"),
+                                                              op, res, limit);
+                }
+                else
+                {
+                    BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::underflow_error, reduction_error_msg("Underflow", span_type_name<basis_type>(), "dot product"),
+                                                              op, res, limit);
+                }
+            }
+        }
+
+        return T{res};
+    }
+    else if constexpr (Policy == overflow_policy::saturate)
+    {
+        if (status == signed_overflow_status::overflow)
+        {
+            return std::numeric_limits<T>::max();
+        }
+        else if (status == signed_overflow_status::underflow)
+        {
+            return std::numeric_limits<T>::min();
+        }
+
+        return T{res};
+    }
+    else if constexpr (Policy == overflow_policy::overflow_tuple)
+    {
+        return std::make_pair(T{res}, status != signed_overflow_status::no_error);
+    }
+    else if constexpr (Policy == overflow_policy::checked)
+    {
+        return status == signed_overflow_status::no_error ? std::make_optional(T{res}) : std::nullopt;
+    }
+    else
+    {
+        if (status != signed_overflow_status::no_error)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+
+        return T{res};
+    }
+}
+
+template <overflow_policy Policy, typename T>
+constexpr auto span_sum_impl(const std::span<const T> values)
+    noexcept(Policy != overflow_policy::throw_exception)
+{
+    using basis_type = underlying_type_t<T>;
+
+    const auto sum {span_exact_sum_of<basis_type>(values.size(), [values](const std::size_t i) noexcept
+    {
+        return static_cast<basis_type>(values[i]);
+    })};
+
+    return span_reduction_result<reduction_op::sum, Policy, T>(span_narrow<basis_type>(sum));
+}
+
+// The promoted type that holds any product of two elements exactly
+template <typename BasisType>
+struct span_product
+{
+    using type = promoted_type<BasisType>;
+};
+
+template <fundamental_signed_integral BasisType>
+struct span_product<BasisType>
+{
+    using type = signed_promoted_type<BasisType>;
+};
+
+template <typename BasisType>
+using span_product_t = typename span_product<BasisType>::type;
+
+// Products are computed in the promoted type and summed exactly,
+// so the only check is the final narrowing of the exact dot product to the element type
+template <overflow_policy Policy, typename T>
+constexpr auto span_dot_impl(const std::span<const T> lhs, const std::span<const T> rhs)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    using basis_type = underlying_type_t<T>;
+    using product_type = span_product_t<basis_type>;
+
+    if (lhs.size() != rhs.size())
+    {
+        if constexpr (Policy == overflow_policy::checked)
+        {
+            return span_reduction_result<reduction_op::dot, Policy, T>({basis_type{0}, signed_overflow_status::overflow});
+        }
+        else if constexpr (Policy == overflow_policy::strict)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+        else
+        {
+            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Dot product requires lhs and rhs to have the same size");
+        }
+    }
+
+    const auto dot {span_exact_sum_of<product_type>(lhs.size(), [lhs, rhs](const std::size_t i) noexcept
+    {
+        return static_cast<product_type>(static_cast<product_type>(static_cast<basis_type>(lhs[i])) *
+                                         static_cast<product_type>(static_cast<basis_type>(rhs[i])));
+    })};
+
+    return span_reduction_result<reduction_op::dot, Policy, T>(span_narrow<basis_type>(dot));
+}
+
+template <typename BasisType>
+auto fma_error_msg(const char* kind, const std::size_t index) noexcept -> message_buffer<arithmetic_error_message_capacity>
+{
+    return append_span_index(reduction_error_msg(kind, span_type_name<BasisType>(), "multiply-accumulate").c_str(), index);
+}
+
+// Updates accumulator[i] += lhs[i] * rhs[i] for every element with one narrowing check per element.
+// The new values of a block of elements are computed before any of them are stored,
+// so that with the throw_exception policy the offending element can still be identified from the inputs,
+// and the elements from the offending block onwards are left unmodified.
+template <overflow_policy Policy, typename T>
+constexpr auto span_fma_impl(const std::span<const T> lhs,
+                             const std::span<const T> rhs,
+                             const std::span<T> accumulator)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    using basis_type = underlying_type_t<T>;
+    using product_type = span_product_t<basis_type>;
+    using lane_type = span_lane_t<basis_type>;
+
+    static_assert(Policy == overflow_policy::throw_exception ||
+                  Policy == overflow_policy::saturate ||
+                  Policy == overflow_policy::checked ||
+                  Policy == overflow_policy::strict,
+                  "Policy is not supported for multiply-accumulate");
+
+    if (lhs.size() != rhs.size() || lhs.size() != accumulator.size())
+    {
+        if constexpr (Policy == overflow_policy::checked)
+        {
+            return false;
+        }
+        else if constexpr (Policy == overflow_policy::strict)
+        {
+            std::exit(EXIT_FAILURE);
+        }
+        else
+        {
+            BOOST_SAFE_NUMBERS_THROW_EXCEPTION(std::domain_error, "Multiply-accumulate requires lhs, rhs, and accumulator to have the same size");
+        }
+    }
+
+    constexpr std::size_t block_elements {64U};
+    constexpr auto max_wide {static_cast<product_type>(std::numeric_limits<basis_type>::max())};
+    constexpr auto min_wide {static_cast<product_type>(std::numeric_limits<basis_type>::min())};
+
+    lane_type overflow_reduction {};
+
+    for (std::size_t first {}; first < lhs.size(); first += block_elements)
+    {
+        const auto block_size {lhs.size() - first < block_elements ? lhs.size() - first : block_elements};
+
+        std::array<basis_type, block_elements> block {};
+        lane_type block_overflow {};
+
+        for (std::size_t i {}; i < block_size; ++i)
+        {
+            const auto wide {static_cast<product_type>(
+                static_cast<product_type>(static_cast<basis_type>(accumulator[first + i])) +
+                static_cast<product_type>(static_cast<basis_type>(lhs[first + i])) *
+                static_cast<product_type>(static_cast<basis_type>(rhs[first + i])))};
+
+            auto res {static_cast<basis_type>(static_cast<lane_type>(static_cast<span_lane_t<product_type>>(wide)))};
+            const auto overflow_mask {span_lane_mask<basis_type>(static_cast<product_type>(res) != wide)};
+
+            if constexpr (Policy == overflow_policy::saturate)
+            {
+                const auto saturated {static_cast<lane_type>(wide > max_wide ? max_wide : min_wide)};
+                res = static_cast<basis_type>((static_cast<lane_type>(res) & static_cast<lane_type>(~overflow_mask)) | (saturated & overflow_mask));
+            }
+
+            block[i] = res;
+            block_overflow |= overflow_mask;
+        }
+
+        if constexpr (Policy == overflow_policy::throw_exception)
+        {
+            if (block_overflow != lane_type{0})
+            {
+                if (std::is_constant_evaluated())
+                {
+                    BOOST_SAFE_NUMBERS_CONSTEXPR_THROW(std::overflow_error, "Overflow detected in multiply-accumulate");
+                }
+
+                for (std::size_t i {}; i < block_size; ++i)
+                {
+                    const auto wide {static_cast<product_type>(
+                        static_cast<product_type>(static_cast<basis_type>(accumulator[first + i])) +
+                        static_cast<product_type>(static_cast<basis_type>(lhs[first + i])) *
+                        static_cast<product_type>(static_cast<basis_type>(rhs[first + i])))};
+
+                    // The accumulator at the offending index has not been written, so the handlers are passed the factors
+                    if (wide > max_wide)
+                    {
+                        BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::overflow_error, fma_error_msg<basis_type>("Overflow", first + i), arithmetic_op::mul,
+                                                                  static_cast<basis_type>(lhs[first + i]), static_cast<basis_type>(rhs[first + i]));
+                    }
+                    else if (wide < min_wide)
+                    {
+                        BOOST_SAFE_NUMBERS_REPORT_OPERATION_ERROR(std::underflow_error, fma_error_msg<basis_type>("Underflow", first + i), arithmetic_op::mul,
+                                                                  static_cast<basis_type>(lhs[first + i]), static_cast<basis_type>(rhs[first + i]));
+                    }
+                }
+
+                BOOST_SAFE_NUMBERS_UNREACHABLE;
+            }
+        }
+
+        for (std::size_t i {}; i < block_size; ++i)
+        {
+            accumulator[first + i] = T{block[i]};
+        }
+
+        overflow_reduction |= block_overflow;
+    }
+
+    if constexpr (Policy == overflow_policy::strict)
+    {
+        if (overflow_reduction != lane_type{0})
+        {
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    else if constexpr (Policy == overflow_policy::checked)
+    {
+        return overflow_reduction == lane_type{0};
+    }
+    else
+    {
+        static_cast<void>(overflow_reduction);
+    }
+}
+
+} // namespace boost::safe_numbers::detail::impl
+
+namespace boost::safe_numbers {
+
+// Sums every element of values, checking the exact sum against the range of T once at the end
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::integral_library_type T, std::size_t Extent>
+[[nodiscard]] constexpr auto sum(const std::span<const T, Extent> values)
+    noexcept(Policy != overflow_policy::throw_exception)
+{
+    return detail::impl::span_sum_impl<Policy, T>(values);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, detail::integral_library_type T, std::size_t Extent>
+[[nodiscard]] constexpr auto sum(const std::span<T, Extent> values)
+    noexcept(Policy != overflow_policy::throw_exception)
+{
+    return detail::impl::span_sum_impl<Policy, T>(values);
+}
+
+// Computes the sum of lhs[i] * rhs[i], with every product and partial sum held exactly in a wider type,
+// and checks the final result against the range of T once
+
+template <typename T>
+concept dot_product_type = detail::non_bounded_integral_library_type<T> &&
+                           sizeof(detail::underlying_type_t<T>) <= sizeof(std::uint64_t);
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, dot_product_type T, std::size_t Extent>
+[[nodiscard]] constexpr auto dot(const std::span<const T, Extent> lhs,
+                                 const std::span<const std::type_identity_t<T>> rhs)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_dot_impl<Policy, T>(lhs, rhs);
+}
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, dot_product_type T, std::size_t Extent>
+[[nodiscard]] constexpr auto dot(const std::span<T, Extent> lhs,
+                                 const std::span<const std::type_identity_t<T>> rhs)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_dot_impl<Policy, T>(lhs, rhs);
+}
+
+// Computes accumulator[i] += lhs[i] * rhs[i] for every element,
+// with the product and sum held exactly in a wider type and narrowed once
+
+BOOST_SAFE_NUMBERS_EXPORT template <overflow_policy Policy, dot_product_type T, std::size_t Extent>
+constexpr auto fma_accumulate(const std::span<const std::type_identity_t<T>> lhs,
+                              const std::span<const std::type_identity_t<T>> rhs,
+                              const std::span<T, Extent> accumulator)
+    noexcept(Policy == overflow_policy::checked || Policy == overflow_policy::strict)
+{
+    return detail::impl::span_fma_impl<Policy, T>(lhs, rhs, accumulator);
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_SPAN_REDUCTIONS_HPP
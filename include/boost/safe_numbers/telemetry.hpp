@@ -0,0 +1,282 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reads the counters of BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY, which count how often each call site
+// saturates, overflows, fails a check, or reports an error.
+
+#ifndef BOOST_SAFE_NUMBERS_TELEMETRY_HPP
+#define BOOST_SAFE_NUMBERS_TELEMETRY_HPP
+
+#include <boost/safe_numbers/detail/config.hpp>
+#include <boost/safe_numbers/detail/telemetry.hpp>
+#include <boost/safe_numbers/overflow_handler.hpp>
+
+#ifndef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#endif // BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+namespace boost::safe_numbers {
+
+BOOST_SAFE_NUMBERS_EXPORT struct telemetry_counter
+{
+    const char* file;               // Where the function was called, or for errors where in the library they were detected
+    const char* function;
+    std::uint_least32_t line;
+    std::uint_least32_t column;
+    telemetry_event event;
+    arithmetic_op op;
+    const char* type;               // The operand type, e.g. "u32", or nullptr when op is none
+    std::uint64_t count;
+};
+
+BOOST_SAFE_NUMBERS_EXPORT struct telemetry_snapshot
+{
+    std::vector<telemetry_counter> counters;    // Sorted by count, the most frequent first
+    std::uint64_t unrecorded {};                // The events at sites that did not fit in the counters of their thread
+};
+
+namespace detail {
+
+[[nodiscard]] inline auto telemetry_less(const char* lhs, const char* rhs) noexcept -> bool
+{
+    if (lhs == nullptr || rhs == nullptr)
+    {
+        return lhs == nullptr && rhs != nullptr;
+    }
+
+    return std::strcmp(lhs, rhs) < 0;
+}
+
+// Orders the counters by site, comparing the strings rather than their pointers since each translation unit may have its own copy
+[[nodiscard]] inline auto telemetry_site_less(const telemetry_counter& lhs, const telemetry_counter& rhs) noexcept -> bool
+{
+    if (telemetry_less(lhs.file, rhs.file) || telemetry_less(rhs.file, lhs.file))
+    {
+        return telemetry_less(lhs.file, rhs.file);
+    }
+
+    if (std::tie(lhs.line, lhs.column, lhs.event, lhs.op) != std::tie(rhs.line, rhs.column, rhs.event, rhs.op))
+    {
+        return std::tie(lhs.line, lhs.column, lhs.event, lhs.op) < std::tie(rhs.line, rhs.column, rhs.event, rhs.op);
+    }
+
+    if (telemetry_less(lhs.type, rhs.type) || telemetry_less(rhs.type, lhs.type))
+    {
+        return telemetry_less(lhs.type, rhs.type);
+    }
+
+    return telemetry_less(lhs.function, rhs.function);
+}
+
+[[nodiscard]] inline auto telemetry_same_site(const telemetry_counter& lhs, const telemetry_counter& rhs) noexcept -> bool
+{
+    return !telemetry_site_less(lhs, rhs) && !telemetry_site_less(rhs, lhs);
+}
+
+inline void append_json_string(std::string& out, const char* str)
+{
+    if (str == nullptr)
+    {
+        out += "null";
+        return;
+    }
+
+    constexpr char hex_digits[] {"0123456789abcdef"};
+
+    out += '"';
+    for (; *str != '\0'; ++str)
+    {
+        const auto c {static_cast<unsigned char>(*str)};
+
+        switch (c)
+        {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (c < 0x20U)
+                {
+                    out += "\\u00";
+                    out += hex_digits[c >> 4U];
+                    out += hex_digits[c & 0xFU];
+                }
+                else
+                {
+                    out += static_cast<char>(c);
+                }
+                break;
+        }
+    }
+    out += '"';
+}
+
+} // namespace detail
+
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] constexpr auto to_string(const telemetry_event event) noexcept -> const char*
+{
+    switch (event)
+    {
+        case telemetry_event::saturated:
+            return "saturated";
+        case telemetry_event::overflowed:
+            return "overflowed";
+        case telemetry_event::check_failed:
+            return "check_failed";
+        case telemetry_event::error:
+            return "error";
+    }
+
+    return "unknown";
+}
+
+// Reads the counters of every thread, including those that have exited, and merges the counts of each site.
+// It may be called at any time from any thread, while the counting continues, and is empty unless BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY is defined.
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto take_telemetry_snapshot() -> telemetry_snapshot
+{
+    telemetry_snapshot snapshot {};
+    snapshot.unrecorded = detail::thread_shards_unrecorded<detail::telemetry_shard>.load(std::memory_order_relaxed);
+
+    for (const auto* shard {detail::thread_shards<detail::telemetry_shard>.load(std::memory_order_acquire)}; shard != nullptr; shard = shard->next)
+    {
+        snapshot.unrecorded += shard->unrecorded.load(std::memory_order_relaxed);
+
+        for (const auto& entry : shard->entries)
+        {
+            // The key of an entry is written once, before it is marked used
+            if (entry.used.load(std::memory_order_acquire))
+            {
+                const auto& key {entry.key};
+                snapshot.counters.push_back(telemetry_counter{key.file, key.function, key.line, key.column,
+                                                              key.event, key.op, key.type,
+                                                              entry.count.load(std::memory_order_relaxed)});
+            }
+        }
+    }
+
+    auto& counters {snapshot.counters};
+    std::sort(counters.begin(), counters.end(), detail::telemetry_site_less);
+
+    // Merges the counts of the same site in different threads
+    auto merged {counters.begin()};
+    for (auto it {counters.begin()}; it != counters.end(); ++it)
+    {
+        if (it != counters.begin() && detail::telemetry_same_site(*(merged - 1), *it))
+        {
+            (merged - 1)->count += it->count;
+        }
+        else
+        {
+            *merged++ = *it;
+        }
+    }
+    counters.erase(merged, counters.end());
+
+    std::stable_sort(counters.begin(), counters.end(), [](const telemetry_counter& lhs, const telemetry_counter& rhs)
+    {
+        return lhs.count > rhs.count;
+    });
+
+    return snapshot;
+}
+
+// One line per counter, e.g. "1024 saturated add u32 at main.cpp:12:5 in int main()"
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto to_text(const telemetry_snapshot& snapshot) -> std::string
+{
+    std::string out;
+
+    for (const auto& counter : snapshot.counters)
+    {
+        out += std::to_string(counter.count);
+        out += ' ';
+        out += to_string(counter.event);
+        out += ' ';
+        out += to_string(counter.op);
+        if (counter.type != nullptr)
+        {
+            out += ' ';
+            out += counter.type;
+        }
+        out += " at ";
+        out += counter.file != nullptr ? counter.file : "?";
+        out += ':';
+        out += std::to_string(counter.line);
+        out += ':';
+        out += std::to_string(counter.column);
+        if (counter.function != nullptr)
+        {
+            out += " in ";
+            out += counter.function;
+        }
+        out += '\n';
+    }
+
+    if (snapshot.unrecorded != 0U)
+    {
+        out += std::to_string(snapshot.unrecorded);
+        out += " unrecorded\n";
+    }
+
+    return out;
+}
+
+// {"counters":[{"file":...,"function":...,"line":...,"column":...,"event":...,"op":...,"type":...,"count":...},...],"unrecorded":...}
+BOOST_SAFE_NUMBERS_EXPORT [[nodiscard]] inline auto to_json(const telemetry_snapshot& snapshot) -> std::string
+{
+    std::string out {"{\"counters\":["};
+
+    bool first {true};
+    for (const auto& counter : snapshot.counters)
+    {
+        if (!first)
+        {
+            out += ',';
+        }
+        first = false;
+
+        out += "{\"file\":";
+        detail::append_json_string(out, counter.file);
+        out += ",\"function\":";
+        detail::append_json_string(out, counter.function);
+        out += ",\"line\":";
+        out += std::to_string(counter.line);
+        out += ",\"column\":";
+        out += std::to_string(counter.column);
+        out += ",\"event\":";
+        detail::append_json_string(out, to_string(counter.event));
+        out += ",\"op\":";
+        detail::append_json_string(out, to_string(counter.op));
+        out += ",\"type\":";
+        detail::append_json_string(out, counter.type);
+        out += ",\"count\":";
+        out += std::to_string(counter.count);
+        out += '}';
+    }
+
+    out += "],\"unrecorded\":";
+    out += std::to_string(snapshot.unrecorded);
+    out += '}';
+
+    return out;
+}
+
+} // namespace boost::safe_numbers
+
+#endif // BOOST_SAFE_NUMBERS_TELEMETRY_HPP
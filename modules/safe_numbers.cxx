@@ -15,14 +15,31 @@ module;
 #include <stdexcept>
 #include <format>
 #include <charconv>
+#include <span>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <version>
+#include <new>
+#include <source_location>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <iterator>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#include <expected>
+#endif
 
 #include <cstdint>
 
 #if defined(_MSC_VER)
 #  include <intrin.h>
-#elif defined(__x86_64__)
+#elif defined(__x86_64__) || defined(__SSE2__)
 #  include <x86intrin.h>
-#elif defined(__ARM_NEON__)
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
 #  include <arm_neon.h>
 #endif
 
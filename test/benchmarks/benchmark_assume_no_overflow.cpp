@@ -0,0 +1,210 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Compares loops of the library types built with BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW against the same loops of builtin types.
+// Every check becomes an assumption, so the runtime ratios should all be close to 1.
+
+#define BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/bounded_integers.hpp>
+#include <boost/config.hpp>
+#include <random>
+#include <span>
+#include <cstdint>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <algorithm>
+
+using namespace boost::safe_numbers;
+using namespace std::chrono;
+
+inline constexpr std::size_t N {10'000'000};
+
+template <typename T>
+struct raw_type { using type = T; };
+
+template <typename T>
+struct raw_type<detail::unsigned_integer_basis<T>> { using type = T; };
+
+template <typename T>
+struct raw_type<detail::signed_integer_basis<T>> { using type = T; };
+
+template <auto Min, auto Max>
+struct raw_type<bounded_uint<Min, Max>> { using type = detail::underlying_type_t<typename bounded_uint<Min, Max>::basis_type>; };
+
+template <typename T>
+using raw_type_t = typename raw_type<T>::type;
+
+// Values of at most max, which is chosen so that twice the product of two values does not overflow
+// or leave the range of the bounded type, so that none of the operations below do
+template <typename T>
+auto generate_vector(const std::uint64_t max)
+{
+    using value_type = raw_type_t<T>;
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::uint64_t> dist {1U, max};
+
+    std::vector<T> values;
+    values.reserve(N);
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.emplace_back(static_cast<value_type>(dist(rng)));
+    }
+
+    return values;
+}
+
+// Compiled with optimizations, since what is being measured is what the optimizer makes of each loop
+template <typename T, typename Func>
+BOOST_NOINLINE auto benchmark_loop(const std::vector<T>& values, Func op, const char* type, const char* operation)
+{
+    using value_type = raw_type_t<T>;
+
+    std::vector<T> results(values);
+    const std::span<const T> lhs {values.data(), N - 1U};
+    const std::span<const T> rhs {values.data() + 1U, N - 1U};
+
+    // Warm up, so that the first loop timed does not also pay for faulting in the pages of results
+    op(lhs, rhs, std::span<T>{results.data(), N - 1U});
+
+    const auto t1 = steady_clock::now();
+
+    for (std::size_t j {}; j < 10; ++j)
+    {
+        op(lhs, rhs, std::span<T>{results.data(), N - 1U});
+    }
+
+    const auto t2 = steady_clock::now();
+
+    const volatile auto sink {static_cast<std::uint64_t>(static_cast<value_type>(results[N / 2U]))};
+
+    const auto runtime_ns = (t2 - t1) / 1ns;
+
+    std::cerr << operation << "<" << std::left << std::setw(22) << type << ">: " << std::setw(10) << (t2 - t1) / 1us << " us (s=" << sink << ")\n";
+
+    return runtime_ns;
+}
+
+void print_runtime_ratio(const std::int64_t lib, const std::int64_t builtin)
+{
+    std::cout << std::setprecision(2) << std::fixed << std::setw(22)
+              << "Runtime ratio: " << std::setw(3) << static_cast<double>(lib) / static_cast<double>(builtin)
+              << std::endl;
+}
+
+struct loop_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] + rhs[i]);
+        }
+    }
+};
+
+struct loop_sub
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] - rhs[i]);
+        }
+    }
+};
+
+struct loop_mul
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] * rhs[i]);
+        }
+    }
+};
+
+// A multiply-add into the previous result, which is a dependency chain rather than independent elements
+struct loop_horner
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        auto acc {results[0]};
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            acc = static_cast<T>(lhs[i] * rhs[i] + (acc / rhs[i]));
+        }
+        results[0] = acc;
+    }
+};
+
+template <typename BuiltinT, typename LibT>
+void benchmark_type(const std::uint64_t max, const char* builtin_type, const char* lib_type)
+{
+    const auto builtin_values {generate_vector<BuiltinT>(max)};
+    const auto lib_values {generate_vector<LibT>(max)};
+
+    auto builtin_runtime = benchmark_loop(builtin_values, loop_add(), builtin_type, "add");
+    auto lib_runtime = benchmark_loop(lib_values, loop_add(), lib_type, "add");
+    print_runtime_ratio(lib_runtime, builtin_runtime);
+
+    builtin_runtime = benchmark_loop(builtin_values, loop_mul(), builtin_type, "mul");
+    lib_runtime = benchmark_loop(lib_values, loop_mul(), lib_type, "mul");
+    print_runtime_ratio(lib_runtime, builtin_runtime);
+
+    builtin_runtime = benchmark_loop(builtin_values, loop_horner(), builtin_type, "mul-add-div chain");
+    lib_runtime = benchmark_loop(lib_values, loop_horner(), lib_type, "mul-add-div chain");
+    print_runtime_ratio(lib_runtime, builtin_runtime);
+}
+
+int main()
+{
+    #ifdef BOOST_SAFE_NUMBERS_RUN_BENCHMARKS
+
+    std::cout << "\n32-bit Unsigned Integers\n";
+    benchmark_type<std::uint32_t, u32>(UINT16_MAX / 2U, "std::uint32_t", "boost::sn::u32");
+    {
+        // Subtraction of values in descending order never underflows
+        auto builtin_values {generate_vector<std::uint32_t>(UINT16_MAX)};
+        auto lib_values {generate_vector<u32>(UINT16_MAX)};
+        std::sort(builtin_values.begin(), builtin_values.end(), std::greater<>());
+        std::sort(lib_values.begin(), lib_values.end(), std::greater<>());
+
+        const auto builtin_runtime = benchmark_loop(builtin_values, loop_sub(), "std::uint32_t", "sub");
+        const auto lib_runtime = benchmark_loop(lib_values, loop_sub(), "boost::sn::u32", "sub");
+        print_runtime_ratio(lib_runtime, builtin_runtime);
+    }
+
+    std::cout << "\n64-bit Unsigned Integers\n";
+    benchmark_type<std::uint64_t, u64>(UINT32_MAX / 2U, "std::uint64_t", "boost::sn::u64");
+
+    std::cout << "\n32-bit Signed Integers\n";
+    benchmark_type<std::int32_t, i32>(INT16_MAX, "std::int32_t", "boost::sn::i32");
+
+    std::cout << "\n64-bit Signed Integers\n";
+    benchmark_type<std::int64_t, i64>(INT32_MAX, "std::int64_t", "boost::sn::i64");
+
+    std::cout << "\nBounded Unsigned Integers\n";
+    benchmark_type<std::uint32_t, bounded_uint<0U, 1'000'000'000U>>(UINT16_MAX / 4U, "std::uint32_t", "bounded_uint<0, 1e9>");
+
+    #else
+
+    std::cerr << "Benchmarks not run" << std::endl;
+
+    #endif
+
+    return 1;
+}
@@ -0,0 +1,1058 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures every operation of every type with every policy that supports it,
+// along with the same operations on the builtin types and on Boost.SafeNumerics,
+// and the charconv, byte conversion, bit, and integer utility functions.
+//
+// Usage:
+//   benchmark_matrix [--csv=file] [--json=file] [--filter=text] [--size=n] [--repetitions=n] [--no-counters]
+//   benchmark_matrix --compare baseline.csv current.csv [--threshold=percent]
+//
+// Each result is the time per operation, in nanoseconds, of the fastest of the repetitions.
+// The operands are chosen so that no operation fails, which measures the cost of the checks on the success path.
+// The result of each operation is kept, so that loops are measured one operation at a time rather than vectorized,
+// see benchmark_assume_no_overflow.cpp for the vectorized loops.
+//
+// Where the hardware counters are available, see hardware_counters.hpp, each result also has the cycles, instructions,
+// branches, branch misses, and L1 instruction cache misses per operation of the fastest repetition.
+// These include those of the loop, which the builtin results measure alone,
+// so that e.g. the instructions of checked add less those of builtin add are the instructions the check adds.
+//
+// The comparison reads two CSV files written by --csv, lists the operations that are slower in the second,
+// or execute more instructions, by more than the threshold, 10 percent unless given, and fails if there are any.
+// The boost_safe_numbers_benchmarks and boost_safe_numbers_benchmarks_compare CMake targets run both.
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include "hardware_counters.hpp"
+#include <boost/safe_numbers.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+#  pragma clang diagnostic ignored "-Wdouble-promotion"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#include <boost/config.hpp>
+
+// Even with the pragma above for -Wundef, GCC-11 and GCC-12 still fail
+// This is a workaround to at least define BOOST_CLANG to a fail value for safe_numerics
+#if defined(__GNUC__) && __GNUC__ == 11 || __GNUC__ == 12
+#  ifndef BOOST_CLANG
+#    define BOOST_CLANG 0
+#  endif
+#endif
+
+#include <boost/safe_numerics/safe_integer.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_RUN_BENCHMARKS
+
+using namespace boost::safe_numbers;
+
+namespace benchmark {
+
+// ------------------------------
+// Measurement
+// ------------------------------
+
+struct result
+{
+    std::string suite;          // arithmetic, charconv, byte_conversions, bit, or integer_utilities
+    std::string operation;
+    std::string type;
+    std::string variant;        // The policy, or builtin, safe_numerics, or library
+    double ns_per_op;
+    std::array<double, hardware_counter_count> counters_per_op {-1.0, -1.0, -1.0, -1.0, -1.0};   // -1 when not counted
+};
+
+struct options
+{
+    std::size_t size {1U << 16U};
+    int repetitions {11};
+    std::string filter;
+    std::string csv_file;
+    std::string json_file;
+    bool counters {true};
+};
+
+// Materializes a value, so that the operation computing it can be neither removed nor vectorized
+template <typename T>
+inline void keep(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (std::is_scalar_v<T>)
+    {
+        asm volatile("" : : "r"(value) : "memory");
+    }
+    else
+    {
+        asm volatile("" : : "m"(value) : "memory");
+    }
+#else
+    static volatile unsigned char sink;
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    sink = static_cast<unsigned char>(sink ^ bytes[0] ^ bytes[sizeof(T) - 1U]);
+#endif
+}
+
+// The value of a result of any policy, or of a Boost.SafeNumerics type
+template <typename T>
+constexpr auto raw(const T& value)
+{
+    if constexpr (requires { value.first; value.second; })
+    {
+        return raw(value.first);
+    }
+    else if constexpr (requires { value.has_value(); *value; })
+    {
+        return raw(*value);
+    }
+    else if constexpr (detail::library_type<T>)
+    {
+        return static_cast<detail::underlying_type_t<T>>(value);
+    }
+    else if constexpr (boost::safe_numerics::is_safe<T>::value)
+    {
+        return boost::safe_numerics::base_value(value);
+    }
+    else
+    {
+        return value;
+    }
+}
+
+class runner
+{
+private:
+
+    options options_;
+    std::vector<result> results_;
+    hardware_counters counters_;
+
+public:
+
+    explicit runner(options opts) : options_ {std::move(opts)}
+    {
+        if (options_.counters && !counters_.available())
+        {
+            std::cerr << "Hardware counters are not available (" << counters_.why() << "), measuring time only\n";
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return options_.size; }
+
+    [[nodiscard]] auto results() const noexcept -> const std::vector<result>& { return results_; }
+
+    // Runs kernel, which executes size() operations, and records the fastest of the repetitions
+    template <typename Kernel>
+    void run(const char* suite, const char* operation, const char* type, const char* variant, Kernel kernel)
+    {
+        const auto name {std::string {suite} + '/' + operation + '/' + type + '/' + variant};
+        if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos)
+        {
+            return;
+        }
+
+        // The first run warms the caches and is not measured
+        kernel();
+
+        const auto counting {options_.counters && counters_.available()};
+        auto best {std::numeric_limits<double>::max()};
+        hardware_counts best_counts {-1, -1, -1, -1, -1};
+
+        for (int i {}; i < options_.repetitions; ++i)
+        {
+            if (counting)
+            {
+                counters_.start();
+            }
+
+            const auto start {std::chrono::steady_clock::now()};
+            kernel();
+            const auto stop {std::chrono::steady_clock::now()};
+
+            const auto counts {counting ? counters_.stop() : best_counts};
+            const auto elapsed {std::chrono::duration<double, std::nano>(stop - start).count()};
+
+            if (elapsed < best)
+            {
+                best = elapsed;
+                best_counts = counts;
+            }
+        }
+
+        const auto size {static_cast<double>(options_.size)};
+        result res {suite, operation, type, variant, best / size};
+
+        for (std::size_t i {}; i < hardware_counter_count; ++i)
+        {
+            if (best_counts[i] >= 0)
+            {
+                res.counters_per_op[i] = static_cast<double>(best_counts[i]) / size;
+            }
+        }
+
+        results_.push_back(std::move(res));
+    }
+};
+
+template <typename T, typename Operation>
+void run_unary(runner& r, const char* suite, const char* operation, const char* type, const char* variant,
+               const std::vector<T>& values, Operation op)
+{
+    r.run(suite, operation, type, variant, [&values, op]
+    {
+        for (const auto& value : values)
+        {
+            keep(raw(op(value)));
+        }
+    });
+}
+
+template <typename T, typename Operation>
+void run_binary(runner& r, const char* suite, const char* operation, const char* type, const char* variant,
+                const std::vector<T>& lhs, const std::vector<T>& rhs, Operation op)
+{
+    r.run(suite, operation, type, variant, [&lhs, &rhs, op]
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            keep(raw(op(lhs[i], rhs[i])));
+        }
+    });
+}
+
+// ------------------------------
+// Operands
+// ------------------------------
+
+// The operands of the arithmetic, which none of the operations overflow:
+// lhs has half the value bits of the type, rhs is non-zero and smaller than lhs,
+// and shift is small enough that lhs << shift fits
+template <typename U>
+struct operands
+{
+    std::vector<U> lhs;
+    std::vector<U> rhs;
+    std::vector<U> shift;
+};
+
+template <typename U>
+auto make_operands(const std::size_t size, const int value_bits) -> operands<U>
+{
+    const auto half {value_bits / 2};
+    const auto top {std::uint64_t {1} << (half - 1)};
+    const auto bits {static_cast<std::uint64_t>(sizeof(U)) * 8U};
+
+    std::mt19937_64 rng {42U};
+    operands<U> values;
+
+    for (std::size_t i {}; i < size; ++i)
+    {
+        auto lhs {static_cast<U>(top | (rng() & (top - 1U)))};
+        auto rhs {static_cast<U>(1U | (rng() & (top - 1U)))};
+
+        if constexpr (std::numeric_limits<U>::is_signed)
+        {
+            // Every sign of lhs, while rhs stays smaller than it in magnitude
+            if ((rng() & 1U) != 0U)
+            {
+                lhs = static_cast<U>(-lhs);
+            }
+        }
+
+        values.lhs.push_back(lhs);
+        values.rhs.push_back(rhs);
+        values.shift.push_back(static_cast<U>(rng() % (bits - static_cast<std::uint64_t>(half))));
+    }
+
+    return values;
+}
+
+template <typename T, typename U>
+auto convert(const std::vector<U>& values) -> std::vector<T>
+{
+    std::vector<T> result;
+    result.reserve(values.size());
+
+    for (const auto& value : values)
+    {
+        result.push_back(static_cast<T>(value));
+    }
+
+    return result;
+}
+
+// ------------------------------
+// Arithmetic
+// ------------------------------
+
+inline constexpr overflow_policy policies[] {
+    overflow_policy::throw_exception,
+    overflow_policy::saturate,
+    overflow_policy::overflow_tuple,
+    overflow_policy::checked,
+    overflow_policy::strict,
+    overflow_policy::widen,
+    overflow_policy::sticky,
+    overflow_policy::wrap,
+    overflow_policy::expected
+};
+
+template <overflow_policy Policy, typename T>
+inline constexpr bool supports_widening {Policy != overflow_policy::widen ||
+                                         sizeof(detail::underlying_type_t<T>) <= sizeof(std::uint64_t)};
+
+template <overflow_policy Policy, typename T>
+void policy_arithmetic(runner& r, const char* type, const operands<T>& values)
+{
+    const auto policy {detail::profiled_policy_name(Policy)};
+    const auto& lhs {values.lhs};
+    const auto& rhs {values.rhs};
+
+    if constexpr (supports_widening<Policy, T>)
+    {
+        run_binary(r, "arithmetic", "add", type, policy, lhs, rhs, [](const T a, const T b) { return add<Policy>(a, b); });
+        run_binary(r, "arithmetic", "mul", type, policy, lhs, rhs, [](const T a, const T b) { return mul<Policy>(a, b); });
+    }
+
+    if constexpr (Policy != overflow_policy::widen)
+    {
+        run_binary(r, "arithmetic", "sub", type, policy, lhs, rhs, [](const T a, const T b) { return sub<Policy>(a, b); });
+        run_binary(r, "arithmetic", "div", type, policy, lhs, rhs, [](const T a, const T b) { return div<Policy>(a, b); });
+        run_binary(r, "arithmetic", "mod", type, policy, lhs, rhs, [](const T a, const T b) { return mod<Policy>(a, b); });
+
+        if constexpr (detail::is_unsigned_library_type_v<T>)
+        {
+            run_binary(r, "arithmetic", "shl", type, policy, lhs, values.shift, [](const T a, const T b) { return shl<Policy>(a, b); });
+            run_binary(r, "arithmetic", "shr", type, policy, lhs, values.shift, [](const T a, const T b) { return shr<Policy>(a, b); });
+        }
+    }
+}
+
+// The operations of the basis type U, unchecked
+template <typename U>
+void builtin_arithmetic(runner& r, const char* type, const operands<U>& values, const bool shifts)
+{
+    const auto& lhs {values.lhs};
+    const auto& rhs {values.rhs};
+
+    run_binary(r, "arithmetic", "add", type, "builtin", lhs, rhs, [](const U a, const U b) { return static_cast<U>(a + b); });
+    run_binary(r, "arithmetic", "sub", type, "builtin", lhs, rhs, [](const U a, const U b) { return static_cast<U>(a - b); });
+    run_binary(r, "arithmetic", "mul", type, "builtin", lhs, rhs, [](const U a, const U b) { return static_cast<U>(a * b); });
+    run_binary(r, "arithmetic", "div", type, "builtin", lhs, rhs, [](const U a, const U b) { return static_cast<U>(a / b); });
+    run_binary(r, "arithmetic", "mod", type, "builtin", lhs, rhs, [](const U a, const U b) { return static_cast<U>(a % b); });
+
+    if (shifts)
+    {
+        run_binary(r, "arithmetic", "shl", type, "builtin", lhs, values.shift, [](const U a, const U b) { return static_cast<U>(a << b); });
+        run_binary(r, "arithmetic", "shr", type, "builtin", lhs, values.shift, [](const U a, const U b) { return static_cast<U>(a >> b); });
+    }
+}
+
+// The same operations of boost::safe_numerics::safe<U>, which has no 128-bit types
+template <typename U>
+void safe_numerics_arithmetic(runner& r, const char* type, const operands<U>& values, const bool shifts)
+{
+    using safe_type = boost::safe_numerics::safe<U>;
+
+    const operands<safe_type> safe_values {convert<safe_type>(values.lhs), convert<safe_type>(values.rhs), convert<safe_type>(values.shift)};
+    const auto& lhs {safe_values.lhs};
+    const auto& rhs {safe_values.rhs};
+
+    run_binary(r, "arithmetic", "add", type, "safe_numerics", lhs, rhs, [](const safe_type a, const safe_type b) { return static_cast<U>(a + b); });
+    run_binary(r, "arithmetic", "sub", type, "safe_numerics", lhs, rhs, [](const safe_type a, const safe_type b) { return static_cast<U>(a - b); });
+    run_binary(r, "arithmetic", "mul", type, "safe_numerics", lhs, rhs, [](const safe_type a, const safe_type b) { return static_cast<U>(a * b); });
+    run_binary(r, "arithmetic", "div", type, "safe_numerics", lhs, rhs, [](const safe_type a, const safe_type b) { return static_cast<U>(a / b); });
+    run_binary(r, "arithmetic", "mod", type, "safe_numerics", lhs, rhs, [](const safe_type a, const safe_type b) { return static_cast<U>(a % b); });
+
+    if (shifts)
+    {
+        run_binary(r, "arithmetic", "shl", type, "safe_numerics", lhs, safe_values.shift, [](const safe_type a, const safe_type b) { return static_cast<U>(a << b); });
+        run_binary(r, "arithmetic", "shr", type, "safe_numerics", lhs, safe_values.shift, [](const safe_type a, const safe_type b) { return static_cast<U>(a >> b); });
+    }
+}
+
+template <typename T>
+void arithmetic(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+    constexpr bool is_unsigned {detail::is_unsigned_library_type_v<T>};
+
+    const auto raw_values {make_operands<U>(r.size(), std::numeric_limits<U>::digits)};
+    const operands<T> values {convert<T>(raw_values.lhs), convert<T>(raw_values.rhs), convert<T>(raw_values.shift)};
+
+    [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        (policy_arithmetic<policies[I]>(r, type, values), ...);
+    }(std::make_index_sequence<std::size(policies)>{});
+
+    builtin_arithmetic(r, type, raw_values, is_unsigned);
+
+    if constexpr (sizeof(U) <= sizeof(std::uint64_t))
+    {
+        safe_numerics_arithmetic(r, type, raw_values, is_unsigned);
+    }
+}
+
+// The bounded types only have operators, which check the result against the bounds
+template <typename T>
+void bounded_arithmetic(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+
+    const auto raw_values {make_operands<U>(r.size(), std::bit_width(static_cast<std::uint64_t>(raw((std::numeric_limits<T>::max)()))) - 1)};
+    const auto lhs {convert<T>(raw_values.lhs)};
+    const auto rhs {convert<T>(raw_values.rhs)};
+
+    run_binary(r, "arithmetic", "add", type, "throw_exception", lhs, rhs, [](const T a, const T b) { return a + b; });
+    run_binary(r, "arithmetic", "sub", type, "throw_exception", lhs, rhs, [](const T a, const T b) { return a - b; });
+    run_binary(r, "arithmetic", "mul", type, "throw_exception", lhs, rhs, [](const T a, const T b) { return a * b; });
+    run_binary(r, "arithmetic", "div", type, "throw_exception", lhs, rhs, [](const T a, const T b) { return a / b; });
+    run_binary(r, "arithmetic", "mod", type, "throw_exception", lhs, rhs, [](const T a, const T b) { return a % b; });
+
+    builtin_arithmetic(r, type, raw_values, false);
+}
+
+// ------------------------------
+// Charconv
+// ------------------------------
+
+template <typename T>
+void charconv(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+
+    const auto raw_values {make_operands<U>(r.size(), std::numeric_limits<U>::digits).lhs};
+    const auto values {convert<T>(raw_values)};
+
+    r.run("charconv", "to_chars", type, "library", [&values]
+    {
+        char buffer[64];
+        for (const auto value : values)
+        {
+            keep(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+        }
+    });
+
+    r.run("charconv", "to_chars", type, "builtin", [&raw_values]
+    {
+        char buffer[64];
+        for (const auto value : raw_values)
+        {
+            keep(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+        }
+    });
+
+    std::vector<std::string> strings;
+    for (const auto value : raw_values)
+    {
+        char buffer[64];
+        const auto end {boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value).ptr};
+        strings.emplace_back(buffer, end);
+    }
+
+    r.run("charconv", "from_chars", type, "library", [&strings]
+    {
+        for (const auto& str : strings)
+        {
+            T value {};
+            static_cast<void>(boost::charconv::from_chars(str.data(), str.data() + str.size(), value));
+            keep(raw(value));
+        }
+    });
+
+    r.run("charconv", "from_chars", type, "builtin", [&strings]
+    {
+        for (const auto& str : strings)
+        {
+            U value {};
+            static_cast<void>(boost::charconv::from_chars(str.data(), str.data() + str.size(), value));
+            keep(value);
+        }
+    });
+}
+
+// ------------------------------
+// Byte conversions
+// ------------------------------
+
+template <typename T>
+void byte_conversions(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+
+    const auto values {convert<T>(make_operands<U>(r.size(), std::numeric_limits<U>::digits).lhs)};
+
+    std::vector<std::array<std::byte, sizeof(T)>> bytes;
+    for (const auto value : values)
+    {
+        bytes.push_back(to_be_bytes(value));
+    }
+
+    run_unary(r, "byte_conversions", "to_be", type, "library", values, [](const T x) { return to_be(x); });
+    run_unary(r, "byte_conversions", "from_be", type, "library", values, [](const T x) { return from_be(x); });
+    run_unary(r, "byte_conversions", "to_le", type, "library", values, [](const T x) { return to_le(x); });
+    run_unary(r, "byte_conversions", "from_le", type, "library", values, [](const T x) { return from_le(x); });
+    run_unary(r, "byte_conversions", "to_be_bytes", type, "library", values, [](const T x) { return to_be_bytes(x); });
+    run_unary(r, "byte_conversions", "from_be_bytes", type, "library", bytes, [](const std::array<std::byte, sizeof(T)>& x)
+    {
+        return from_be_bytes<T>(std::span<const std::byte, sizeof(T)> {x});
+    });
+}
+
+// ------------------------------
+// Bit
+// ------------------------------
+
+template <typename T>
+void bit(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+
+    const auto raw_values {make_operands<U>(r.size(), std::numeric_limits<U>::digits).lhs};
+    const auto values {convert<T>(raw_values)};
+
+    run_unary(r, "bit", "popcount", type, "library", values, [](const T x) { return popcount(x); });
+    run_unary(r, "bit", "countl_zero", type, "library", values, [](const T x) { return countl_zero(x); });
+    run_unary(r, "bit", "countr_zero", type, "library", values, [](const T x) { return countr_zero(x); });
+    run_unary(r, "bit", "bit_width", type, "library", values, [](const T x) { return bit_width(x); });
+    run_unary(r, "bit", "bit_ceil", type, "library", values, [](const T x) { return bit_ceil(x); });
+    run_unary(r, "bit", "bit_floor", type, "library", values, [](const T x) { return bit_floor(x); });
+    run_unary(r, "bit", "has_single_bit", type, "library", values, [](const T x) { return has_single_bit(x); });
+    run_unary(r, "bit", "rotl", type, "library", values, [](const T x) { return rotl(x, 3); });
+    run_unary(r, "bit", "rotr", type, "library", values, [](const T x) { return rotr(x, 3); });
+    run_unary(r, "bit", "byteswap", type, "library", values, [](const T x) { return byteswap(x); });
+    run_unary(r, "bit", "bitswap", type, "library", values, [](const T x) { return bitswap(x); });
+
+    // <bit> has no 128-bit types
+    if constexpr (sizeof(U) <= sizeof(std::uint64_t))
+    {
+        run_unary(r, "bit", "popcount", type, "builtin", raw_values, [](const U x) { return std::popcount(x); });
+        run_unary(r, "bit", "countl_zero", type, "builtin", raw_values, [](const U x) { return std::countl_zero(x); });
+        run_unary(r, "bit", "countr_zero", type, "builtin", raw_values, [](const U x) { return std::countr_zero(x); });
+        run_unary(r, "bit", "bit_width", type, "builtin", raw_values, [](const U x) { return std::bit_width(x); });
+        run_unary(r, "bit", "bit_ceil", type, "builtin", raw_values, [](const U x) { return std::bit_ceil(x); });
+        run_unary(r, "bit", "bit_floor", type, "builtin", raw_values, [](const U x) { return std::bit_floor(x); });
+        run_unary(r, "bit", "has_single_bit", type, "builtin", raw_values, [](const U x) { return std::has_single_bit(x); });
+        run_unary(r, "bit", "rotl", type, "builtin", raw_values, [](const U x) { return std::rotl(x, 3); });
+        run_unary(r, "bit", "rotr", type, "builtin", raw_values, [](const U x) { return std::rotr(x, 3); });
+    }
+}
+
+// ------------------------------
+// Integer utilities
+// ------------------------------
+
+template <typename T>
+void integer_utilities(runner& r, const char* type)
+{
+    using U = detail::underlying_type_t<T>;
+
+    const auto raw_values {make_operands<U>(r.size(), std::numeric_limits<U>::digits)};
+    const auto lhs {convert<T>(raw_values.lhs)};
+    const auto rhs {convert<T>(raw_values.rhs)};
+
+    run_unary(r, "integer_utilities", "isqrt", type, "library", lhs, [](const T x) { return isqrt(x); });
+    run_unary(r, "integer_utilities", "ilog2", type, "library", lhs, [](const T x) { return ilog2(x); });
+    run_unary(r, "integer_utilities", "ilog10", type, "library", lhs, [](const T x) { return ilog10(x); });
+    run_unary(r, "integer_utilities", "is_power_2", type, "library", lhs, [](const T x) { return is_power_2(x); });
+    run_unary(r, "integer_utilities", "is_power_10", type, "library", lhs, [](const T x) { return is_power_10(x); });
+    run_binary(r, "integer_utilities", "abs_diff", type, "library", lhs, rhs, [](const T a, const T b) { return abs_diff(a, b); });
+    run_binary(r, "integer_utilities", "div_ceil", type, "library", lhs, rhs, [](const T a, const T b) { return div_ceil(a, b); });
+    run_binary(r, "integer_utilities", "next_multiple_of", type, "library", lhs, rhs, [](const T a, const T b) { return next_multiple_of(a, b); });
+}
+
+// ------------------------------
+// Output
+// ------------------------------
+
+auto counted(const result& res) noexcept -> bool
+{
+    return std::any_of(res.counters_per_op.begin(), res.counters_per_op.end(), [](const double count) { return count >= 0.0; });
+}
+
+// The counters per operation are only shown when some were counted
+auto to_text(const std::vector<result>& results) -> std::string
+{
+    const auto counters {std::any_of(results.begin(), results.end(), counted)};
+
+    std::ostringstream out;
+    out << std::left << std::setw(18) << "suite" << std::setw(18) << "operation" << std::setw(16) << "type"
+        << std::setw(16) << "variant";
+    if (counters)
+    {
+        out << std::setw(10) << "ns/op";
+        for (const auto name : hardware_counter_names)
+        {
+            out << std::setw(15) << name;
+        }
+    }
+    else
+    {
+        out << "ns/op";
+    }
+    out << '\n';
+
+    for (const auto& res : results)
+    {
+        out << std::setw(18) << res.suite << std::setw(18) << res.operation << std::setw(16) << res.type
+            << std::setw(16) << res.variant << std::fixed << std::setprecision(3);
+        if (counters)
+        {
+            out << std::setw(10) << res.ns_per_op;
+            for (const auto count : res.counters_per_op)
+            {
+                if (count >= 0.0)
+                {
+                    out << std::setw(15) << count;
+                }
+                else
+                {
+                    out << std::setw(15) << '-';
+                }
+            }
+        }
+        else
+        {
+            out << res.ns_per_op;
+        }
+        out << '\n';
+    }
+
+    return out.str();
+}
+
+// The counters not counted are empty
+auto to_csv(const std::vector<result>& results) -> std::string
+{
+    std::ostringstream out;
+    out << "suite,operation,type,variant,ns_per_op";
+    for (const auto name : hardware_counter_names)
+    {
+        out << ',' << name;
+    }
+    out << '\n';
+
+    for (const auto& res : results)
+    {
+        out << res.suite << ',' << res.operation << ',' << res.type << ',' << res.variant << ','
+            << std::fixed << std::setprecision(4) << res.ns_per_op;
+        for (const auto count : res.counters_per_op)
+        {
+            out << ',';
+            if (count >= 0.0)
+            {
+                out << count;
+            }
+        }
+        out << '\n';
+    }
+
+    return out.str();
+}
+
+// {"benchmarks":[{"suite":"arithmetic","operation":"add","type":"u32","variant":"checked","ns_per_op":0.4,
+//                 "cycles":1.6,"instructions":6.0,"branches":2.0,"branch_misses":0.0,"l1i_misses":0.0},...]}
+// with null for the counters not counted
+auto to_json(const std::vector<result>& results) -> std::string
+{
+    std::ostringstream out;
+    out << "{\"benchmarks\":[";
+
+    bool first {true};
+    for (const auto& res : results)
+    {
+        if (!first)
+        {
+            out << ',';
+        }
+        first = false;
+
+        out << "\n{\"suite\":\"" << res.suite << "\",\"operation\":\"" << res.operation << "\",\"type\":\"" << res.type
+            << "\",\"variant\":\"" << res.variant << "\",\"ns_per_op\":" << std::fixed << std::setprecision(4) << res.ns_per_op;
+
+        for (std::size_t i {}; i < hardware_counter_count; ++i)
+        {
+            out << ",\"" << hardware_counter_names[i] << "\":";
+            if (res.counters_per_op[i] >= 0.0)
+            {
+                out << res.counters_per_op[i];
+            }
+            else
+            {
+                out << "null";
+            }
+        }
+
+        out << '}';
+    }
+
+    out << "\n]}\n";
+
+    return out.str();
+}
+
+auto write_file(const std::string& file, const std::string& contents) -> bool
+{
+    std::ofstream out {file};
+    out << contents;
+
+    if (!out)
+    {
+        std::cerr << "Could not write " << file << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+// ------------------------------
+// Comparison
+// ------------------------------
+
+auto read_csv(const std::string& file, std::vector<result>& results) -> bool
+{
+    std::ifstream in {file};
+    if (!in)
+    {
+        std::cerr << "Could not read " << file << '\n';
+        return false;
+    }
+
+    std::string line;
+    std::getline(in, line);
+    if (!line.starts_with("suite,operation,type,variant,ns_per_op"))
+    {
+        std::cerr << file << " is not a CSV file of benchmark results\n";
+        return false;
+    }
+
+    while (std::getline(in, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+
+        std::istringstream fields {line};
+        result res {};
+        std::string ns_per_op;
+
+        if (!std::getline(fields, res.suite, ',') || !std::getline(fields, res.operation, ',') ||
+            !std::getline(fields, res.type, ',') || !std::getline(fields, res.variant, ',') ||
+            !std::getline(fields, ns_per_op, ','))
+        {
+            std::cerr << "Malformed line in " << file << ": " << line << '\n';
+            return false;
+        }
+
+        res.ns_per_op = std::strtod(ns_per_op.c_str(), nullptr);
+
+        // The counters, which files written without them do not have
+        std::string count;
+        for (std::size_t i {}; i < hardware_counter_count && std::getline(fields, count, ','); ++i)
+        {
+            if (!count.empty())
+            {
+                res.counters_per_op[i] = std::strtod(count.c_str(), nullptr);
+            }
+        }
+
+        results.push_back(std::move(res));
+    }
+
+    return true;
+}
+
+// Lists the operations of current that are slower than in baseline by more than threshold percent,
+// or that execute more instructions by as much when both counted them, and those that are faster,
+// and returns the number slower or executing more instructions
+auto compare(const std::vector<result>& baseline, const std::vector<result>& current, const double threshold) -> std::size_t
+{
+    struct change
+    {
+        const result* current;
+        double baseline_value;
+        double current_value;
+        double ratio;
+    };
+
+    constexpr std::size_t instructions {1U};    // The index of "instructions" in hardware_counter_names
+
+    std::vector<change> slower;
+    std::vector<change> faster;
+    std::vector<change> more_instructions;
+    std::size_t missing {};
+
+    const auto limit {1.0 + threshold / 100.0};
+
+    for (const auto& res : current)
+    {
+        const auto it {std::find_if(baseline.begin(), baseline.end(), [&res](const result& base)
+        {
+            return base.suite == res.suite && base.operation == res.operation && base.type == res.type && base.variant == res.variant;
+        })};
+
+        if (it == baseline.end() || it->ns_per_op <= 0.0)
+        {
+            ++missing;
+            continue;
+        }
+
+        const auto ratio {res.ns_per_op / it->ns_per_op};
+        if (ratio > limit)
+        {
+            slower.push_back(change{&res, it->ns_per_op, res.ns_per_op, ratio});
+        }
+        else if (ratio < 1.0 / limit)
+        {
+            faster.push_back(change{&res, it->ns_per_op, res.ns_per_op, ratio});
+        }
+
+        // Unlike the time, the instructions do not vary between runs, so any growth beyond the threshold is a change to the code
+        const auto base_instructions {it->counters_per_op[instructions]};
+        const auto current_instructions {res.counters_per_op[instructions]};
+        if (base_instructions > 0.0 && current_instructions >= 0.0 && current_instructions / base_instructions > limit)
+        {
+            more_instructions.push_back(change{&res, base_instructions, current_instructions, current_instructions / base_instructions});
+        }
+    }
+
+    const auto print = [](const char* title, const char* unit, std::vector<change>& changes)
+    {
+        std::sort(changes.begin(), changes.end(), [](const change& lhs, const change& rhs) { return lhs.ratio > rhs.ratio; });
+
+        std::cout << title << ": " << changes.size() << '\n';
+        for (const auto& c : changes)
+        {
+            const auto& res {*c.current};
+            std::cout << "  " << std::left << std::setw(60) << (res.suite + '/' + res.operation + '/' + res.type + '/' + res.variant)
+                      << std::fixed << std::setprecision(3) << c.baseline_value << " -> " << c.current_value << ' ' << unit << " ("
+                      << std::showpos << std::setprecision(1) << (c.ratio - 1.0) * 100.0 << std::noshowpos << "%)\n";
+        }
+    };
+
+    print("Slower", "ns/op", slower);
+    print("More instructions", "instructions/op", more_instructions);
+    print("Faster", "ns/op", faster);
+
+    if (missing != 0U)
+    {
+        std::cout << missing << " results are not in the baseline\n";
+    }
+
+    return slower.size() + more_instructions.size();
+}
+
+} // namespace benchmark
+
+int main(int argc, char** argv)
+{
+    using namespace benchmark;
+
+    options opts {};
+    std::vector<std::string> compare_files;
+    double threshold {10.0};
+    bool comparing {false};
+
+    for (int i {1}; i < argc; ++i)
+    {
+        const std::string_view arg {argv[i]};
+        const auto value {[&arg] { return std::string {arg.substr(arg.find('=') + 1U)}; }};
+
+        if (arg.starts_with("--csv="))
+        {
+            opts.csv_file = value();
+        }
+        else if (arg.starts_with("--json="))
+        {
+            opts.json_file = value();
+        }
+        else if (arg.starts_with("--filter="))
+        {
+            opts.filter = value();
+        }
+        else if (arg.starts_with("--size="))
+        {
+            opts.size = std::max<std::size_t>(1U, std::strtoull(value().c_str(), nullptr, 10));
+        }
+        else if (arg.starts_with("--repetitions="))
+        {
+            opts.repetitions = std::max(1, std::atoi(value().c_str()));
+        }
+        else if (arg == "--no-counters")
+        {
+            opts.counters = false;
+        }
+        else if (arg.starts_with("--threshold="))
+        {
+            threshold = std::strtod(value().c_str(), nullptr);
+        }
+        else if (arg == "--compare")
+        {
+            comparing = true;
+        }
+        else if (comparing && !arg.starts_with("--"))
+        {
+            compare_files.emplace_back(arg);
+        }
+        else
+        {
+            std::cerr << "Unknown argument " << arg << '\n'
+                      << "Usage: " << argv[0] << " [--csv=file] [--json=file] [--filter=text] [--size=n] [--repetitions=n] [--no-counters]\n"
+                      << "       " << argv[0] << " --compare baseline.csv current.csv [--threshold=percent]\n";
+            return 2;
+        }
+    }
+
+    if (comparing)
+    {
+        std::vector<result> baseline;
+        std::vector<result> current;
+
+        if (compare_files.size() != 2U)
+        {
+            std::cerr << "--compare needs a baseline and a current CSV file\n";
+            return 2;
+        }
+
+        if (!read_csv(compare_files[0], baseline) || !read_csv(compare_files[1], current))
+        {
+            return 2;
+        }
+
+        return compare(baseline, current, threshold) == 0U ? 0 : 1;
+    }
+
+    runner r {opts};
+
+    arithmetic<u8>(r, "u8");
+    arithmetic<u16>(r, "u16");
+    arithmetic<u32>(r, "u32");
+    arithmetic<u64>(r, "u64");
+    arithmetic<u128>(r, "u128");
+    arithmetic<i8>(r, "i8");
+    arithmetic<i16>(r, "i16");
+    arithmetic<i32>(r, "i32");
+    arithmetic<i64>(r, "i64");
+    arithmetic<i128>(r, "i128");
+    bounded_arithmetic<bounded_uint<0U, 1'000'000U>>(r, "bounded_uint");
+    bounded_arithmetic<bounded_int<-1'000'000, 1'000'000>>(r, "bounded_int");
+
+    charconv<u8>(r, "u8");
+    charconv<u16>(r, "u16");
+    charconv<u32>(r, "u32");
+    charconv<u64>(r, "u64");
+    charconv<u128>(r, "u128");
+    charconv<i8>(r, "i8");
+    charconv<i16>(r, "i16");
+    charconv<i32>(r, "i32");
+    charconv<i64>(r, "i64");
+    charconv<i128>(r, "i128");
+
+    byte_conversions<u8>(r, "u8");
+    byte_conversions<u16>(r, "u16");
+    byte_conversions<u32>(r, "u32");
+    byte_conversions<u64>(r, "u64");
+    byte_conversions<u128>(r, "u128");
+    byte_conversions<i8>(r, "i8");
+    byte_conversions<i16>(r, "i16");
+    byte_conversions<i32>(r, "i32");
+    byte_conversions<i64>(r, "i64");
+    // i128 skipped: boost::core::byteswap does not support int128_t
+
+    bit<u8>(r, "u8");
+    bit<u16>(r, "u16");
+    bit<u32>(r, "u32");
+    bit<u64>(r, "u64");
+    bit<u128>(r, "u128");
+
+    integer_utilities<u8>(r, "u8");
+    integer_utilities<u16>(r, "u16");
+    integer_utilities<u32>(r, "u32");
+    integer_utilities<u64>(r, "u64");
+    integer_utilities<u128>(r, "u128");
+
+    std::cout << to_text(r.results());
+
+    if (!opts.csv_file.empty() && !write_file(opts.csv_file, to_csv(r.results())))
+    {
+        return 2;
+    }
+
+    if (!opts.json_file.empty() && !write_file(opts.json_file, to_json(r.results())))
+    {
+        return 2;
+    }
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cerr << "Benchmarks not run" << std::endl;
+    return 1;
+}
+
+#endif
@@ -6,8 +6,14 @@
 #define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
 
 #include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/span_reductions.hpp>
+#include <boost/safe_numbers/divider.hpp>
+#include <boost/safe_numbers/conversions.hpp>
+#include <boost/safe_numbers/bounded_integers.hpp>
 #include <boost/safe_numbers/detail/type_traits.hpp>
 #include <random>
+#include <span>
 #include <cstdint>
 #include <vector>
 #include <chrono>
@@ -206,6 +212,534 @@ void print_runtime_ratio(T lib, T builtin)
               << std::endl;
 }
 
+// Unlike benchmark_op these are compiled with optimizations enabled,
+// since what is being measured is whether the whole loop vectorizes.
+// Each pass writes values[i] op values[i + 1] for the entire vector.
+template <typename T, typename Func>
+BOOST_NOINLINE auto benchmark_batch_op(const std::vector<T>& values, Func op, const char* type, const char* operation)
+{
+    using value_type = underlying_for_bench_t<T>;
+
+    std::vector<T> results(N - 1U);
+    const std::span<const T> lhs {values.data(), N - 1U};
+    const std::span<const T> rhs {values.data() + 1U, N - 1U};
+
+    const auto t1 = steady_clock::now();
+
+    for (std::size_t j {}; j < 10; ++j)
+    {
+        op(lhs, rhs, std::span<T>{results});
+    }
+
+    const auto t2 = steady_clock::now();
+
+    const volatile auto sink {static_cast<std::uint64_t>(static_cast<value_type>(results[N / 2U]))};
+
+    const auto runtime_ns = (t2 - t1) / 1ns;
+
+    std::cerr << operation << "<" << std::left << std::setw(15) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << sink << ")\n";
+
+    return runtime_ns;
+}
+
+struct scalar_loop_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] + rhs[i]);
+        }
+    }
+};
+
+struct scalar_loop_sub
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] - rhs[i]);
+        }
+    }
+};
+
+struct scalar_loop_mul
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = static_cast<T>(lhs[i] * rhs[i]);
+        }
+    }
+};
+
+struct span_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        add<overflow_policy::throw_exception>(lhs, rhs, results);
+    }
+};
+
+struct span_sub
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        sub<overflow_policy::throw_exception>(lhs, rhs, results);
+    }
+};
+
+struct span_mul
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        mul<overflow_policy::throw_exception>(lhs, rhs, results);
+    }
+};
+
+struct scalar_loop_saturating_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = saturating_add(lhs[i], rhs[i]);
+        }
+    }
+};
+
+struct scalar_loop_saturating_sub
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = saturating_sub(lhs[i], rhs[i]);
+        }
+    }
+};
+
+struct span_saturating_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        saturating_add(lhs, rhs, results);
+    }
+};
+
+struct span_saturating_sub
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        saturating_sub(lhs, rhs, results);
+    }
+};
+
+// The overflow flag of every iteration is ORed into a local context and tested once after the loop,
+// which leaves the loop body without a branch
+struct scalar_loop_sticky_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        error_context context {};
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = sticky_add(lhs[i], rhs[i], context);
+        }
+
+        thread_error_context().merge(context);
+    }
+};
+
+struct span_sticky_add
+{
+    template <typename T>
+    void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        add<overflow_policy::sticky>(lhs, rhs, results);
+    }
+};
+
+// Compares the checked span kernels against a loop of the checked scalar operators,
+// with a loop of the builtin operators as the baseline
+template <typename BuiltinT, typename LibT>
+void benchmark_span_operations(const std::vector<BuiltinT>& builtin_values, const std::vector<LibT>& lib_values,
+                            const char* builtin_type, const char* lib_type)
+{
+    auto builtin_runtime = benchmark_batch_op(builtin_values, scalar_loop_add(), builtin_type, "loop add");
+    auto scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_add(), lib_type, "loop add");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    auto span_runtime = benchmark_batch_op(lib_values, span_add(), lib_type, "span add");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+    auto sticky_runtime = benchmark_batch_op(lib_values, scalar_loop_sticky_add(), lib_type, "loop sticky_add");
+    print_runtime_ratio(sticky_runtime, builtin_runtime);
+    sticky_runtime = benchmark_batch_op(lib_values, span_sticky_add(), lib_type, "span sticky add");
+    print_runtime_ratio(sticky_runtime, builtin_runtime);
+
+    builtin_runtime = benchmark_batch_op(builtin_values, scalar_loop_sub(), builtin_type, "loop sub");
+    scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_sub(), lib_type, "loop sub");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    span_runtime = benchmark_batch_op(lib_values, span_sub(), lib_type, "span sub");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+
+    builtin_runtime = benchmark_batch_op(builtin_values, scalar_loop_mul(), builtin_type, "loop mul");
+    scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_mul(), lib_type, "loop mul");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    span_runtime = benchmark_batch_op(lib_values, span_mul(), lib_type, "span mul");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+}
+
+// Sums the low 4 bits of every value 10 times so that the total fits in 32 bits
+template <typename T, typename Func>
+BOOST_NOINLINE auto benchmark_reduction(const std::vector<T>& values, Func op, const char* type, const char* operation)
+{
+    using value_type = underlying_for_bench_t<T>;
+
+    std::vector<T> small_values;
+    small_values.reserve(values.size());
+    for (const auto value : values)
+    {
+        small_values.emplace_back(static_cast<value_type>(static_cast<value_type>(value) & 0xFU));
+    }
+
+    const auto t1 = steady_clock::now();
+
+    T total {};
+    for (std::size_t j {}; j < 10; ++j)
+    {
+        total = op(std::span<const T>{small_values});
+    }
+
+    const auto t2 = steady_clock::now();
+
+    const volatile auto sink {static_cast<std::uint64_t>(static_cast<value_type>(total))};
+
+    const auto runtime_ns = (t2 - t1) / 1ns;
+
+    std::cerr << operation << "<" << std::left << std::setw(15) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << sink << ")\n";
+
+    return runtime_ns;
+}
+
+struct scalar_loop_sum
+{
+    template <typename T>
+    auto operator()(const std::span<const T> values) const -> T
+    {
+        T total {};
+        for (const auto value : values)
+        {
+            total += value;
+        }
+        return total;
+    }
+};
+
+struct span_sum
+{
+    template <typename T>
+    auto operator()(const std::span<const T> values) const -> T
+    {
+        return sum<overflow_policy::throw_exception>(values);
+    }
+};
+
+// Compares the span sum against a loop of the checked operator,
+// with a loop of the builtin operator as the baseline
+template <typename BuiltinT, typename LibT>
+void benchmark_span_sum(const std::vector<BuiltinT>& builtin_values, const std::vector<LibT>& lib_values,
+                        const char* builtin_type, const char* lib_type)
+{
+    const auto builtin_runtime = benchmark_reduction(builtin_values, scalar_loop_sum(), builtin_type, "loop sum");
+    const auto scalar_runtime = benchmark_reduction(lib_values, scalar_loop_sum(), lib_type, "loop sum");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    const auto span_runtime = benchmark_reduction(lib_values, span_sum(), lib_type, "span sum");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+}
+
+// Compares the saturating span kernels against a loop of the scalar saturating functions
+template <typename LibT>
+void benchmark_span_saturating_operations(const std::vector<LibT>& lib_values, const char* lib_type)
+{
+    auto scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_saturating_add(), lib_type, "loop saturating_add");
+    auto span_runtime = benchmark_batch_op(lib_values, span_saturating_add(), lib_type, "span saturating_add");
+    print_runtime_ratio(span_runtime, scalar_runtime);
+
+    scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_saturating_sub(), lib_type, "loop saturating_sub");
+    span_runtime = benchmark_batch_op(lib_values, span_saturating_sub(), lib_type, "span saturating_sub");
+    print_runtime_ratio(span_runtime, scalar_runtime);
+}
+
+template <typename T>
+struct scalar_loop_div_by
+{
+    T divisor;
+
+    void operator()(const std::span<const T> lhs, const std::span<const T>, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = lhs[i] / divisor;
+        }
+    }
+};
+
+template <typename T>
+struct span_div_by
+{
+    divider<T> divisor;
+
+    void operator()(const std::span<const T> lhs, const std::span<const T>, const std::span<T> results) const
+    {
+        div<overflow_policy::throw_exception>(lhs, divisor, results);
+    }
+};
+
+// Compares division of a span by a single runtime divisor using a divider against a loop of the checked operator,
+// with a loop of the builtin operator as the baseline
+template <typename BuiltinT, typename LibT>
+void benchmark_span_divider(const std::vector<BuiltinT>& builtin_values, const std::vector<LibT>& lib_values,
+                            const char* builtin_type, const char* lib_type)
+{
+    // Read through a volatile so that the compiler can not replace the divides itself
+    const volatile unsigned runtime_divisor {7U};
+    const auto builtin_divisor {static_cast<BuiltinT>(runtime_divisor)};
+    const LibT lib_divisor {builtin_divisor};
+
+    const auto builtin_runtime = benchmark_batch_op(builtin_values, scalar_loop_div_by<BuiltinT>{builtin_divisor}, builtin_type, "loop div");
+    const auto scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_div_by<LibT>{lib_divisor}, lib_type, "loop div");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    const auto span_runtime = benchmark_batch_op(lib_values, span_div_by<LibT>{divider<LibT>{lib_divisor}}, lib_type, "span div");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+}
+
+struct scalar_loop_saturating_shl
+{
+    template <typename T>
+    BOOST_NOINLINE void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = saturating_shl(lhs[i], rhs[i]);
+        }
+    }
+};
+
+struct span_saturating_shl
+{
+    template <typename T>
+    BOOST_NOINLINE void operator()(const std::span<const T> lhs, const std::span<const T> rhs, const std::span<T> results) const
+    {
+        saturating_shl(lhs, rhs, results);
+    }
+};
+
+template <typename T>
+struct scalar_loop_shr_by
+{
+    T amount;
+
+    BOOST_NOINLINE void operator()(const std::span<const T> lhs, const std::span<const T>, const std::span<T> results) const
+    {
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            results[i] = lhs[i] >> amount;
+        }
+    }
+};
+
+template <typename T>
+struct span_shr_by
+{
+    T amount;
+
+    BOOST_NOINLINE void operator()(const std::span<const T> lhs, const std::span<const T>, const std::span<T> results) const
+    {
+        shr<overflow_policy::throw_exception>(lhs, amount, results);
+    }
+};
+
+// Compares shifts by an amount per element, and by a single runtime amount, against loops of the scalar operators.
+// The functors are kept out of line, as otherwise GCC interchanges the repetition loop with the element loop,
+// which stops the span kernels from vectorizing
+template <typename LibT>
+void benchmark_span_shifts(const std::vector<LibT>& lib_values, const char* lib_type)
+{
+    auto scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_saturating_shl(), lib_type, "loop saturating_shl");
+    auto span_runtime = benchmark_batch_op(lib_values, span_saturating_shl(), lib_type, "span saturating_shl");
+    print_runtime_ratio(span_runtime, scalar_runtime);
+
+    const volatile unsigned runtime_amount {3U};
+    const LibT amount {static_cast<underlying_for_bench_t<LibT>>(runtime_amount)};
+
+    scalar_runtime = benchmark_batch_op(lib_values, scalar_loop_shr_by<LibT>{amount}, lib_type, "loop shr");
+    span_runtime = benchmark_batch_op(lib_values, span_shr_by<LibT>{amount}, lib_type, "span shr");
+    print_runtime_ratio(span_runtime, scalar_runtime);
+}
+
+// Narrows the low 16 bits of every value 10 times, so that every conversion is in range
+template <typename To, typename From, typename Func>
+BOOST_NOINLINE auto benchmark_conversion(const std::vector<From>& values, Func op, const char* type, const char* operation)
+{
+    using from_type = underlying_for_bench_t<From>;
+    using to_type = underlying_for_bench_t<To>;
+
+    std::vector<From> small_values;
+    small_values.reserve(values.size());
+    for (const auto value : values)
+    {
+        small_values.emplace_back(static_cast<from_type>(static_cast<from_type>(value) & 0xFFFFU));
+    }
+
+    std::vector<To> results(small_values.size());
+
+    const auto t1 = steady_clock::now();
+
+    for (std::size_t j {}; j < 10; ++j)
+    {
+        op(std::span<const From>{small_values}, std::span<To>{results});
+    }
+
+    const auto t2 = steady_clock::now();
+
+    const volatile auto sink {static_cast<std::uint64_t>(static_cast<to_type>(results[N / 2U]))};
+
+    const auto runtime_ns = (t2 - t1) / 1ns;
+
+    std::cerr << operation << "<" << std::left << std::setw(15) << type << ">: " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << sink << ")\n";
+
+    return runtime_ns;
+}
+
+struct scalar_loop_narrow
+{
+    template <typename From, typename To>
+    void operator()(const std::span<const From> source, const std::span<To> destination) const
+    {
+        using to_type = underlying_for_bench_t<To>;
+
+        for (std::size_t i {}; i < source.size(); ++i)
+        {
+            destination[i] = To{static_cast<to_type>(source[i])};
+        }
+    }
+};
+
+struct span_checked_narrow
+{
+    template <typename From, typename To>
+    void operator()(const std::span<const From> source, const std::span<To> destination) const
+    {
+        if (!checked_cast(source, destination))
+        {
+            std::abort();
+        }
+    }
+};
+
+struct span_saturate_narrow
+{
+    template <typename From, typename To>
+    void operator()(const std::span<const From> source, const std::span<To> destination) const
+    {
+        saturate_cast(source, destination);
+    }
+};
+
+// Compares narrowing a column with the span conversions against a loop of the throwing conversion operator,
+// with a loop of builtin conversions as the baseline
+template <typename BuiltinTo, typename LibTo, typename BuiltinFrom, typename LibFrom>
+void benchmark_span_conversions(const std::vector<BuiltinFrom>& builtin_values, const std::vector<LibFrom>& lib_values,
+                                const char* builtin_type, const char* lib_type)
+{
+    const auto builtin_runtime = benchmark_conversion<BuiltinTo>(builtin_values, scalar_loop_narrow(), builtin_type, "loop narrow");
+    const auto scalar_runtime = benchmark_conversion<LibTo>(lib_values, scalar_loop_narrow(), lib_type, "loop narrow");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    auto span_runtime = benchmark_conversion<LibTo>(lib_values, span_checked_narrow(), lib_type, "span checked_cast");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+    span_runtime = benchmark_conversion<LibTo>(lib_values, span_saturate_narrow(), lib_type, "span saturate_cast");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+}
+
+// Loads every value modulo the number of codes 10 times, so that every construction is in range
+template <typename Bounded, typename T, typename Func>
+BOOST_NOINLINE auto benchmark_bounded_load(const std::vector<T>& values, const T codes, Func op, const char* operation)
+{
+    std::vector<T> raw_codes;
+    raw_codes.reserve(values.size());
+    for (const auto value : values)
+    {
+        raw_codes.emplace_back(static_cast<T>(value % codes));
+    }
+
+    std::vector<Bounded> results(raw_codes.size(), Bounded{T{0}});
+
+    const auto t1 = steady_clock::now();
+
+    for (std::size_t j {}; j < 10; ++j)
+    {
+        op(std::span<const T>{raw_codes}, std::span<Bounded>{results});
+    }
+
+    const auto t2 = steady_clock::now();
+
+    const volatile auto sink {static_cast<std::uint64_t>(static_cast<T>(results[N / 2U]))};
+
+    const auto runtime_ns = (t2 - t1) / 1ns;
+
+    std::cerr << std::left << std::setw(38) << operation << ": " << std::setw( 10 ) << ( t2 - t1 ) / 1us << " us (s=" << sink << ")\n";
+
+    return runtime_ns;
+}
+
+struct scalar_loop_copy
+{
+    template <typename T, typename U>
+    void operator()(const std::span<const T> source, const std::span<U> destination) const
+    {
+        for (std::size_t i {}; i < source.size(); ++i)
+        {
+            destination[i] = U{source[i]};
+        }
+    }
+};
+
+struct span_from_span
+{
+    template <typename T, typename Bounded>
+    void operator()(const std::span<const T> source, const std::span<Bounded> destination) const
+    {
+        Bounded::from_span(source, destination);
+    }
+};
+
+// Compares loading enum-like codes into a bounded type with from_span against a loop of the checking constructor,
+// with a plain copy as the baseline
+void benchmark_bounded_from_span(const std::vector<std::uint8_t>& builtin_values)
+{
+    using code = bounded_uint<0u, 99u>;
+    constexpr std::uint8_t codes {100U};
+
+    const auto builtin_runtime = benchmark_bounded_load<std::uint8_t>(builtin_values, codes, scalar_loop_copy(), "loop copy<std::uint8_t>");
+    const auto scalar_runtime = benchmark_bounded_load<code>(builtin_values, codes, scalar_loop_copy(), "loop construct<bounded_uint<0, 99>>");
+    print_runtime_ratio(scalar_runtime, builtin_runtime);
+    const auto span_runtime = benchmark_bounded_load<code>(builtin_values, codes, span_from_span(), "from_span<bounded_uint<0, 99>>");
+    print_runtime_ratio(span_runtime, builtin_runtime);
+}
+
 int main()
 {
     #ifdef BOOST_SAFE_NUMBERS_RUN_BENCHMARKS
@@ -380,6 +914,44 @@ int main()
         print_runtime_ratio(lib_runtime, builtin_runtime);
     }
 
+    {
+        std::cout << "\n8-bit Unsigned Integer Spans\n";
+        const auto builtin_values{generate_vector<std::uint8_t>()};
+        const auto lib_values{generate_vector<u8>(builtin_values)};
+        benchmark_span_operations(builtin_values, lib_values, "std::uint8_t", "boost::sn::u8");
+        benchmark_span_saturating_operations(lib_values, "boost::sn::u8");
+        benchmark_span_shifts(lib_values, "boost::sn::u8");
+        benchmark_bounded_from_span(builtin_values);
+    }
+    {
+        std::cout << "\n16-bit Unsigned Integer Spans\n";
+        const auto builtin_values{generate_vector<std::uint16_t>()};
+        const auto lib_values{generate_vector<u16>(builtin_values)};
+        benchmark_span_operations(builtin_values, lib_values, "std::uint16_t", "boost::sn::u16");
+        benchmark_span_saturating_operations(lib_values, "boost::sn::u16");
+        benchmark_span_shifts(lib_values, "boost::sn::u16");
+        benchmark_span_divider(builtin_values, lib_values, "std::uint16_t", "boost::sn::u16");
+    }
+    {
+        std::cout << "\n32-bit Unsigned Integer Spans\n";
+        const auto builtin_values{generate_vector<std::uint32_t>()};
+        const auto lib_values{generate_vector<u32>(builtin_values)};
+        benchmark_span_operations(builtin_values, lib_values, "std::uint32_t", "boost::sn::u32");
+        benchmark_span_sum(builtin_values, lib_values, "std::uint32_t", "boost::sn::u32");
+        benchmark_span_divider(builtin_values, lib_values, "std::uint32_t", "boost::sn::u32");
+        benchmark_span_shifts(lib_values, "boost::sn::u32");
+    }
+    {
+        std::cout << "\n64-bit Unsigned Integer Spans\n";
+        const auto builtin_values{generate_vector<std::uint64_t>()};
+        const auto lib_values{generate_vector<u64>(builtin_values)};
+        benchmark_span_operations(builtin_values, lib_values, "std::uint64_t", "boost::sn::u64");
+        benchmark_span_sum(builtin_values, lib_values, "std::uint64_t", "boost::sn::u64");
+        benchmark_span_divider(builtin_values, lib_values, "std::uint64_t", "boost::sn::u64");
+        benchmark_span_conversions<std::uint32_t, u32>(builtin_values, lib_values, "u64 -> u32", "u64 -> u32");
+        benchmark_span_conversions<std::uint16_t, u16>(builtin_values, lib_values, "u64 -> u16", "u64 -> u16");
+    }
+
     #else
 
     std::cerr << "Benchmarks not run" << std::endl;
@@ -0,0 +1,88 @@
+# Copyright 2026 Matt Borland
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+#
+# Reports the code size of the objects built from code_size.cpp
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<object;...> -DOUTPUT=<file> -P code_size.cmake
+#
+# OUTPUT receives the size of every function, smallest first, so that two builds can be diffed.
+# Cold code is counted separately, as it is not fetched unless an error occurs: the functions the library marks cold,
+# such as those reporting errors, and the parts the compiler splits out of a function (the .cold symbols),
+# which the compiler both places in .text.unlikely sections.
+
+cmake_minimum_required(VERSION 3.13)
+
+if(NOT OBJDUMP)
+    foreach(object IN LISTS OBJECTS)
+        file(SIZE "${object}" object_size)
+        message(STATUS "No objdump available, size of ${object}: ${object_size} bytes")
+    endforeach()
+    return()
+endif()
+
+execute_process(COMMAND "${OBJDUMP}" -t -C ${OBJECTS}
+                OUTPUT_VARIABLE symbols
+                RESULT_VARIABLE objdump_result)
+
+if(NOT objdump_result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed with ${objdump_result}")
+endif()
+
+set(function_count 0)
+set(hot_size 0)
+set(cold_size 0)
+set(functions "")
+
+# Brackets in the names of symbols, e.g. of operator[], would keep the lines from splitting into a list,
+# so they are replaced until the report is written
+string(ASCII 1 open_bracket)
+string(ASCII 2 close_bracket)
+string(REPLACE ";" "\;" symbols "${symbols}")
+string(REPLACE "[" "${open_bracket}" symbols "${symbols}")
+string(REPLACE "]" "${close_bracket}" symbols "${symbols}")
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+foreach(line IN LISTS symbols)
+    # <value> <flags> <section>\t<size> <name>, for the functions
+    if(line MATCHES "^[0-9a-f]+ ......F ([^\t]+)\t([0-9a-f]+) +(.*)$")
+        set(section "${CMAKE_MATCH_1}")
+        math(EXPR size "0x${CMAKE_MATCH_2}")
+        set(name "${CMAKE_MATCH_3}")
+
+        if(section MATCHES "^\\.text\\.unlikely" OR name MATCHES "\\.cold$")
+            math(EXPR cold_size "${cold_size} + ${size}")
+        else()
+            math(EXPR hot_size "${hot_size} + ${size}")
+            math(EXPR function_count "${function_count} + 1")
+        endif()
+
+        # Zero padded, so that sorting the strings sorts by size
+        string(LENGTH "${size}" digits)
+        math(EXPR padding "10 - ${digits}")
+        string(REPEAT "0" ${padding} zeros)
+        list(APPEND functions "${zeros}${size} ${name}")
+    endif()
+endforeach()
+
+list(SORT functions)
+
+set(report "")
+foreach(function IN LISTS functions)
+    string(REGEX REPLACE "^0*([0-9]+ )" "\\1" function "${function}")
+    string(REPLACE "${open_bracket}" "[" function "${function}")
+    string(REPLACE "${close_bracket}" "]" function "${function}")
+    string(APPEND report "${function}\n")
+endforeach()
+
+if(OUTPUT)
+    file(WRITE "${OUTPUT}" "${report}")
+endif()
+
+message(STATUS "Functions: ${function_count}")
+message(STATUS "Hot code: ${hot_size} bytes")
+message(STATUS "Cold code: ${cold_size} bytes")
+
+if(OUTPUT)
+    message(STATUS "Size of every function written to ${OUTPUT}")
+endif()
@@ -0,0 +1,81 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Instantiates every scalar operation of every type with every policy that supports it,
+// each as a function with external linkage, so that the size of this translation unit
+// tracks the size of the code the library inlines at each call site.
+// The boost_safe_numbers_code_size CMake target builds it and reports the size of its hot and cold code.
+
+#include <boost/safe_numbers.hpp>
+
+namespace boost::safe_numbers::code_size {
+
+template <overflow_policy Policy, typename T>
+inline constexpr bool supports_widening {Policy != overflow_policy::widen ||
+                                         sizeof(detail::underlying_type_t<T>) < sizeof(int128::uint128_t)};
+
+template <overflow_policy Policy, typename T>
+struct operations
+{
+    static auto add_op(const T lhs, const T rhs) requires supports_widening<Policy, T>
+    {
+        return add<Policy>(lhs, rhs);
+    }
+
+    static auto sub_op(const T lhs, const T rhs) requires (Policy != overflow_policy::widen)
+    {
+        return sub<Policy>(lhs, rhs);
+    }
+
+    static auto mul_op(const T lhs, const T rhs) requires supports_widening<Policy, T>
+    {
+        return mul<Policy>(lhs, rhs);
+    }
+
+    static auto div_op(const T lhs, const T rhs) requires (Policy != overflow_policy::widen)
+    {
+        return div<Policy>(lhs, rhs);
+    }
+
+    static auto mod_op(const T lhs, const T rhs) requires (Policy != overflow_policy::widen)
+    {
+        return mod<Policy>(lhs, rhs);
+    }
+
+    static auto shl_op(const T lhs, const T rhs) requires (Policy != overflow_policy::widen && detail::is_unsigned_library_type_v<T>)
+    {
+        return shl<Policy>(lhs, rhs);
+    }
+
+    static auto shr_op(const T lhs, const T rhs) requires (Policy != overflow_policy::widen && detail::is_unsigned_library_type_v<T>)
+    {
+        return shr<Policy>(lhs, rhs);
+    }
+};
+
+#define BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(T)                     \
+template struct operations<overflow_policy::throw_exception, T>;        \
+template struct operations<overflow_policy::saturate, T>;               \
+template struct operations<overflow_policy::overflow_tuple, T>;         \
+template struct operations<overflow_policy::checked, T>;                \
+template struct operations<overflow_policy::strict, T>;                 \
+template struct operations<overflow_policy::widen, T>;                  \
+template struct operations<overflow_policy::sticky, T>;                 \
+template struct operations<overflow_policy::wrap, T>;                   \
+template struct operations<overflow_policy::expected, T>;
+
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(u8)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(u16)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(u32)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(u64)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(u128)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(i8)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(i16)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(i32)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(i64)
+BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE(i128)
+
+#undef BOOST_SAFE_NUMBERS_CODE_SIZE_INSTANTIATE
+
+} // namespace boost::safe_numbers::code_size
@@ -0,0 +1,309 @@
+# Copyright 2026 Matt Borland
+# Distributed under the Boost Software License, Version 1.0.
+# https://www.boost.org/LICENSE_1_0.txt
+#
+# Checks the code of the probe functions of codegen_audit.cpp against their budgets
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<object;...> -DOUTPUT=<file> -P codegen_audit.cmake
+#
+# The success paths of a probe are the paths from its entry to a return that do not call a function reporting an error.
+# Each probe <type>_<policy>_<op> is compared to <type>_builtin_<op>, and fails the audit if
+#   - its success paths call more functions than those of the builtin operation, e.g. because an operation is no longer inlined, or
+#   - its longest success path has more instructions than that of the builtin operation, plus the budget of its policy or of the probe itself.
+# OUTPUT receives the instructions and calls of every probe, so that two builds can be diffed.
+# The disassembly is read in the syntax of x86-64, and the audit is skipped on other processors.
+
+cmake_minimum_required(VERSION 3.13)
+
+# The instructions the longest success path of each policy may add to that of the builtin operation,
+# for add, sub, mul, and shr, and for the operations with larger checks: the shifted out bits of shl,
+# and the division by zero, and the division of the minimum by -1 for the signed types, of div and mod
+set(budget_throw_exception 4)
+set(budget_throw_exception_shl 13)
+set(budget_throw_exception_div 17)
+set(budget_throw_exception_mod 17)
+set(budget_saturate 7)
+set(budget_saturate_shl 15)
+set(budget_saturate_div 13)
+set(budget_saturate_mod 13)
+set(budget_overflow_tuple 7)
+set(budget_overflow_tuple_shl 20)
+set(budget_overflow_tuple_div 17)
+set(budget_overflow_tuple_mod 16)
+set(budget_checked 10)
+set(budget_checked_shl 19)
+set(budget_checked_div 17)
+set(budget_checked_mod 16)
+set(budget_strict 4)
+set(budget_strict_shl 13)
+set(budget_strict_div 12)
+set(budget_strict_mod 12)
+set(budget_wrap 2)
+set(budget_wrap_shl 4)
+set(budget_wrap_div 12)
+set(budget_wrap_mod 12)
+set(budget_expected 15)
+set(budget_expected_shl 28)
+set(budget_expected_div 31)
+set(budget_expected_mod 23)
+
+# The instructions the checks of the 128-bit types may add to the budget, as they work on two registers
+set(budget_128 16)
+
+# The budgets of single probes, which replace those above
+set(budget_u32_throw_exception_add 2)
+set(budget_u64_throw_exception_add 2)
+set(budget_u32_checked_add 8)
+set(budget_u64_checked_add 8)
+
+# The overflow checks of the 128-bit multiplications divide the product by an operand,
+# which calls the division of the runtime library
+foreach(type IN ITEMS u128 i128)
+    foreach(policy IN ITEMS throw_exception saturate overflow_tuple checked strict expected)
+        set(budget_${type}_${policy}_mul 96)
+        set(allowed_calls_${type}_${policy}_mul 1)
+    endforeach()
+endforeach()
+
+# Functions that report an error, whose calls end a path rather than return to it
+set(error_functions "report_error|throw_exception|__cxa_throw|_Unwind_Resume|^exit$|^abort$|terminate")
+
+# The cold parts the compiler splits out of a function, where a branch leaves the success paths
+set(cold_code "^\\.text\\.unlikely\\.|\\.cold$")
+
+if(NOT OBJDUMP)
+    message(STATUS "No objdump available, the code of the probes is not audited")
+    return()
+endif()
+
+execute_process(COMMAND "${OBJDUMP}" -d -r -C --no-show-raw-insn ${OBJECTS}
+                OUTPUT_VARIABLE disassembly
+                RESULT_VARIABLE objdump_result)
+
+if(NOT objdump_result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed with ${objdump_result}")
+endif()
+
+if(NOT disassembly MATCHES "file format [a-z0-9-]*x86-64")
+    message(STATUS "The audit reads x86-64 code only, the code of the probes is not audited")
+    return()
+endif()
+
+# Propagates the length and calls of the longest path reaching an instruction to the instruction at target
+macro(reach target length calls)
+    if(NOT DEFINED length_${target} OR ${length} GREATER length_${target})
+        set(length_${target} ${length})
+    endif()
+    if(NOT DEFINED calls_${target} OR ${calls} GREATER calls_${target})
+        set(calls_${target} ${calls})
+    endif()
+endmacro()
+
+# A path returning to the caller
+macro(success_path length calls)
+    if(${length} GREATER longest)
+        set(longest ${length})
+    endif()
+    if(${calls} GREATER most_calls)
+        set(most_calls ${calls})
+    endif()
+endmacro()
+
+# Follows the branch of the previous instruction, now that the line after it shows whether it has a relocation:
+# callee is the function called or jumped to, or empty for a branch within the probe
+macro(resolve_branch callee)
+    if(NOT branch STREQUAL "")
+        math(EXPR branch_calls "${branch_calls} + 1")
+
+        if(NOT "${callee}" STREQUAL "" AND ("${callee}" MATCHES "${error_functions}" OR "${callee}" MATCHES "${cold_code}"))
+            # Ends the path, which reports an error
+        elseif(branch STREQUAL "call")
+            set(fall_length ${branch_length})
+            set(fall_calls ${branch_calls})
+        elseif(NOT "${callee}" STREQUAL "")
+            # A jump to another function is a tail call
+            success_path(${branch_length} ${branch_calls})
+        else()
+            # Loops are not followed back
+            math(EXPR branch_to "0x${branch_target}")
+            math(EXPR branch_from "0x${branch_address}")
+            if(branch_to GREATER branch_from)
+                math(EXPR branch_calls "${branch_calls} - 1")
+                reach(${branch_target} ${branch_length} ${branch_calls})
+            endif()
+        endif()
+
+        set(branch "")
+    endif()
+endmacro()
+
+macro(end_probe)
+    resolve_branch("")
+    if(NOT probe STREQUAL "")
+        list(APPEND probes ${probe})
+        set(instructions_${probe} ${longest})
+        set(calls_of_${probe} ${most_calls})
+    endif()
+    set(probe "")
+endmacro()
+
+set(probes "")
+set(probe "")
+set(branch "")
+
+# Brackets in the names of symbols, e.g. of operator[], would keep the lines from splitting into a list
+string(REPLACE ";" "\;" disassembly "${disassembly}")
+string(REPLACE "[" "(" disassembly "${disassembly}")
+string(REPLACE "]" ")" disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-f]+ <(.*)>:$")
+        set(symbol "${CMAKE_MATCH_1}")
+        end_probe()
+
+        # The cold parts split out of a probe are not on its success paths
+        if(NOT symbol MATCHES "\\(clone \\.cold\\)" AND symbol MATCHES "codegen_audit::([a-z0-9_]+)\\(")
+            set(probe "${CMAKE_MATCH_1}")
+            set(longest -1)
+            set(most_calls 0)
+            set(fall_length 0)
+            set(fall_calls 0)
+        endif()
+
+    elseif(NOT probe STREQUAL "" AND line MATCHES "^\t+[0-9a-f]+: R_X86_64_[A-Z0-9_]+\t(.*)$")
+        string(REGEX REPLACE "[-+]0x[0-9a-f]+$" "" callee "${CMAKE_MATCH_1}")
+        resolve_branch("${callee}")
+
+    elseif(NOT probe STREQUAL "" AND line MATCHES "^ *([0-9a-f]+):\t([a-z0-9]+)[ \t]*(.*)$")
+        set(address "${CMAKE_MATCH_1}")
+        set(mnemonic "${CMAKE_MATCH_2}")
+        set(operands "${CMAKE_MATCH_3}")
+        resolve_branch("")
+
+        # The longest path to this instruction, falling through from the previous one or branching to it
+        set(length ${fall_length})
+        set(calls ${fall_calls})
+        if(DEFINED length_${address})
+            if(length_${address} GREATER length)
+                set(length ${length_${address}})
+            endif()
+            if(calls_${address} GREATER calls)
+                set(calls ${calls_${address}})
+            endif()
+            unset(length_${address})
+            unset(calls_${address})
+        endif()
+
+        set(fall_length -1)
+        set(fall_calls -1)
+
+        # Instructions no path reaches, such as the padding after a call that does not return
+        if(length LESS 0)
+            continue()
+        endif()
+
+        # Padding is not counted
+        if(NOT mnemonic MATCHES "nop|^cs$|^data16$" AND NOT operands STREQUAL "%ax,%ax")
+            math(EXPR length "${length} + 1")
+        endif()
+
+        if(mnemonic STREQUAL "ret")
+            success_path(${length} ${calls})
+        elseif(mnemonic STREQUAL "call" OR mnemonic MATCHES "^j")
+            # Followed once the next line shows whether the branch leaves the probe
+            set(branch "${mnemonic}")
+            set(branch_address "${address}")
+            set(branch_target "")
+            if(operands MATCHES "^([0-9a-f]+) <")
+                set(branch_target "${CMAKE_MATCH_1}")
+            endif()
+            set(branch_length ${length})
+            set(branch_calls ${calls})
+
+            if(NOT mnemonic STREQUAL "jmp" AND NOT mnemonic STREQUAL "call")
+                set(fall_length ${length})
+                set(fall_calls ${calls})
+            endif()
+        else()
+            set(fall_length ${length})
+            set(fall_calls ${calls})
+        endif()
+    endif()
+endforeach()
+end_probe()
+
+# Compares each probe to the builtin operation
+set(report "")
+set(failures "")
+set(probe_count 0)
+
+foreach(probe IN LISTS probes)
+    if(probe MATCHES "^([a-z0-9]+)_builtin_")
+        continue()
+    endif()
+
+    if(NOT probe MATCHES "^([a-z0-9]+)_([a-z_]+)_([a-z]+)$")
+        message(FATAL_ERROR "Probe ${probe} is not named <type>_<policy>_<op>")
+    endif()
+
+    set(type "${CMAKE_MATCH_1}")
+    set(policy "${CMAKE_MATCH_2}")
+    set(op "${CMAKE_MATCH_3}")
+    set(builtin "${type}_builtin_${op}")
+
+    if(NOT DEFINED instructions_${builtin})
+        message(FATAL_ERROR "Probe ${probe} has no builtin probe ${builtin}")
+    endif()
+
+    if(DEFINED budget_${probe})
+        set(budget ${budget_${probe}})
+    elseif(DEFINED budget_${policy}_${op})
+        set(budget ${budget_${policy}_${op}})
+    else()
+        set(budget ${budget_${policy}})
+    endif()
+
+    if(type MATCHES "128$" AND NOT DEFINED budget_${probe})
+        math(EXPR budget "${budget} + ${budget_128}")
+    endif()
+
+    set(allowed_calls ${calls_of_${builtin}})
+    if(DEFINED allowed_calls_${probe})
+        math(EXPR allowed_calls "${allowed_calls} + ${allowed_calls_${probe}}")
+    endif()
+
+    math(EXPR limit "${instructions_${builtin}} + ${budget}")
+    math(EXPR probe_count "${probe_count} + 1")
+
+    set(status "ok")
+    if(instructions_${probe} LESS 0)
+        set(status "FAIL: no path returns")
+    elseif(calls_of_${probe} GREATER allowed_calls)
+        set(status "FAIL: ${calls_of_${probe}} calls on the success path, over the ${allowed_calls} allowed")
+    elseif(instructions_${probe} GREATER limit)
+        set(status "FAIL: ${instructions_${probe}} instructions on the success path, over the budget of ${limit}")
+    endif()
+
+    string(APPEND report "${probe} ${instructions_${probe}} instructions ${calls_of_${probe}} calls, "
+                         "builtin ${instructions_${builtin}} instructions ${calls_of_${builtin}} calls, budget ${limit}: ${status}\n")
+
+    if(NOT status STREQUAL "ok")
+        list(APPEND failures "${probe}: ${status}")
+    endif()
+endforeach()
+
+if(OUTPUT)
+    file(WRITE "${OUTPUT}" "${report}")
+    message(STATUS "Instructions and calls of every probe written to ${OUTPUT}")
+endif()
+
+list(LENGTH failures failure_count)
+message(STATUS "Probes: ${probe_count}")
+
+if(failure_count GREATER 0)
+    string(REPLACE ";" "\n  " failures "${failures}")
+    message(FATAL_ERROR "${failure_count} probes are over their budget:\n  ${failures}")
+endif()
+
+message(STATUS "Every probe is within its budget")
@@ -0,0 +1,82 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Probe functions for the boost_safe_numbers_codegen_audit CMake target, see codegen_audit.cmake:
+// every scalar operation of every type with the policies that return their result without a side channel,
+// each next to the same operation on the basis type, named <type>_<policy>_<op> and <type>_builtin_<op>.
+// The target disassembles them and fails if an operation calls a function on its success path,
+// or executes more instructions than its budget over the builtin operation.
+
+#include <boost/safe_numbers.hpp>
+
+namespace boost::safe_numbers::codegen_audit {
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, op, expr)                                       \
+auto T##_builtin_##op(const detail::underlying_type_t<T> lhs, const detail::underlying_type_t<T> rhs) \
+{                                                                                                   \
+    return static_cast<detail::underlying_type_t<T>>(expr);                                         \
+}
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, op)                                             \
+auto T##_##policy##_##op(const T lhs, const T rhs)                                                  \
+{                                                                                                   \
+    return op<overflow_policy::policy>(lhs, rhs);                                                   \
+}
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, policy)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, add)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, sub)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, mul)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, div)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, mod)
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_PROBES(T)                                                        \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, add, lhs + rhs)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, sub, lhs - rhs)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, mul, lhs * rhs)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, div, lhs / rhs)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, mod, lhs % rhs)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, throw_exception)                                        \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, saturate)                                               \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, overflow_tuple)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, checked)                                                \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, strict)                                                 \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, wrap)                                                   \
+BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES(T, expected)
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, policy)                                          \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, shl)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBE(T, policy, shr)
+
+#define BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(T)                                               \
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(T)                                                                \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, shl, lhs << (rhs % std::numeric_limits<detail::underlying_type_t<T>>::digits)) \
+BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE(T, shr, lhs >> (rhs % std::numeric_limits<detail::underlying_type_t<T>>::digits)) \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, throw_exception)                                         \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, saturate)                                                \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, overflow_tuple)                                          \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, checked)                                                 \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, strict)                                                  \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, wrap)                                                    \
+BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES(T, expected)
+
+BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(u8)
+BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(u16)
+BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(u32)
+BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(u64)
+BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES(u128)
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(i8)
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(i16)
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(i32)
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(i64)
+BOOST_SAFE_NUMBERS_CODEGEN_PROBES(i128)
+
+#undef BOOST_SAFE_NUMBERS_CODEGEN_UNSIGNED_PROBES
+#undef BOOST_SAFE_NUMBERS_CODEGEN_SHIFT_PROBES
+#undef BOOST_SAFE_NUMBERS_CODEGEN_PROBES
+#undef BOOST_SAFE_NUMBERS_CODEGEN_POLICY_PROBES
+#undef BOOST_SAFE_NUMBERS_CODEGEN_PROBE
+#undef BOOST_SAFE_NUMBERS_CODEGEN_BUILTIN_PROBE
+
+} // namespace boost::safe_numbers::codegen_audit
@@ -0,0 +1,168 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Counts the cycles, instructions, branches, branch misses, and L1 instruction cache misses
+// of the calling thread over a region of code, with perf_event_open on Linux.
+// Elsewhere, or when the kernel does not permit the counters, e.g. because of perf_event_paranoid or in a virtual machine,
+// available() is false and why() says why, so that a benchmark can report its time only.
+
+#ifndef BOOST_SAFE_NUMBERS_BENCHMARKS_HARDWARE_COUNTERS_HPP
+#define BOOST_SAFE_NUMBERS_BENCHMARKS_HARDWARE_COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/perf_event.h>)
+#    define BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+#  endif
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <cerrno>
+#  include <cstring>
+#endif
+
+namespace benchmark {
+
+inline constexpr std::size_t hardware_counter_count {5U};
+
+inline constexpr const char* hardware_counter_names[hardware_counter_count] {
+    "cycles", "instructions", "branches", "branch_misses", "l1i_misses"
+};
+
+// The counts of a region in the order of hardware_counter_names, or -1 for those the processor does not count
+using hardware_counts = std::array<std::int64_t, hardware_counter_count>;
+
+class hardware_counters
+{
+private:
+
+    std::string why_;
+
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+
+    // The cycles counter leads the group, so that all of them count over the same time
+    std::array<int, hardware_counter_count> fds_ {-1, -1, -1, -1, -1};
+
+    static auto open(const std::uint32_t type, const std::uint64_t config, const int group) noexcept -> int
+    {
+        perf_event_attr attr {};
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = group == -1 ? 1U : 0U;
+        attr.exclude_kernel = 1U;
+        attr.exclude_hv = 1U;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group, PERF_FLAG_FD_CLOEXEC));
+    }
+
+#endif
+
+public:
+
+    hardware_counters()
+    {
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+
+        fds_[0] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (fds_[0] == -1)
+        {
+            why_ = std::string {"perf_event_open: "} + std::strerror(errno);
+            return;
+        }
+
+        fds_[1] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, fds_[0]);
+        fds_[2] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS, fds_[0]);
+        fds_[3] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, fds_[0]);
+        fds_[4] = open(PERF_TYPE_HW_CACHE,
+                       PERF_COUNT_HW_CACHE_L1I | (PERF_COUNT_HW_CACHE_OP_READ << 8U) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U),
+                       fds_[0]);
+
+#else
+
+        why_ = "hardware counters are only supported on Linux";
+
+#endif
+    }
+
+    hardware_counters(const hardware_counters&) = delete;
+    auto operator=(const hardware_counters&) -> hardware_counters& = delete;
+
+    ~hardware_counters()
+    {
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+        for (const auto fd : fds_)
+        {
+            if (fd != -1)
+            {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    [[nodiscard]] auto available() const noexcept -> bool { return why_.empty(); }
+
+    // Why the counters are not available
+    [[nodiscard]] auto why() const noexcept -> const std::string& { return why_; }
+
+    void start() noexcept
+    {
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+        if (available())
+        {
+            ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    // The counts since start, scaled up when the kernel had to share the counters with other groups
+    [[nodiscard]] auto stop() noexcept -> hardware_counts
+    {
+        hardware_counts counts {-1, -1, -1, -1, -1};
+
+#ifdef BOOST_SAFE_NUMBERS_BENCHMARKS_HAS_PERF_EVENT
+        if (!available())
+        {
+            return counts;
+        }
+
+        ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // nr, time_enabled, time_running, and the value of each counter of the group in the order they were opened
+        std::uint64_t data[3U + hardware_counter_count] {};
+        if (read(fds_[0], data, sizeof(data)) <= 0 || data[2] == 0U)
+        {
+            return counts;
+        }
+
+        const auto scale {static_cast<double>(data[1]) / static_cast<double>(data[2])};
+
+        std::size_t value {3U};
+        for (std::size_t i {}; i < hardware_counter_count && value < 3U + data[0]; ++i)
+        {
+            if (fds_[i] != -1)
+            {
+                counts[i] = static_cast<std::int64_t>(static_cast<double>(data[value++]) * scale);
+            }
+        }
+#endif
+
+        return counts;
+    }
+};
+
+} // namespace benchmark
+
+#endif // BOOST_SAFE_NUMBERS_BENCHMARKS_HARDWARE_COUNTERS_HPP
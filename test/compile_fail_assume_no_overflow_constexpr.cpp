@@ -0,0 +1,17 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+#include <boost/safe_numbers.hpp>
+
+using namespace boost::safe_numbers;
+
+int main()
+{
+    // This should fail to compile: constant evaluation is still checked
+    constexpr auto c = u8{200U} + u8{100U};
+
+    return static_cast<int>(static_cast<std::uint8_t>(c));
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/safe_numbers.hpp>
+
+using namespace boost::safe_numbers;
+
+int main()
+{
+    constexpr safe<u32, overflow_policy::saturate> a {u32{10}};
+    constexpr safe<u32, overflow_policy::wrap> b {u32{10}};
+
+    // This should fail to compile: different policies
+    auto c = a + b;
+
+    return 0;
+}
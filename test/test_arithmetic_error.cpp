@@ -0,0 +1,349 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#endif
+
+// Counts the allocations made while an error is caught and logged
+static std::size_t allocation_count {};
+
+// Once these are inlined into the same function, GCC sees the free of a pointer returned by new
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(const std::size_t size)
+{
+    ++allocation_count;
+
+    if (void* ptr {std::malloc(size == 0U ? 1U : size)}; ptr != nullptr)
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#  pragma GCC diagnostic pop
+#endif
+
+using namespace boost::safe_numbers;
+
+static_assert(std::is_base_of_v<std::overflow_error, arithmetic_overflow_error>);
+static_assert(std::is_base_of_v<std::underflow_error, arithmetic_underflow_error>);
+static_assert(std::is_base_of_v<std::domain_error, arithmetic_domain_error>);
+static_assert(std::is_base_of_v<arithmetic_error, arithmetic_overflow_error>);
+static_assert(!std::is_base_of_v<std::exception, arithmetic_error>);
+
+// -----------------------------------------------
+// Errors of single operations carry the operation and the operands
+// -----------------------------------------------
+
+void test_binary_operation()
+{
+    try
+    {
+        const auto res {u32{UINT32_MAX} + u32{1U}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::add);
+        BOOST_TEST_CSTR_EQ(e.type_name(), "u32");
+        BOOST_TEST(!e.is_signed());
+        BOOST_TEST(e.lhs() == boost::int128::uint128_t{UINT32_MAX});
+        BOOST_TEST(e.rhs() == boost::int128::uint128_t{1U});
+        BOOST_TEST_CSTR_EQ(e.message(), "Overflow detected in u32 addition");
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u32 addition (lhs = 4294967295, rhs = 1)");
+    }
+
+    // Signed operands are formatted with their sign
+    try
+    {
+        const auto res {i8{-100} - i8{100}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const std::underflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Underflow detected in i8 subtraction (lhs = -100, rhs = 100)");
+    }
+
+    // The widest operands fit
+    try
+    {
+        const auto res {i128{std::numeric_limits<boost::int128::int128_t>::min()} * i128{boost::int128::int128_t{-1}}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_error& e)
+    {
+        BOOST_TEST(e.is_signed());
+        BOOST_TEST(e.rhs() == std::numeric_limits<boost::int128::uint128_t>::max());
+        BOOST_TEST_CSTR_EQ(dynamic_cast<const std::exception&>(e).what(),
+                           "Overflow detected in i128 multiplication (lhs = -170141183460469231731687303715884105728, rhs = -1)");
+    }
+}
+
+void test_unary_operation()
+{
+    try
+    {
+        auto value {u8{UINT8_MAX}};
+        ++value;
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::inc);
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 increment (operand = 255)");
+    }
+
+    try
+    {
+        const auto res {-i16{INT16_MIN}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_domain_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::neg);
+        BOOST_TEST(std::strstr(e.what(), "(operand = -32768)") != nullptr);
+    }
+}
+
+// -----------------------------------------------
+// Errors in the arguments of a function only have the message
+// -----------------------------------------------
+
+void test_argument_error()
+{
+    const std::array<u32, 2> lhs {};
+    const std::array<u32, 3> rhs {};
+    std::array<u32, 2> res {};
+
+    try
+    {
+        add<overflow_policy::throw_exception>(std::span<const u32>{lhs}, std::span<const u32>{rhs}, std::span<u32>{res});
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_domain_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::none);
+        BOOST_TEST(e.type_name() == nullptr);
+        BOOST_TEST_CSTR_EQ(e.what(), e.message());
+    }
+}
+
+// -----------------------------------------------
+// Errors of span, divider, reduction, and bounded operations carry the failing operands
+// -----------------------------------------------
+
+void test_span_and_bounded_operation()
+{
+    // Messages built when the error is found are copied into the exception
+    const std::array<u8, 3> values {u8{1U}, u8{2U}, u8{UINT8_MAX}};
+
+    std::array<u8, 3> doubled {};
+
+    try
+    {
+        add<overflow_policy::throw_exception>(std::span<const u8>{values}, std::span<const u8>{values}, std::span<u8>{doubled});
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::add);
+        BOOST_TEST_CSTR_EQ(e.type_name(), "u8");
+        BOOST_TEST(e.lhs() == boost::int128::uint128_t{UINT8_MAX});
+        BOOST_TEST(e.rhs() == boost::int128::uint128_t{UINT8_MAX});
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 addition at index 2 (lhs = 255, rhs = 255)");
+    }
+
+    // The only quotient that overflows is min / -1
+    const std::array<i32, 2> numerators {i32{7}, i32{std::numeric_limits<std::int32_t>::min()}};
+    std::array<i32, 2> quotients {};
+
+    try
+    {
+        div<overflow_policy::throw_exception>(std::span<const i32>{numerators}, divider<i32>{i32{-1}}, std::span<i32>{quotients});
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::div);
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in i32 division at index 1 (lhs = -2147483648, rhs = -1)");
+    }
+
+    // A reduction passes its result modulo 2^digits and the limit that it passed
+    try
+    {
+        static_cast<void>(sum<overflow_policy::throw_exception>(std::span<const u8>{values}));
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::add);
+        BOOST_TEST(e.lhs() == boost::int128::uint128_t{2U});
+        BOOST_TEST(e.rhs() == boost::int128::uint128_t{UINT8_MAX});
+    }
+
+    try
+    {
+        const auto res {bounded_uint<0U, 100U>{60U} + bounded_uint<0U, 100U>{50U}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_domain_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::add);
+        BOOST_TEST_CSTR_EQ(e.type_name(), "u8");
+        BOOST_TEST_CSTR_EQ(e.what(), "bounded_uint addition result out of range (lhs = 60, rhs = 50)");
+    }
+
+    try
+    {
+        const bounded_int<-10, 10> res {11};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_domain_error& e)
+    {
+        BOOST_TEST(e.op() == arithmetic_op::conversion);
+        BOOST_TEST_CSTR_EQ(e.what(), "bounded_int value out of range (operand = 11)");
+    }
+}
+
+// -----------------------------------------------
+// Catching, copying, and logging do not allocate
+// -----------------------------------------------
+
+void test_no_allocation()
+{
+    try
+    {
+        const auto res {u64{UINT64_MAX} * u64{2U}};
+        static_cast<void>(res);
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_overflow_error& e)
+    {
+        const auto before {allocation_count};
+
+        const auto copy {e};
+        const auto info {e.info()};
+        const char* what {e.what()};
+
+        BOOST_TEST_EQ(allocation_count, before);
+
+        BOOST_TEST(info.op == arithmetic_op::mul);
+        BOOST_TEST_CSTR_EQ(info.message, "Overflow detected in u64 multiplication");
+        BOOST_TEST_CSTR_EQ(copy.what(), what);
+        BOOST_TEST(copy.location().line() == e.location().line());
+    }
+}
+
+// -----------------------------------------------
+// what() may be called from several threads at once
+// -----------------------------------------------
+
+void test_concurrent_what()
+{
+    try
+    {
+        static_cast<void>(i32{std::numeric_limits<std::int32_t>::min()} - i32{1});
+        BOOST_TEST(false);
+    }
+    catch (const arithmetic_underflow_error& e)
+    {
+        constexpr int thread_count {4};
+        std::array<const char*, thread_count> results {};
+
+        std::vector<std::thread> threads;
+        for (int t {}; t < thread_count; ++t)
+        {
+            threads.emplace_back([&e, &results, t]
+            {
+                results[static_cast<std::size_t>(t)] = e.what();
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto result : results)
+        {
+            BOOST_TEST_CSTR_EQ(result, "Underflow detected in i32 subtraction (lhs = -2147483648, rhs = 1)");
+        }
+    }
+}
+
+// -----------------------------------------------
+// The runtime handler sees the same description
+// -----------------------------------------------
+
+static arithmetic_op handled_op {arithmetic_op::none};
+
+void record_op(const overflow_info& info)
+{
+    handled_op = info.op;
+}
+
+void test_handler()
+{
+    const auto previous {set_overflow_handler(record_op)};
+
+    BOOST_TEST_THROWS(static_cast<void>(u16{2U} - u16{3U}), arithmetic_underflow_error);
+    BOOST_TEST(handled_op == arithmetic_op::sub);
+
+    set_overflow_handler(previous);
+}
+
+int main()
+{
+    test_binary_operation();
+    test_unary_operation();
+    test_argument_error();
+    test_span_and_bounded_operation();
+    test_no_allocation();
+    test_concurrent_what();
+    test_handler();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// With BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW the types and their results are unchanged for operations that do not overflow,
+// and constant evaluation is still checked (see compile_fail_assume_no_overflow_constexpr.cpp)
+
+#define BOOST_SAFE_NUMBERS_ASSUME_NO_OVERFLOW
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+using namespace boost::safe_numbers;
+
+template <typename T>
+void test_unsigned()
+{
+    using basis_type = typename T::basis_type;
+
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+
+    const T big {static_cast<basis_type>(max - 1U)};
+    const T two {basis_type{2U}};
+
+    BOOST_TEST(big + T{basis_type{1U}} == T{max});
+    BOOST_TEST(big - two == T{static_cast<basis_type>(max - 3U)});
+    BOOST_TEST(two * two == T{basis_type{4U}});
+    BOOST_TEST(big / two == T{static_cast<basis_type>((max - 1U) / 2U)});
+    BOOST_TEST(big % two == T{basis_type{0U}});
+    BOOST_TEST((two << two) == T{basis_type{8U}});
+    BOOST_TEST((big >> two) == T{static_cast<basis_type>((max - 1U) >> 2U)});
+
+    auto value {two};
+    ++value;
+    value *= two;
+    value--;
+    BOOST_TEST(value == T{basis_type{5U}});
+    BOOST_TEST(static_cast<std::uint8_t>(value) == std::uint8_t{5U});
+
+    // The other policies keep their behavior on overflow
+    BOOST_TEST(saturating_add(T{max}, two) == T{max});
+    BOOST_TEST(!checked_mul(T{max}, two).has_value());
+    BOOST_TEST(overflowing_sub(T{basis_type{0U}}, two).second);
+
+    // A division by zero is an error in the arguments, which is still reported with every policy
+    const T zero {basis_type{0U}};
+    BOOST_TEST_THROWS(std::ignore = big / zero, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = big % zero, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = saturating_div(big, zero), std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = overflowing_mod(big, zero), std::domain_error);
+}
+
+template <typename T>
+void test_signed()
+{
+    using basis_type = typename T::basis_type;
+
+    constexpr auto min {std::numeric_limits<basis_type>::min()};
+
+    const T low {static_cast<basis_type>(min + 2)};
+    const T minus_one {basis_type{-1}};
+
+    BOOST_TEST(low + minus_one + minus_one == T{min});
+    BOOST_TEST(-low == T{static_cast<basis_type>(-(min + 2))});
+    BOOST_TEST(low * minus_one == -low);
+    BOOST_TEST(low / minus_one == -low);
+    BOOST_TEST(low % minus_one == T{basis_type{0}});
+    BOOST_TEST(static_cast<std::int8_t>(minus_one) == std::int8_t{-1});
+    BOOST_TEST(saturating_sub(T{min}, T{basis_type{1}}) == T{min});
+
+    const T zero {basis_type{0}};
+    BOOST_TEST_THROWS(std::ignore = low / zero, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = low % zero, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = saturating_div(low, zero), std::domain_error);
+}
+
+void test_bounded()
+{
+    using percent = bounded_uint<0U, 100U>;
+    using offset = bounded_int<-10, 10>;
+
+    BOOST_TEST(percent{40U} + percent{60U} == percent{100U});
+    BOOST_TEST(percent{60U} - percent{40U} == percent{20U});
+    BOOST_TEST(offset{-5} * offset{2} == offset{-10});
+    BOOST_TEST(static_cast<std::uint8_t>(percent{100U}) == std::uint8_t{100U});
+
+    const std::vector<std::uint8_t> raw {1U, 50U, 100U};
+    std::vector<percent> values(raw.size(), percent{0U});
+    percent::from_span(raw, values);
+    BOOST_TEST(values[2] == percent{100U});
+
+    // Errors in the arguments rather than the values are still reported
+    std::vector<percent> too_small(2U, percent{0U});
+    BOOST_TEST_THROWS(percent::from_span(raw, too_small), std::domain_error);
+
+    const std::vector<std::uint8_t> out_of_range {1U, 200U};
+    std::vector<percent> converted(out_of_range.size(), percent{0U});
+    BOOST_TEST_THROWS(percent::from_span(out_of_range, converted), std::domain_error);
+    BOOST_TEST_THROWS(percent{101U}, std::domain_error);
+    BOOST_TEST_THROWS(offset{11}, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = percent{50U} / percent{0U}, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = percent{50U} % percent{0U}, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = offset{5} / offset{0}, std::domain_error);
+    BOOST_TEST_THROWS(std::ignore = offset{5} % offset{0}, std::domain_error);
+}
+
+// constexpr evaluation is unchanged
+static_assert(u8{200U} + u8{55U} == u8{255U});
+static_assert(i16{-300} * i16{100} == i16{-30000});
+static_assert(bounded_uint<1U, 10U>{5U} * bounded_uint<1U, 10U>{2U} == bounded_uint<1U, 10U>{10U});
+
+int main()
+{
+    test_unsigned<u8>();
+    test_unsigned<u16>();
+    test_unsigned<u32>();
+    test_unsigned<u64>();
+    test_unsigned<u128>();
+
+    test_signed<i8>();
+    test_signed<i16>();
+    test_signed<i32>();
+    test_signed<i64>();
+    test_signed<i128>();
+
+    test_bounded();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+using boost::int128::uint128_t;
+using boost::int128::int128_t;
+
+// Spans several blocks, and ends part way through one
+inline constexpr std::size_t N {1000};
+
+// Every value in [Min, Max], repeated up to N elements
+template <typename Raw>
+auto make_in_range(const Raw min_raw, const Raw max_raw) -> std::vector<Raw>
+{
+    std::vector<Raw> values;
+    auto value {min_raw};
+    while (values.size() < N)
+    {
+        values.push_back(value);
+        value = value == max_raw ? min_raw : static_cast<Raw>(value + static_cast<Raw>(1));
+    }
+
+    return values;
+}
+
+template <typename Bounded, typename Raw>
+void test_from_span(const Raw min_raw, const Raw max_raw)
+{
+    const auto values {make_in_range(min_raw, max_raw)};
+    std::vector<Bounded> converted(values.size(), Bounded{min_raw});
+
+    Bounded::from_span(values, converted);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST(converted[i] == Bounded{values[i]});
+        BOOST_TEST(converted[i] == (Bounded{unchecked, values[i]}));
+    }
+
+    // Every position of an out of range value is reported, both below Min and above Max
+    for (const auto index : {std::size_t{0}, std::size_t{1}, std::size_t{255}, std::size_t{256}, std::size_t{511}, N - 1U})
+    {
+        for (const auto bad_value : {static_cast<Raw>(min_raw - static_cast<Raw>(1)), static_cast<Raw>(max_raw + static_cast<Raw>(1))})
+        {
+            auto bad_values {values};
+            bad_values[index] = bad_value;
+
+            // Not possible when the bound is the limit of the raw type
+            if (bad_value >= min_raw && bad_value <= max_raw)
+            {
+                continue;
+            }
+
+            try
+            {
+                Bounded::from_span(bad_values, converted);
+                BOOST_TEST(false);
+            }
+            catch (const std::domain_error& e)
+            {
+                const std::string msg {e.what()};
+                BOOST_TEST(msg.find(" at index " + std::to_string(index) + " (operand = ") != std::string::npos);
+            }
+
+            // Once there are two, the first is reported
+            if (index > 0U)
+            {
+                bad_values[N - 1U] = bad_value;
+                BOOST_TEST_THROWS(Bounded::from_span(bad_values, converted), std::domain_error);
+            }
+        }
+    }
+
+    std::vector<Bounded> too_short(values.size() - 1U, Bounded{min_raw});
+    BOOST_TEST_THROWS(Bounded::from_span(values, too_short), std::domain_error);
+
+    // Empty spans are valid
+    Bounded::from_span(std::span<const Raw>{}, std::span<Bounded>{});
+}
+
+// -----------------------------------------------
+// Exact message for the first out of range index
+// -----------------------------------------------
+
+void test_messages()
+{
+    const std::array<std::uint8_t, 5> codes {1U, 2U, 9U, 3U, 10U};
+    std::vector<bounded_uint<1u, 8u>> states(codes.size(), bounded_uint<1u, 8u>{std::uint8_t{1U}});
+
+    try
+    {
+        bounded_uint<1u, 8u>::from_span(codes, states);
+        BOOST_TEST(false);
+    }
+    catch (const std::domain_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "bounded_uint value out of range at index 2 (operand = 9)");
+    }
+
+    const std::array<std::int16_t, 3> offsets {-5, 0, -300};
+    std::vector<bounded_int<-256, 255>> clamped(offsets.size(), bounded_int<-256, 255>{std::int16_t{0}});
+
+    try
+    {
+        bounded_int<-256, 255>::from_span(offsets, clamped);
+        BOOST_TEST(false);
+    }
+    catch (const std::domain_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "bounded_int value out of range at index 2 (operand = -300)");
+    }
+}
+
+// -----------------------------------------------
+// constexpr construction
+// -----------------------------------------------
+
+consteval auto constexpr_from_span() -> bool
+{
+    using bounded_type = bounded_uint<100u, 400u>;
+
+    constexpr std::array<std::uint16_t, 4> raw {100U, 200U, 300U, 400U};
+    constexpr bounded_type fill {std::uint16_t{100U}};
+    std::array<bounded_type, 4> values {fill, fill, fill, fill};
+    bounded_type::from_span(raw, values);
+
+    return values[2] == bounded_type{unchecked, std::uint16_t{300U}};
+}
+
+static_assert(constexpr_from_span());
+static_assert(bounded_int<-10, 10>{unchecked, i8{-3}} == bounded_int<-10, 10>{i8{-3}});
+
+int main()
+{
+    test_from_span<bounded_uint<0u, 255u>>(std::uint8_t{0U}, std::uint8_t{255U});
+    test_from_span<bounded_uint<3u, 200u>>(std::uint8_t{3U}, std::uint8_t{200U});
+    test_from_span<bounded_uint<1000u, 40000u>>(std::uint16_t{1000U}, std::uint16_t{40000U});
+    test_from_span<bounded_uint<0u, 100000u>>(std::uint32_t{0U}, std::uint32_t{100000U});
+    test_from_span<bounded_uint<7ULL, 5'000'000'000ULL>>(std::uint64_t{7U}, std::uint64_t{5'000'000'000ULL});
+    test_from_span<bounded_uint<uint128_t{1}, uint128_t{1, 0}>>(uint128_t{1}, uint128_t{1, 0});
+
+    test_from_span<bounded_int<-128, 127>>(std::int8_t{-128}, std::int8_t{127});
+    test_from_span<bounded_int<-100, 100>>(std::int8_t{-100}, std::int8_t{100});
+    test_from_span<bounded_int<-1000, 30000>>(std::int16_t{-1000}, std::int16_t{30000});
+    test_from_span<bounded_int<-100000, 100000>>(std::int32_t{-100000}, std::int32_t{100000});
+    test_from_span<bounded_int<-5'000'000'000LL, 5'000'000'000LL>>(std::int64_t{-5'000'000'000LL}, std::int64_t{5'000'000'000LL});
+    test_from_span<bounded_int<int128_t{-1, 0}, int128_t{1, 0}>>(int128_t{-1, 0}, int128_t{1, 0});
+
+    test_messages();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,321 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/conversions.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+using wide_pattern = boost::int128::uint128_t;
+
+inline std::mt19937_64 rng{42};
+inline constexpr std::size_t N {1027};
+
+// Every power of two, its neighbours, and their negations as 128-bit patterns,
+// which when truncated to a type include every boundary of every narrower type
+template <typename T>
+auto make_values() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using lane_type = detail::impl::span_lane_t<basis_type>;
+
+    std::vector<T> values;
+    for (int shift {}; shift < 128; ++shift)
+    {
+        const auto power {wide_pattern{1U} << shift};
+        for (const auto pattern : {power, power - 1U, power + 1U})
+        {
+            values.emplace_back(static_cast<basis_type>(static_cast<lane_type>(pattern)));
+            values.emplace_back(static_cast<basis_type>(static_cast<lane_type>(wide_pattern{0U} - pattern)));
+        }
+    }
+
+    boost::random::uniform_int_distribution<wide_pattern> dist {std::numeric_limits<wide_pattern>::min(),
+                                                                std::numeric_limits<wide_pattern>::max()};
+    boost::random::uniform_int_distribution<int> shift_dist {0, 127};
+    while (values.size() < N)
+    {
+        // Random values of every magnitude
+        const auto pattern {dist(rng) >> shift_dist(rng)};
+        values.emplace_back(static_cast<basis_type>(static_cast<lane_type>(pattern)));
+    }
+
+    return values;
+}
+
+// The value as a sign and a magnitude, which can hold any value of any type
+template <typename T>
+auto to_sign_magnitude(const T value) -> std::pair<bool, wide_pattern>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using lane_type = detail::impl::span_lane_t<basis_type>;
+
+    const auto basis {static_cast<basis_type>(value)};
+    const auto lane {static_cast<lane_type>(basis)};
+
+    if (basis < basis_type{0})
+    {
+        return {true, wide_pattern{static_cast<lane_type>(lane_type{0} - lane)}};
+    }
+
+    return {false, wide_pattern{lane}};
+}
+
+template <typename To, typename From>
+auto reference_in_range(const From value) -> bool
+{
+    using to_basis = detail::underlying_type_t<To>;
+
+    const auto [negative, magnitude] {to_sign_magnitude(value)};
+    const auto max_magnitude {wide_pattern{static_cast<detail::impl::span_lane_t<to_basis>>(std::numeric_limits<to_basis>::max())}};
+
+    if (negative)
+    {
+        // |min| is one more than max for signed types
+        return std::numeric_limits<to_basis>::is_signed && magnitude <= max_magnitude + 1U;
+    }
+
+    return magnitude <= max_magnitude;
+}
+
+template <typename To, typename From>
+auto reference_wrapped(const From value) -> To
+{
+    using to_basis = detail::underlying_type_t<To>;
+
+    const auto [negative, magnitude] {to_sign_magnitude(value)};
+    const auto pattern {negative ? wide_pattern{0U} - magnitude : magnitude};
+
+    return To{static_cast<to_basis>(static_cast<detail::impl::span_lane_t<to_basis>>(pattern))};
+}
+
+// =============================================================================
+// Scalar conversions against the sign and magnitude reference
+// =============================================================================
+
+template <typename To, typename From>
+void test_scalar()
+{
+    for (const auto value : make_values<From>())
+    {
+        const auto in_range {reference_in_range<To>(value)};
+        const auto wrapped {reference_wrapped<To>(value)};
+
+        const auto checked {checked_cast<To>(value)};
+        BOOST_TEST(checked.has_value() == in_range);
+        if (checked.has_value())
+        {
+            BOOST_TEST(*checked == wrapped);
+
+            // Converting back is lossless
+            BOOST_TEST(checked_cast<From>(*checked) == std::make_optional(value));
+        }
+
+        const auto [overflowing, overflowed] {overflowing_cast<To>(value)};
+        BOOST_TEST(overflowing == wrapped);
+        BOOST_TEST(overflowed == !in_range);
+
+        const auto saturated {saturate_cast<To>(value)};
+        if (in_range)
+        {
+            BOOST_TEST(saturated == wrapped);
+        }
+        else if (to_sign_magnitude(value).first)
+        {
+            BOOST_TEST(saturated == std::numeric_limits<To>::min());
+        }
+        else
+        {
+            BOOST_TEST(saturated == std::numeric_limits<To>::max());
+        }
+    }
+}
+
+template <typename From, typename... To>
+void test_scalar_from()
+{
+    (test_scalar<To, From>(), ...);
+}
+
+template <typename... Types>
+void test_all_scalar_pairs()
+{
+    (test_scalar_from<Types, Types...>(), ...);
+}
+
+// =============================================================================
+// Span conversions match the scalar conversions
+// =============================================================================
+
+template <typename To, typename From>
+void test_span()
+{
+    const auto values {make_values<From>()};
+    std::vector<To> converted(values.size());
+    std::vector<std::uint64_t> bitmap(overflow_bitmap_size(values.size()), UINT64_MAX);
+
+    saturate_cast(std::span{values}, std::span{converted});
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST(converted[i] == saturate_cast<To>(values[i]));
+    }
+
+    bool any_out_of_range {};
+    const auto overflowed {overflowing_cast(std::span{values}, std::span{converted}, std::span{bitmap})};
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        const auto [wrapped, out_of_range] {overflowing_cast<To>(values[i])};
+        BOOST_TEST(converted[i] == wrapped);
+        BOOST_TEST(((bitmap[i / 64U] >> (i % 64U)) & 1U) == static_cast<std::uint64_t>(out_of_range));
+        any_out_of_range = any_out_of_range || out_of_range;
+    }
+    BOOST_TEST(overflowed == any_out_of_range);
+    BOOST_TEST_EQ(bitmap.back() >> (values.size() % 64U), 0U);
+
+    std::ranges::fill(converted, To{});
+    BOOST_TEST(checked_cast(std::span{values}, std::span{converted}) == !any_out_of_range);
+    for (std::size_t i {}; i < values.size(); ++i)
+    {
+        BOOST_TEST(converted[i] == overflowing_cast<To>(values[i]).first);
+    }
+
+    // A source that is entirely in range
+    std::vector<From> small_values;
+    for (const auto value : values)
+    {
+        if (reference_in_range<To>(value))
+        {
+            small_values.push_back(value);
+        }
+    }
+    std::vector<To> small_converted(small_values.size());
+    BOOST_TEST(checked_cast<To>(std::span<const From>{small_values}, std::span{small_converted}));
+    BOOST_TEST(!overflowing_cast(std::span{small_values}, std::span{small_converted}, std::span{bitmap}));
+
+    std::vector<To> too_short(values.size() - 1U);
+    BOOST_TEST_THROWS(saturate_cast(std::span{values}, std::span{too_short}), std::domain_error);
+    BOOST_TEST_THROWS(checked_cast(std::span{values}, std::span{too_short}), std::domain_error);
+    BOOST_TEST_THROWS(overflowing_cast(std::span{values}, std::span{converted}, std::span{bitmap}.first(1U)), std::domain_error);
+}
+
+// =============================================================================
+// Down-converting a u64 column for storage
+// =============================================================================
+
+void test_column_storage()
+{
+    const std::vector<u64> column {u64{0U}, u64{65'535U}, u64{65'536U}, u64{UINT64_MAX}, u64{12U}};
+    std::vector<u16> stored(column.size());
+
+    BOOST_TEST(!checked_cast(std::span{column}, std::span{stored}));
+
+    saturate_cast(std::span{column}, std::span{stored});
+    BOOST_TEST(stored[0] == u16{0U});
+    BOOST_TEST(stored[1] == u16{65'535U});
+    BOOST_TEST(stored[2] == u16{65'535U});
+    BOOST_TEST(stored[3] == u16{65'535U});
+    BOOST_TEST(stored[4] == u16{12U});
+
+    std::vector<std::uint64_t> overflows(overflow_bitmap_size(column.size()));
+    BOOST_TEST(overflowing_cast(std::span{column}, std::span{stored}, std::span{overflows}));
+    BOOST_TEST_EQ(overflows[0], 0b01100U);
+    BOOST_TEST(stored[2] == u16{0U});
+}
+
+static_assert(saturate_cast<u8>(i32{-5}) == u8{0U});
+static_assert(saturate_cast<i8>(u64{1000U}) == i8{127});
+static_assert(!checked_cast<u32>(i64{-1}).has_value());
+static_assert(overflowing_cast<u16>(u32{65'537U}) == std::make_pair(u16{1U}, true));
+
+int main()
+{
+    test_all_scalar_pairs<u8, u16, u32, u64, u128, i8, i16, i32, i64, i128>();
+
+    test_span<u32, u64>();
+    test_span<u16, u64>();
+    test_span<u16, u32>();
+    test_span<u8, u16>();
+    test_span<u8, i32>();
+    test_span<i32, i64>();
+    test_span<i8, i16>();
+    test_span<u8, i16>();
+    test_span<i16, i32>();
+    test_span<i8, i32>();
+    test_span<i32, u32>();
+    test_span<u32, i32>();
+    test_span<u64, u128>();
+    test_span<i64, i128>();
+    test_span<i64, u8>();
+
+    test_column_storage();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,459 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/divider.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+inline constexpr std::size_t N {1027};
+
+// Divisors that exercise every shift amount, both neighbours of every power of two, and the extremes
+template <typename T>
+auto make_divisors() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using lane_type = detail::impl::span_lane_t<basis_type>;
+
+    constexpr auto digits {std::numeric_limits<lane_type>::digits};
+
+    std::vector<T> divisors;
+    for (int shift {}; shift < digits; ++shift)
+    {
+        const auto power {static_cast<lane_type>(lane_type{1} << shift)};
+        for (const auto divisor : {power, static_cast<lane_type>(power - 1U), static_cast<lane_type>(power + 1U)})
+        {
+            if (divisor != 0U)
+            {
+                divisors.emplace_back(static_cast<basis_type>(divisor));
+            }
+        }
+    }
+
+    divisors.push_back(std::numeric_limits<T>::max());
+    divisors.emplace_back(static_cast<basis_type>(std::numeric_limits<basis_type>::max() - static_cast<basis_type>(1)));
+
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+    for (std::size_t i {}; i < 64U; ++i)
+    {
+        const auto divisor {static_cast<basis_type>(dist(rng))};
+        if (divisor != 0)
+        {
+            divisors.emplace_back(divisor);
+        }
+    }
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        divisors.push_back(std::numeric_limits<T>::min());
+
+        const auto count {divisors.size()};
+        for (std::size_t i {}; i < count; ++i)
+        {
+            if (divisors[i] != std::numeric_limits<T>::min())
+            {
+                divisors.push_back(-divisors[i]);
+            }
+        }
+    }
+
+    return divisors;
+}
+
+// The scalar operators with the remaining overflow (min / -1) skipped
+template <typename T>
+void check_matches_operator(const T numerator, const divider<T>& d)
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        if (numerator == std::numeric_limits<T>::min() && d.divisor() == T{static_cast<basis_type>(-1)})
+        {
+            return;
+        }
+    }
+
+    BOOST_TEST(numerator / d == numerator / d.divisor());
+    BOOST_TEST(numerator % d == numerator % d.divisor());
+}
+
+// =============================================================================
+// Every numerator and divisor of the 8-bit types
+// =============================================================================
+
+template <typename T>
+void test_exhaustive()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    for (int divisor {std::numeric_limits<basis_type>::min()}; divisor <= std::numeric_limits<basis_type>::max(); ++divisor)
+    {
+        if (divisor == 0)
+        {
+            continue;
+        }
+
+        const divider<T> d {T{static_cast<basis_type>(divisor)}};
+        for (int numerator {std::numeric_limits<basis_type>::min()}; numerator <= std::numeric_limits<basis_type>::max(); ++numerator)
+        {
+            check_matches_operator(T{static_cast<basis_type>(numerator)}, d);
+        }
+    }
+}
+
+// =============================================================================
+// Edge case and pseudo-random divisors against the scalar operators
+// =============================================================================
+
+template <typename T>
+void test_against_operator()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> numerators;
+    for (std::size_t i {}; i < 256U; ++i)
+    {
+        numerators.emplace_back(static_cast<basis_type>(dist(rng)));
+    }
+    numerators.push_back(std::numeric_limits<T>::max());
+    numerators.push_back(std::numeric_limits<T>::min());
+    numerators.emplace_back(static_cast<basis_type>(0));
+    numerators.emplace_back(static_cast<basis_type>(1));
+    numerators.emplace_back(static_cast<basis_type>(std::numeric_limits<basis_type>::max() - static_cast<basis_type>(1)));
+
+    for (const auto divisor : make_divisors<T>())
+    {
+        const divider<T> d {divisor};
+        BOOST_TEST(d.divisor() == divisor);
+
+        for (const auto numerator : numerators)
+        {
+            check_matches_operator(numerator, d);
+        }
+
+        // The numerators adjacent to multiples of the divisor are where a reciprocal that is off by one fails
+        using lane_type = detail::impl::span_lane_t<basis_type>;
+        for (const auto multiplier : numerators)
+        {
+            if constexpr (std::numeric_limits<basis_type>::is_signed)
+            {
+                if (multiplier == std::numeric_limits<T>::min())
+                {
+                    continue;
+                }
+            }
+
+            const auto multiple {static_cast<lane_type>(static_cast<basis_type>(multiplier / divisor * divisor))};
+            for (const auto offset : {lane_type{0}, static_cast<lane_type>(1U), static_cast<lane_type>(static_cast<lane_type>(static_cast<basis_type>(divisor)) - 1U)})
+            {
+                check_matches_operator(T{static_cast<basis_type>(static_cast<lane_type>(multiple + offset))}, d);
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Construction validates the divisor, and min / -1 overflows as for the operators
+// =============================================================================
+
+template <typename T>
+void test_errors()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    BOOST_TEST_THROWS(divider<T>{T{static_cast<basis_type>(0)}}, std::domain_error);
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        const divider<T> minus_one {T{static_cast<basis_type>(-1)}};
+        BOOST_TEST_THROWS(static_cast<void>(std::numeric_limits<T>::min() / minus_one), std::overflow_error);
+        BOOST_TEST_THROWS(static_cast<void>(std::numeric_limits<T>::min() % minus_one), std::overflow_error);
+        BOOST_TEST(std::numeric_limits<T>::max() / minus_one == -std::numeric_limits<T>::max());
+    }
+}
+
+// =============================================================================
+// Span division and modulo
+// =============================================================================
+
+template <typename T>
+void test_span()
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs.emplace_back(static_cast<basis_type>(dist(rng)));
+    }
+    std::vector<T> quotients(N);
+    std::vector<T> remainders(N);
+
+    for (const auto divisor : make_divisors<T>())
+    {
+        const divider<T> d {divisor};
+
+        div<overflow_policy::throw_exception>(lhs, d, std::span{quotients});
+        mod<overflow_policy::throw_exception>(lhs, d, std::span{remainders});
+
+        for (std::size_t i {}; i < N; ++i)
+        {
+            if constexpr (std::numeric_limits<basis_type>::is_signed)
+            {
+                if (lhs[i] == std::numeric_limits<T>::min())
+                {
+                    continue;
+                }
+            }
+
+            BOOST_TEST(quotients[i] == lhs[i] / divisor);
+            BOOST_TEST(remainders[i] == lhs[i] % divisor);
+        }
+
+        BOOST_TEST(div<overflow_policy::checked>(lhs, d, std::span{quotients}));
+        BOOST_TEST(mod<overflow_policy::checked>(lhs, d, std::span{remainders}));
+        div<overflow_policy::saturate>(lhs, d, std::span{quotients});
+        div<overflow_policy::strict>(lhs, d, std::span{quotients});
+    }
+
+    std::vector<T> too_short(N - 1U);
+    const divider<T> d {T{static_cast<basis_type>(3)}};
+    BOOST_TEST_THROWS(div<overflow_policy::throw_exception>(lhs, d, std::span{too_short}), std::domain_error);
+    BOOST_TEST(!mod<overflow_policy::checked>(lhs, d, std::span{too_short}));
+}
+
+template <typename T>
+void test_span_signed_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs.emplace_back(static_cast<basis_type>(dist(rng)));
+        if (lhs.back() == std::numeric_limits<T>::min())
+        {
+            lhs.back() = T{0};
+        }
+    }
+    lhs[300] = std::numeric_limits<T>::min();
+    lhs[700] = std::numeric_limits<T>::min();
+
+    std::vector<T> result(N);
+    const divider<T> minus_one {T{static_cast<basis_type>(-1)}};
+
+    BOOST_TEST(!div<overflow_policy::checked>(lhs, minus_one, std::span{result}));
+    BOOST_TEST(!mod<overflow_policy::checked>(lhs, minus_one, std::span{result}));
+
+    try
+    {
+        div<overflow_policy::throw_exception>(lhs, minus_one, std::span{result});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("division at index 300 (lhs = ") != std::string::npos);
+    }
+
+    try
+    {
+        mod<overflow_policy::throw_exception>(lhs, minus_one, std::span{result});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("modulo at index 300 (lhs = ") != std::string::npos);
+    }
+
+    div<overflow_policy::saturate>(lhs, minus_one, std::span{result});
+    BOOST_TEST(result[300] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[700] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[301] == -lhs[301]);
+
+    mod<overflow_policy::saturate>(lhs, minus_one, std::span{result});
+    BOOST_TEST(result[300] == T{0});
+
+    // Any other divisor can not overflow
+    const divider<T> minus_two {T{static_cast<basis_type>(-2)}};
+    BOOST_TEST(div<overflow_policy::checked>(lhs, minus_two, std::span{result}));
+    BOOST_TEST(result[300] == std::numeric_limits<T>::min() / T{static_cast<basis_type>(-2)});
+}
+
+// The result overlaps lhs at an offset, so min has been overwritten before the index can be found
+void test_span_overlap()
+{
+    std::array<i32, 3> buffer {i32{0}, std::numeric_limits<i32>::min(), i32{5}};
+    const std::span<const i32> lhs {buffer.data() + 1, 2U};
+    const std::span<i32> result {buffer.data(), 2U};
+    const divider<i32> minus_one {i32{-1}};
+
+    try
+    {
+        div<overflow_policy::throw_exception>(lhs, minus_one, result);
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("division (lhs = ") != std::string::npos);
+    }
+}
+
+// =============================================================================
+// Splitting durations into whole minutes and remaining seconds
+// =============================================================================
+
+void test_split_seconds()
+{
+    const std::vector<u32> durations {u32{59U}, u32{60U}, u32{61U}, u32{3599U}, u32{86'400U}};
+    std::vector<u32> minutes(durations.size());
+    std::vector<u32> seconds(durations.size());
+
+    const divider<u32> per_minute {u32{60U}};
+    div<overflow_policy::throw_exception>(durations, per_minute, std::span{minutes});
+    mod<overflow_policy::throw_exception>(durations, per_minute, std::span{seconds});
+
+    BOOST_TEST(minutes[0] == u32{0U});
+    BOOST_TEST(seconds[0] == u32{59U});
+    BOOST_TEST(minutes[2] == u32{1U});
+    BOOST_TEST(seconds[2] == u32{1U});
+    BOOST_TEST(minutes[3] == u32{59U});
+    BOOST_TEST(seconds[3] == u32{59U});
+    BOOST_TEST(minutes[4] == u32{1440U});
+    BOOST_TEST(seconds[4] == u32{0U});
+}
+
+constexpr auto constexpr_divide() -> bool
+{
+    const divider<i32> d {i32{-7}};
+    return i32{100} / d == i32{-14} && i32{100} % d == i32{2} && i32{-100} % d == i32{-2};
+}
+
+static_assert(constexpr_divide());
+
+int main()
+{
+    test_exhaustive<u8>();
+    test_exhaustive<i8>();
+
+    test_against_operator<u16>();
+    test_against_operator<u32>();
+    test_against_operator<u64>();
+    test_against_operator<u128>();
+    test_against_operator<i16>();
+    test_against_operator<i32>();
+    test_against_operator<i64>();
+    test_against_operator<i128>();
+
+    test_errors<u8>();
+    test_errors<u16>();
+    test_errors<u32>();
+    test_errors<u64>();
+    test_errors<u128>();
+    test_errors<i8>();
+    test_errors<i16>();
+    test_errors<i32>();
+    test_errors<i64>();
+    test_errors<i128>();
+
+    test_span<u8>();
+    test_span<u32>();
+    test_span<u64>();
+    test_span<u128>();
+    test_span<i16>();
+    test_span<i32>();
+    test_span<i128>();
+
+    test_span_signed_overflow<i8>();
+    test_span_signed_overflow<i16>();
+    test_span_signed_overflow<i32>();
+    test_span_signed_overflow<i64>();
+    test_span_signed_overflow<i128>();
+
+    test_span_overlap();
+
+    test_split_seconds();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,216 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+template <typename T>
+void check_value(const arithmetic_expected<T>& res, const T expected_value)
+{
+    if (BOOST_TEST(res.has_value()))
+    {
+        BOOST_TEST(*res == expected_value);
+    }
+}
+
+template <typename T>
+void check_error(const arithmetic_expected<T>& res, const arithmetic_errc error)
+{
+    if (BOOST_TEST(!res.has_value()))
+    {
+        BOOST_TEST(res.error() == error);
+    }
+}
+
+// -----------------------------------------------
+// The expected functions and policy agree with the other policies
+// -----------------------------------------------
+
+template <typename T>
+void test_unsigned()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    constexpr T max {std::numeric_limits<basis_type>::max()};
+    constexpr T zero {static_cast<basis_type>(0)};
+    constexpr T one {static_cast<basis_type>(1)};
+    constexpr T two {static_cast<basis_type>(2)};
+    constexpr T three {static_cast<basis_type>(3)};
+    constexpr T digits {static_cast<basis_type>(std::numeric_limits<basis_type>::digits)};
+
+    check_value(expected_add(two, three), T{static_cast<basis_type>(5)});
+    check_value(expected_sub(three, two), one);
+    check_value(expected_mul(two, three), T{static_cast<basis_type>(6)});
+    check_value(expected_div(three, two), one);
+    check_value(expected_mod(three, two), one);
+    check_value(expected_shl(three, one), T{static_cast<basis_type>(6)});
+    check_value(expected_shr(three, one), one);
+
+    check_error(expected_add(max, one), arithmetic_errc::overflow);
+    check_error(expected_sub(one, two), arithmetic_errc::underflow);
+    check_error(expected_mul(max, two), arithmetic_errc::overflow);
+    check_error(expected_div(one, zero), arithmetic_errc::division_by_zero);
+    check_error(expected_mod(one, zero), arithmetic_errc::division_by_zero);
+    check_error(expected_shl(max, one), arithmetic_errc::overflow);
+    check_error(expected_shl(one, digits), arithmetic_errc::invalid_shift);
+    check_error(expected_shr(one, digits), arithmetic_errc::invalid_shift);
+
+    check_value(add<overflow_policy::expected>(two, three), T{static_cast<basis_type>(5)});
+    check_error(add<overflow_policy::expected>(max, one), arithmetic_errc::overflow);
+    check_error(sub<overflow_policy::expected>(zero, one), arithmetic_errc::underflow);
+    check_error(mul<overflow_policy::expected>(max, max), arithmetic_errc::overflow);
+    check_error(div<overflow_policy::expected>(one, zero), arithmetic_errc::division_by_zero);
+    check_error(mod<overflow_policy::expected>(one, zero), arithmetic_errc::division_by_zero);
+    check_error(shl<overflow_policy::expected>(one, digits), arithmetic_errc::invalid_shift);
+    check_error(shr<overflow_policy::expected>(one, digits), arithmetic_errc::invalid_shift);
+
+    static_assert(noexcept(add<overflow_policy::expected>(one, one)));
+    static_assert(noexcept(div<overflow_policy::expected>(one, one)));
+    static_assert(noexcept(mod<overflow_policy::expected>(one, one)));
+    static_assert(noexcept(shl<overflow_policy::expected>(one, one)));
+}
+
+template <typename T>
+void test_signed()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    constexpr T max {std::numeric_limits<basis_type>::max()};
+    constexpr T min {std::numeric_limits<basis_type>::min()};
+    constexpr T zero {static_cast<basis_type>(0)};
+    constexpr T one {static_cast<basis_type>(1)};
+    constexpr T two {static_cast<basis_type>(2)};
+    constexpr T minus_one {static_cast<basis_type>(-1)};
+    constexpr T minus_two {static_cast<basis_type>(-2)};
+
+    check_value(expected_add(minus_two, one), minus_one);
+    check_value(expected_sub(one, two), minus_one);
+    check_value(expected_mul(minus_one, two), minus_two);
+    check_value(expected_div(minus_two, two), minus_one);
+    check_value(expected_mod(minus_two, two), zero);
+
+    // The direction of the overflow depends on the signs of the operands
+    check_error(expected_add(max, one), arithmetic_errc::overflow);
+    check_error(expected_add(min, minus_one), arithmetic_errc::underflow);
+    check_error(expected_sub(min, one), arithmetic_errc::underflow);
+    check_error(expected_sub(max, minus_one), arithmetic_errc::overflow);
+    check_error(expected_mul(max, two), arithmetic_errc::overflow);
+    check_error(expected_mul(min, minus_two), arithmetic_errc::overflow);
+    check_error(expected_mul(max, minus_two), arithmetic_errc::underflow);
+    check_error(expected_mul(min, two), arithmetic_errc::underflow);
+    check_error(expected_div(one, zero), arithmetic_errc::division_by_zero);
+    check_error(expected_div(min, minus_one), arithmetic_errc::overflow);
+    check_error(expected_mod(one, zero), arithmetic_errc::division_by_zero);
+    check_error(expected_mod(min, minus_one), arithmetic_errc::overflow);
+
+    check_value(sub<overflow_policy::expected>(one, two), minus_one);
+    check_error(add<overflow_policy::expected>(min, minus_one), arithmetic_errc::underflow);
+    check_error(sub<overflow_policy::expected>(max, minus_one), arithmetic_errc::overflow);
+    check_error(mul<overflow_policy::expected>(min, min), arithmetic_errc::overflow);
+    check_error(div<overflow_policy::expected>(min, minus_one), arithmetic_errc::overflow);
+    check_error(mod<overflow_policy::expected>(one, zero), arithmetic_errc::division_by_zero);
+
+    static_assert(noexcept(mul<overflow_policy::expected>(one, one)));
+    static_assert(noexcept(div<overflow_policy::expected>(one, one)));
+}
+
+// -----------------------------------------------
+// Bounded types also fail when the result is outside the bounds
+// -----------------------------------------------
+
+void test_bounded()
+{
+    using percent = bounded_uint<0U, 100U>;
+    using offset = bounded_int<-10, 10>;
+
+    check_value(expected_add(percent{40U}, percent{60U}), percent{100U});
+    check_error(expected_add(percent{50U}, percent{60U}), arithmetic_errc::out_of_range);
+    check_error(expected_sub(percent{50U}, percent{60U}), arithmetic_errc::underflow);
+    check_error(expected_mul(percent{20U}, percent{10U}), arithmetic_errc::out_of_range);
+    check_error(expected_mul(percent{100U}, percent{100U}), arithmetic_errc::overflow); // Overflows the u8 basis
+    check_error(expected_div(percent{20U}, percent{0U}), arithmetic_errc::division_by_zero);
+    check_error(expected_mod(percent{20U}, percent{0U}), arithmetic_errc::division_by_zero);
+
+    check_value(add<overflow_policy::expected>(percent{1U}, percent{2U}), percent{3U});
+    check_error(mul<overflow_policy::expected>(percent{100U}, percent{2U}), arithmetic_errc::out_of_range);
+    BOOST_TEST(add<overflow_policy::throw_exception>(percent{1U}, percent{2U}) == percent{3U});
+    BOOST_TEST_THROWS(static_cast<void>(add<overflow_policy::throw_exception>(percent{99U}, percent{2U})), std::domain_error);
+
+    check_value(expected_sub(offset{-5}, offset{5}), offset{-10});
+    check_error(expected_sub(offset{-5}, offset{6}), arithmetic_errc::out_of_range);
+    check_error(expected_mul(offset{-5}, offset{5}), arithmetic_errc::out_of_range);
+    check_error(expected_div(offset{5}, offset{0}), arithmetic_errc::division_by_zero);
+    check_value(mod<overflow_policy::expected>(offset{-7}, offset{3}), offset{-1});
+    check_error(sub<overflow_policy::expected>(offset{10}, offset{-10}), arithmetic_errc::out_of_range);
+
+    constexpr percent one {1U};
+    static_assert(noexcept(add<overflow_policy::expected>(one, one)));
+}
+
+// -----------------------------------------------
+// The result type
+// -----------------------------------------------
+
+void test_result_type()
+{
+    const auto good {expected_add(u8{1U}, u8{2U})};
+    const auto bad {expected_add(u8{255U}, u8{2U})};
+
+    BOOST_TEST(static_cast<bool>(good));
+    BOOST_TEST(!static_cast<bool>(bad));
+    BOOST_TEST(good.value() == u8{3U});
+    BOOST_TEST(good.value_or(u8{0U}) == u8{3U});
+    BOOST_TEST(bad.value_or(u8{0U}) == u8{0U});
+    BOOST_TEST(good == u8{3U});
+    BOOST_TEST(bad == unexpected<arithmetic_errc>{arithmetic_errc::overflow});
+    BOOST_TEST(good != bad);
+}
+
+// -----------------------------------------------
+// constexpr
+// -----------------------------------------------
+
+static_assert(*expected_add(u8{200U}, u8{50U}) == u8{250U});
+static_assert(expected_add(u8{200U}, u8{100U}).error() == arithmetic_errc::overflow);
+static_assert(expected_sub(u32{0U}, u32{1U}).error() == arithmetic_errc::underflow);
+static_assert(expected_div(u64{1U}, u64{0U}).error() == arithmetic_errc::division_by_zero);
+static_assert(expected_shr(u16{1U}, u16{16U}).error() == arithmetic_errc::invalid_shift);
+static_assert(expected_add(i8{-100}, i8{-100}).error() == arithmetic_errc::underflow);
+static_assert(mul<overflow_policy::expected>(i32{-1}, i32{INT32_MIN}).error() == arithmetic_errc::overflow);
+static_assert(expected_mul(bounded_uint<1U, 10U>{5U}, bounded_uint<1U, 10U>{3U}).error() == arithmetic_errc::out_of_range);
+
+int main()
+{
+    test_unsigned<u8>();
+    test_unsigned<u16>();
+    test_unsigned<u32>();
+    test_unsigned<u64>();
+    test_unsigned<u128>();
+
+    test_signed<i8>();
+    test_signed<i16>();
+    test_signed<i32>();
+    test_signed<i64>();
+    test_signed<i128>();
+
+    test_bounded();
+    test_result_type();
+
+    return boost::report_errors();
+}
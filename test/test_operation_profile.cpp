@@ -0,0 +1,192 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_SAFE_NUMBERS_ENABLE_PROFILING
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace boost::safe_numbers;
+
+// -----------------------------------------------
+// Operators, named functions, and generic functions are counted by their policy
+// -----------------------------------------------
+
+void test_counts()
+{
+    const auto before {this_thread_operation_profile()};
+
+    u64 x {3U};
+    for (int i {}; i < 10; ++i)
+    {
+        x = x * u64{1U};
+        static_cast<void>(checked_mul(x, u64{2U}));
+        static_cast<void>(saturating_add(i8{100}, i8{100}));
+    }
+
+    static_cast<void>(mul<overflow_policy::wrap>(u32{2U}, u32{3U}));
+    static_cast<void>(u16{8U} << u16{1U});
+    ++x;
+    --x;
+    static_cast<void>(-i32{5});
+
+    const auto profile {this_thread_operation_profile() - before};
+
+    BOOST_TEST_EQ(profile.count<u64>(arithmetic_op::mul, overflow_policy::throw_exception), 10U);
+    BOOST_TEST_EQ(profile.count<u64>(arithmetic_op::mul, overflow_policy::checked), 10U);
+    BOOST_TEST_EQ(profile.count<std::int8_t>(arithmetic_op::add, overflow_policy::saturate), 10U);
+    BOOST_TEST_EQ(profile.count<u32>(arithmetic_op::mul, overflow_policy::wrap), 1U);
+    BOOST_TEST_EQ(profile.count<u16>(arithmetic_op::shl, overflow_policy::throw_exception), 1U);
+    BOOST_TEST_EQ(profile.count<u64>(arithmetic_op::inc, overflow_policy::throw_exception), 1U);
+    BOOST_TEST_EQ(profile.count<u64>(arithmetic_op::dec, overflow_policy::throw_exception), 1U);
+    BOOST_TEST_EQ(profile.count<i32>(arithmetic_op::neg, overflow_policy::throw_exception), 1U);
+    BOOST_TEST_EQ(profile.total(), 35U);
+
+    const auto counts {profile.counts()};
+    BOOST_TEST_EQ(counts.size(), 8U);
+    BOOST_TEST_EQ(counts.front().count, 10U);
+    BOOST_TEST_EQ(counts.back().count, 1U);
+
+    // Operations that fail are counted too
+    const auto failing {this_thread_operation_profile()};
+    BOOST_TEST_THROWS(static_cast<void>(u8{200U} + u8{100U}), std::overflow_error);
+    BOOST_TEST_EQ((this_thread_operation_profile() - failing).count<u8>(arithmetic_op::add, overflow_policy::throw_exception), 1U);
+}
+
+// -----------------------------------------------
+// Constant evaluation is not counted
+// -----------------------------------------------
+
+void test_constant_evaluation()
+{
+    const auto before {this_thread_operation_profile()};
+
+    constexpr auto value {u32{2U} + u32{3U}};
+    static_assert(value == u32{5U});
+
+    BOOST_TEST_EQ((this_thread_operation_profile() - before).total(), 0U);
+}
+
+// -----------------------------------------------
+// Scopes attribute the operations of a region, and may nest
+// -----------------------------------------------
+
+void test_scopes()
+{
+    operation_profile outer {};
+    operation_profile inner {};
+
+    for (int i {}; i < 3; ++i)
+    {
+        operation_profile_scope outer_scope {outer};
+
+        static_cast<void>(u32{1U} + u32{2U});
+
+        {
+            operation_profile_scope inner_scope {inner};
+            static_cast<void>(u32{1U} - u32{1U});
+        }
+    }
+
+    // Outside of any scope
+    static_cast<void>(u32{1U} + u32{2U});
+
+    BOOST_TEST_EQ(outer.count<u32>(arithmetic_op::add, overflow_policy::throw_exception), 3U);
+    BOOST_TEST_EQ(outer.count<u32>(arithmetic_op::sub, overflow_policy::throw_exception), 3U);
+    BOOST_TEST_EQ(outer.total(), 6U);
+
+    BOOST_TEST_EQ(inner.count<u32>(arithmetic_op::sub, overflow_policy::throw_exception), 3U);
+    BOOST_TEST_EQ(inner.total(), 3U);
+}
+
+// -----------------------------------------------
+// The counts of every thread are merged, including those that have exited
+// -----------------------------------------------
+
+void test_threads()
+{
+    constexpr int thread_count {4};
+    constexpr int operations_per_thread {1000};
+
+    const auto before {take_operation_profile()};
+
+    std::vector<operation_profile> regions(thread_count);
+    std::vector<std::thread> threads;
+
+    for (int t {}; t < thread_count; ++t)
+    {
+        threads.emplace_back([&regions, t]
+        {
+            operation_profile_scope scope {regions[static_cast<std::size_t>(t)]};
+
+            for (int i {}; i < operations_per_thread; ++i)
+            {
+                static_cast<void>(div<overflow_policy::checked>(i64{10}, i64{3}));
+            }
+        });
+    }
+
+    // Profiles may be taken while the threads count
+    static_cast<void>(take_operation_profile());
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto profile {take_operation_profile() - before};
+    BOOST_TEST_EQ(profile.count<i64>(arithmetic_op::div, overflow_policy::checked),
+                  static_cast<std::uint64_t>(thread_count * operations_per_thread));
+
+    operation_profile merged {};
+    for (const auto& region : regions)
+    {
+        BOOST_TEST_EQ(region.count<i64>(arithmetic_op::div, overflow_policy::checked), static_cast<std::uint64_t>(operations_per_thread));
+        merged += region;
+    }
+    BOOST_TEST_EQ(merged.total(), static_cast<std::uint64_t>(thread_count * operations_per_thread));
+}
+
+// -----------------------------------------------
+// Text and JSON
+// -----------------------------------------------
+
+void test_output()
+{
+    operation_profile profile {};
+    {
+        operation_profile_scope scope {profile};
+
+        for (int i {}; i < 3; ++i)
+        {
+            static_cast<void>(checked_mul(u64{2U}, u64{3U}));
+        }
+        static_cast<void>(u8{1U} + u8{1U});
+    }
+
+    BOOST_TEST_EQ(to_text(profile), std::string {"u64 checked mul: 3\n"
+                                                 "u8 throw_exception add: 1\n"});
+
+    BOOST_TEST_EQ(to_json(profile), std::string {"{\"counts\":["
+                                                 "{\"op\":\"mul\",\"type\":\"u64\",\"policy\":\"checked\",\"count\":3},"
+                                                 "{\"op\":\"add\",\"type\":\"u8\",\"policy\":\"throw_exception\",\"count\":1}"
+                                                 "],\"unrecorded\":0}"});
+
+    BOOST_TEST_EQ(to_json(operation_profile {}), std::string {"{\"counts\":[],\"unrecorded\":0}"});
+}
+
+int main()
+{
+    test_counts();
+    test_constant_evaluation();
+    test_scopes();
+    test_threads();
+    test_output();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,195 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+// -----------------------------------------------
+// A handler that records the last error it was passed
+// -----------------------------------------------
+
+int handler_calls {};
+overflow_info last_info {};
+
+void recording_handler(const overflow_info& info)
+{
+    ++handler_calls;
+    last_info = info;
+}
+
+void check_last(const arithmetic_op op, const char* type, const bool is_signed,
+                const boost::int128::uint128_t lhs, const boost::int128::uint128_t rhs)
+{
+    BOOST_TEST(last_info.op == op);
+    BOOST_TEST(last_info.is_signed == is_signed);
+    BOOST_TEST(last_info.lhs == lhs);
+    BOOST_TEST(last_info.rhs == rhs);
+    BOOST_TEST(last_info.message != nullptr);
+    BOOST_TEST(last_info.location.line() != 0U);
+
+    if (type == nullptr)
+    {
+        BOOST_TEST(last_info.type == nullptr);
+    }
+    else if (BOOST_TEST(last_info.type != nullptr))
+    {
+        BOOST_TEST_CSTR_EQ(last_info.type, type);
+    }
+}
+
+void test_installation()
+{
+    BOOST_TEST(get_overflow_handler() == nullptr);
+    BOOST_TEST(set_overflow_handler(recording_handler) == nullptr);
+    BOOST_TEST(get_overflow_handler() == recording_handler);
+
+    // Reinstalling returns the handler being replaced
+    BOOST_TEST(set_overflow_handler(recording_handler) == recording_handler);
+}
+
+// -----------------------------------------------
+// The handler sees the operation, type, and operands, and the exception is still thrown afterwards
+// -----------------------------------------------
+
+void test_unsigned()
+{
+    handler_calls = 0;
+
+    BOOST_TEST_THROWS(static_cast<void>(u32{UINT32_MAX} + u32{2U}), std::overflow_error);
+    BOOST_TEST_EQ(handler_calls, 1);
+    check_last(arithmetic_op::add, "u32", false, UINT32_MAX, 2U);
+    BOOST_TEST(std::strstr(last_info.message, "u32 addition") != nullptr);
+
+    BOOST_TEST_THROWS(static_cast<void>(u8{1U} - u8{2U}), std::underflow_error);
+    check_last(arithmetic_op::sub, "u8", false, 1U, 2U);
+
+    BOOST_TEST_THROWS(static_cast<void>(u64{UINT64_MAX} * u64{3U}), std::overflow_error);
+    check_last(arithmetic_op::mul, "u64", false, UINT64_MAX, 3U);
+
+    BOOST_TEST_THROWS(static_cast<void>(u16{7U} / u16{0U}), std::domain_error);
+    check_last(arithmetic_op::div, "u16", false, 7U, 0U);
+
+    BOOST_TEST_THROWS(static_cast<void>(u128{9U} % u128{0U}), std::domain_error);
+    check_last(arithmetic_op::mod, "u128", false, 9U, 0U);
+
+    BOOST_TEST_THROWS(static_cast<void>(u8{0x80U} << u8{1U}), std::overflow_error);
+    check_last(arithmetic_op::shl, "u8", false, 0x80U, 1U);
+
+    BOOST_TEST_THROWS(static_cast<void>(u32{1U} >> u32{32U}), std::overflow_error);
+    check_last(arithmetic_op::shr, "u32", false, 1U, 32U);
+
+    auto value {u16{UINT16_MAX}};
+    BOOST_TEST_THROWS(++value, std::overflow_error);
+    check_last(arithmetic_op::inc, "u16", false, UINT16_MAX, 0U);
+
+    value = u16{0U};
+    BOOST_TEST_THROWS(value--, std::underflow_error);
+    check_last(arithmetic_op::dec, "u16", false, 0U, 0U);
+
+    BOOST_TEST_THROWS(static_cast<void>(static_cast<std::uint8_t>(u32{256U})), std::domain_error);
+    check_last(arithmetic_op::conversion, "u32", false, 256U, 0U);
+
+    // Policies that do not throw do not call the handler
+    const auto calls {handler_calls};
+    BOOST_TEST(saturating_add(u32{UINT32_MAX}, u32{2U}) == u32{UINT32_MAX});
+    BOOST_TEST(wrapping_add(u32{UINT32_MAX}, u32{2U}) == u32{1U});
+    BOOST_TEST(!checked_add(u32{UINT32_MAX}, u32{2U}).has_value());
+    BOOST_TEST_EQ(handler_calls, calls);
+}
+
+void test_signed()
+{
+    // Negative operands are sign extended
+    const auto minus_one {~boost::int128::uint128_t{0U}};
+    const auto int8_min {~boost::int128::uint128_t{0x7FU}};
+
+    BOOST_TEST_THROWS(static_cast<void>(i8{INT8_MIN} - i8{1}), std::underflow_error);
+    check_last(arithmetic_op::sub, "i8", true, int8_min, 1U);
+
+    BOOST_TEST_THROWS(static_cast<void>(i32{INT32_MAX} + i32{1}), std::overflow_error);
+    check_last(arithmetic_op::add, "i32", true, static_cast<std::uint32_t>(INT32_MAX), 1U);
+
+    BOOST_TEST_THROWS(static_cast<void>(i16{-2} * i16{INT16_MAX}), std::underflow_error);
+    check_last(arithmetic_op::mul, "i16", true, minus_one - 1U, static_cast<std::uint16_t>(INT16_MAX));
+
+    BOOST_TEST_THROWS(static_cast<void>(i8{INT8_MIN} / i8{-1}), std::overflow_error);
+    check_last(arithmetic_op::div, "i8", true, int8_min, minus_one);
+
+    BOOST_TEST_THROWS(static_cast<void>(i64{5} % i64{0}), std::domain_error);
+    check_last(arithmetic_op::mod, "i64", true, 5U, 0U);
+
+    BOOST_TEST_THROWS(static_cast<void>(-i8{INT8_MIN}), std::domain_error);
+    check_last(arithmetic_op::neg, "i8", true, int8_min, 0U);
+
+    BOOST_TEST_THROWS(static_cast<void>(static_cast<std::int8_t>(i32{-200})), std::domain_error);
+    check_last(arithmetic_op::conversion, "i32", true, minus_one - 199U, 0U);
+
+    auto value {i128{std::numeric_limits<boost::int128::int128_t>::min()}};
+    BOOST_TEST_THROWS(--value, std::underflow_error);
+    check_last(arithmetic_op::dec, "i128", true, boost::int128::uint128_t{1U} << 127U, 0U);
+}
+
+// -----------------------------------------------
+// Errors that are not from a single operation have no operands
+// -----------------------------------------------
+
+void test_no_operation()
+{
+    const std::vector<u32> lhs(4U);
+    std::vector<u32> result(3U);
+
+    BOOST_TEST_THROWS(saturating_add(lhs, lhs, std::span{result}), std::domain_error);
+    check_last(arithmetic_op::none, nullptr, false, 0U, 0U);
+}
+
+// -----------------------------------------------
+// A handler may throw an exception of its own instead
+// -----------------------------------------------
+
+struct custom_error {};
+
+void throwing_handler(const overflow_info&)
+{
+    throw custom_error {};
+}
+
+void test_throwing_handler()
+{
+    BOOST_TEST(set_overflow_handler(throwing_handler) == recording_handler);
+    BOOST_TEST_THROWS(static_cast<void>(u32{UINT32_MAX} + u32{1U}), custom_error);
+
+    // Removing the handler restores the default behavior
+    BOOST_TEST(set_overflow_handler(nullptr) == throwing_handler);
+    handler_calls = 0;
+    BOOST_TEST_THROWS(static_cast<void>(u32{UINT32_MAX} + u32{1U}), std::overflow_error);
+    BOOST_TEST_EQ(handler_calls, 0);
+}
+
+int main()
+{
+    test_installation();
+    test_unsigned();
+    test_signed();
+    test_no_operation();
+    test_throwing_handler();
+
+    return boost::report_errors();
+}
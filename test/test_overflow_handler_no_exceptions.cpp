@@ -0,0 +1,52 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Built without exceptions, errors are passed to the handler defined below instead of being thrown
+
+#define BOOST_SAFE_NUMBERS_ENABLE_OVERFLOW_HANDLER
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+using namespace boost::safe_numbers;
+
+int runtime_handler_calls {};
+
+void runtime_handler(const overflow_info&)
+{
+    ++runtime_handler_calls;
+}
+
+// The handler must not return, so it ends the test with its result
+void boost::safe_numbers::overflow_detected(const overflow_info& info)
+{
+    BOOST_TEST_EQ(runtime_handler_calls, 1);
+    BOOST_TEST(info.op == arithmetic_op::mul);
+    BOOST_TEST(!info.is_signed);
+    BOOST_TEST(info.lhs == 0x10U);
+    BOOST_TEST(info.rhs == 0x10U);
+    BOOST_TEST_CSTR_EQ(info.type, "u8");
+    BOOST_TEST(std::strstr(info.message, "u8 multiplication") != nullptr);
+
+    std::exit(boost::report_errors());
+}
+
+int main()
+{
+    set_overflow_handler(runtime_handler);
+
+    // Operations that do not overflow never reach the handlers
+    const u8 x {0x10U};
+    BOOST_TEST(x + x == u8{0x20U});
+    BOOST_TEST_EQ(runtime_handler_calls, 0);
+
+    const auto product {x * x};
+    static_cast<void>(product);
+
+    BOOST_ERROR("Execution continued past an overflow");
+    return boost::report_errors();
+}
@@ -0,0 +1,309 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/safe_numbers.hpp>
+#include <boost/safe_numbers/overflow_sampler.hpp>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace boost::safe_numbers;
+
+void overflow_u32_add()
+{
+    try
+    {
+        static_cast<void>(u32{UINT32_MAX} + u32{1U});
+    }
+    catch (const std::overflow_error&)
+    {
+    }
+}
+
+void overflow_u8_mul()
+{
+    try
+    {
+        static_cast<void>(u8{UINT8_MAX} * u8{2U});
+    }
+    catch (const std::overflow_error&)
+    {
+    }
+}
+
+// -----------------------------------------------
+// The first events at each site and then one in every N are captured
+// -----------------------------------------------
+
+void test_sampling()
+{
+    overflow_sampler sampler {overflow_sampling{2U, 10U}};
+    sampler.install();
+
+    for (int i {}; i < 25; ++i)
+    {
+        overflow_u32_add();
+    }
+
+    // Another site has its own count
+    overflow_u8_mul();
+
+    sampler.uninstall();
+
+    BOOST_TEST_EQ(sampler.observed(), 26U);
+    BOOST_TEST_EQ(sampler.dropped(), 0U);
+
+    std::vector<std::uint64_t> occurrences;
+    std::vector<arithmetic_op> ops;
+
+    const auto consumed {sampler.drain([&](const overflow_event& event)
+    {
+        occurrences.push_back(event.occurrence());
+        ops.push_back(event.info().op);
+
+        BOOST_TEST(!event.frames().empty());
+        BOOST_TEST_EQ(event.stacktrace().size(), event.frames().size());
+    })};
+
+    BOOST_TEST_EQ(consumed, 5U);
+    BOOST_TEST((occurrences == std::vector<std::uint64_t>{1U, 2U, 12U, 22U, 1U}));
+    BOOST_TEST(ops.back() == arithmetic_op::mul);
+
+    // Everything ready has been consumed
+    BOOST_TEST_EQ(sampler.drain([](const overflow_event&) {}), 0U);
+}
+
+// -----------------------------------------------
+// Events carry the same description as the handler is passed
+// -----------------------------------------------
+
+void test_event_info()
+{
+    overflow_sampler sampler {};
+    sampler.install();
+
+    try
+    {
+        static_cast<void>(i16{INT16_MIN} - i16{1});
+    }
+    catch (const arithmetic_error& e)
+    {
+        sampler.uninstall();
+
+        BOOST_TEST_EQ(sampler.drain([&e](const overflow_event& event)
+        {
+            const auto info {event.info()};
+            BOOST_TEST(info.op == arithmetic_op::sub);
+            BOOST_TEST_CSTR_EQ(info.type, "i16");
+            BOOST_TEST(info.is_signed);
+            BOOST_TEST(info.lhs == e.lhs());
+            BOOST_TEST(info.rhs == e.rhs());
+            BOOST_TEST_CSTR_EQ(info.message, e.message());
+            BOOST_TEST_EQ(info.location.line(), e.location().line());
+        }), 1U);
+    }
+}
+
+// -----------------------------------------------
+// A full ring buffer drops events rather than waiting
+// -----------------------------------------------
+
+void test_full_buffer()
+{
+    overflow_sampler sampler {overflow_sampling{UINT64_MAX, 1U}, 2U};
+    BOOST_TEST_EQ(sampler.capacity(), 2U);
+
+    sampler.install();
+
+    for (int i {}; i < 5; ++i)
+    {
+        overflow_u32_add();
+    }
+
+    BOOST_TEST_EQ(sampler.dropped(), 3U);
+    BOOST_TEST_EQ(sampler.drain([](const overflow_event&) {}), 2U);
+
+    // Draining frees the slots again
+    overflow_u32_add();
+    BOOST_TEST_EQ(sampler.drain([](const overflow_event& event) { BOOST_TEST_EQ(event.occurrence(), 6U); }), 1U);
+
+    sampler.uninstall();
+}
+
+// -----------------------------------------------
+// The handler installed before is still called, and restored
+// -----------------------------------------------
+
+static int handled_count {};
+
+void count_errors(const overflow_info&)
+{
+    ++handled_count;
+}
+
+void test_chaining()
+{
+    const auto original {set_overflow_handler(count_errors)};
+
+    {
+        overflow_sampler sampler {};
+        sampler.install();
+        BOOST_TEST(get_overflow_handler() != count_errors);
+
+        // Installing another sampler keeps the handler to restore
+        overflow_sampler replacement {};
+        replacement.install();
+
+        overflow_u32_add();
+        BOOST_TEST_EQ(handled_count, 1);
+        BOOST_TEST_EQ(sampler.observed(), 0U);
+        BOOST_TEST_EQ(replacement.observed(), 1U);
+
+        // Uninstalling the sampler that was replaced does nothing
+        sampler.uninstall();
+        BOOST_TEST(get_overflow_handler() != count_errors);
+    }
+
+    // Destroying the sampler uninstalls it
+    BOOST_TEST(get_overflow_handler() == count_errors);
+
+    overflow_u32_add();
+    BOOST_TEST_EQ(handled_count, 2);
+
+    set_overflow_handler(original);
+}
+
+// -----------------------------------------------
+// Samplers may replace each other while other threads report errors
+// -----------------------------------------------
+
+static std::atomic<int> concurrent_handled_count {};
+
+void count_concurrent_errors(const overflow_info&)
+{
+    concurrent_handled_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void test_concurrent_replacement()
+{
+    constexpr int thread_count {4};
+    constexpr int errors_per_thread {2000};
+
+    const auto original {set_overflow_handler(count_concurrent_errors)};
+
+    // Both outlive the threads, which may still be recording into the one that was replaced
+    overflow_sampler first {overflow_sampling{0U, 0U}};
+    overflow_sampler second {overflow_sampling{0U, 0U}};
+    first.install();
+
+    std::atomic<int> finished {};
+    std::vector<std::thread> threads;
+
+    for (int t {}; t < thread_count; ++t)
+    {
+        threads.emplace_back([&finished]
+        {
+            for (int i {}; i < errors_per_thread; ++i)
+            {
+                overflow_u32_add();
+            }
+            ++finished;
+        });
+    }
+
+    for (bool use_second {true}; finished.load() < thread_count; use_second = !use_second)
+    {
+        (use_second ? second : first).install();
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    first.uninstall();
+    second.uninstall();
+
+    // Every error was recorded by one of the samplers, and passed on to the handler installed before them
+    constexpr auto total {thread_count * errors_per_thread};
+    BOOST_TEST_EQ(first.observed() + second.observed(), static_cast<std::uint64_t>(total));
+    BOOST_TEST_EQ(concurrent_handled_count.load(), total);
+    BOOST_TEST(get_overflow_handler() == count_concurrent_errors);
+
+    set_overflow_handler(original);
+}
+
+// -----------------------------------------------
+// Errors are recorded from several threads while another drains
+// -----------------------------------------------
+
+void test_threads()
+{
+    constexpr int thread_count {4};
+    constexpr int errors_per_thread {2000};
+
+    overflow_sampler sampler {overflow_sampling{0U, 1U}, 64U};
+    sampler.install();
+
+    std::atomic<int> finished {};
+    std::vector<std::thread> threads;
+
+    for (int t {}; t < thread_count; ++t)
+    {
+        threads.emplace_back([&finished]
+        {
+            for (int i {}; i < errors_per_thread; ++i)
+            {
+                overflow_u32_add();
+            }
+            ++finished;
+        });
+    }
+
+    std::uint64_t consumed {};
+    std::uint64_t occurrence_sum {};
+
+    const auto consume {[&](const overflow_event& event)
+    {
+        ++consumed;
+        occurrence_sum += event.occurrence();
+    }};
+
+    while (finished.load() < thread_count)
+    {
+        static_cast<void>(sampler.drain(consume));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    static_cast<void>(sampler.drain(consume));
+    sampler.uninstall();
+
+    BOOST_TEST_EQ(sampler.observed(), static_cast<std::uint64_t>(thread_count * errors_per_thread));
+    BOOST_TEST_EQ(consumed + sampler.dropped(), sampler.observed());
+
+    // Every error at the one site had its own occurrence
+    if (sampler.dropped() == 0U)
+    {
+        BOOST_TEST_EQ(occurrence_sum, consumed * (consumed + 1U) / 2U);
+    }
+}
+
+int main()
+{
+    test_sampling();
+    test_event_info();
+    test_full_buffer();
+    test_chaining();
+    test_concurrent_replacement();
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,278 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+// -----------------------------------------------
+// Each operator gives the same result as the named function of the policy
+// -----------------------------------------------
+
+template <typename T>
+void test_unsigned()
+{
+    using basis_type = typename T::basis_type;
+    using sat = safe<T, overflow_policy::saturate>;
+    using wrapping = safe<T, overflow_policy::wrap>;
+    using throwing = safe<T, overflow_policy::throw_exception>;
+
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+    constexpr auto digits {static_cast<basis_type>(std::numeric_limits<basis_type>::digits)};
+
+    BOOST_TEST(sat{max} + sat{basis_type{1U}} == sat{max});
+    BOOST_TEST(sat{basis_type{1U}} - sat{basis_type{2U}} == sat{basis_type{0U}});
+    BOOST_TEST(sat{max} * sat{basis_type{2U}} == sat{max});
+    BOOST_TEST(sat{basis_type{7U}} / sat{basis_type{2U}} == sat{basis_type{3U}});
+    BOOST_TEST(sat{basis_type{7U}} % sat{basis_type{2U}} == sat{basis_type{1U}});
+    BOOST_TEST(sat{max} << sat{basis_type{1U}} == sat{max});
+    BOOST_TEST(sat{basis_type{1U}} >> sat{digits} == sat{basis_type{0U}});
+    BOOST_TEST_THROWS(static_cast<void>(sat{basis_type{1U}} / sat{basis_type{0U}}), std::domain_error);
+
+    BOOST_TEST(wrapping{max} + wrapping{basis_type{2U}} == wrapping{basis_type{1U}});
+    BOOST_TEST(wrapping{basis_type{0U}} - wrapping{basis_type{1U}} == wrapping{max});
+    BOOST_TEST(wrapping{max} * wrapping{max} == wrapping{basis_type{1U}});
+
+    BOOST_TEST_THROWS(static_cast<void>(throwing{max} + throwing{basis_type{1U}}), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(throwing{basis_type{0U}} - throwing{basis_type{1U}}), std::underflow_error);
+
+    // Compound assignment, increment, and decrement
+    sat value {max};
+    value += sat{basis_type{5U}};
+    BOOST_TEST(value == sat{max});
+    ++value;
+    BOOST_TEST(value == sat{max});
+    BOOST_TEST(value++ == sat{max});
+    value = sat{basis_type{0U}};
+    --value;
+    BOOST_TEST(value-- == sat{basis_type{0U}});
+    value -= sat{basis_type{1U}};
+    BOOST_TEST(value == sat{basis_type{0U}});
+
+    wrapping counter {max};
+    ++counter;
+    BOOST_TEST(counter == wrapping{basis_type{0U}});
+    counter--;
+    BOOST_TEST(counter == wrapping{max});
+    counter *= wrapping{basis_type{2U}};
+    BOOST_TEST(static_cast<T>(counter) == wrapping_mul(T{max}, T{basis_type{2U}}));
+    counter /= wrapping{basis_type{2U}};
+    counter %= wrapping{basis_type{3U}};
+    counter <<= wrapping{basis_type{1U}};
+    counter >>= wrapping{basis_type{1U}};
+    BOOST_TEST(counter == wrapping{static_cast<basis_type>((max - 1U) / 2U % 3U)});
+
+    throwing bits {basis_type{0x0FU}};
+    bits &= throwing{basis_type{0x3CU}};
+    BOOST_TEST(bits == throwing{basis_type{0x0CU}});
+    bits |= throwing{basis_type{0x01U}};
+    bits ^= throwing{basis_type{0x04U}};
+    BOOST_TEST(bits == throwing{basis_type{0x09U}});
+    BOOST_TEST((~bits & throwing{basis_type{0x0FU}}) == throwing{basis_type{0x06U}});
+    BOOST_TEST_THROWS(++throwing{max}, std::overflow_error);
+
+    // Conversions
+    BOOST_TEST(static_cast<T>(sat{basis_type{9U}}) == T{basis_type{9U}});
+    BOOST_TEST(static_cast<basis_type>(sat{T{basis_type{9U}}}) == basis_type{9U});
+    BOOST_TEST(sat{basis_type{1U}} < sat{basis_type{2U}});
+    BOOST_TEST(sat{} == sat{basis_type{0U}});
+
+    // noexcept wherever the named function is
+    static_assert(noexcept(sat{} + sat{}));
+    static_assert(noexcept(sat{} * sat{}));
+    static_assert(noexcept(sat{} << sat{}));
+    static_assert(!noexcept(sat{} / sat{}));
+    static_assert(noexcept(++std::declval<sat&>()));
+    static_assert(noexcept(std::declval<sat&>() -= sat{}));
+    static_assert(noexcept(wrapping{} - wrapping{}));
+    static_assert(noexcept(safe<T, overflow_policy::strict>{} / safe<T, overflow_policy::strict>{}));
+    static_assert(!noexcept(throwing{} + throwing{}));
+    static_assert(!noexcept(std::declval<throwing&>() += throwing{}));
+    static_assert(noexcept(throwing{} & throwing{}));
+
+    // The layout of T
+    static_assert(sizeof(sat) == sizeof(T));
+    static_assert(alignof(sat) == alignof(T));
+    static_assert(std::is_trivially_copyable_v<sat>);
+    static_assert(std::is_standard_layout_v<sat>);
+}
+
+template <typename T>
+void test_signed()
+{
+    using basis_type = typename T::basis_type;
+    using sat = safe<T, overflow_policy::saturate>;
+    using wrapping = safe<T, overflow_policy::wrap>;
+    using throwing = safe<T, overflow_policy::throw_exception>;
+
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+    constexpr auto min {std::numeric_limits<basis_type>::min()};
+
+    BOOST_TEST(sat{max} + sat{basis_type{1}} == sat{max});
+    BOOST_TEST(sat{min} - sat{basis_type{1}} == sat{min});
+    BOOST_TEST(sat{min} * sat{basis_type{2}} == sat{min});
+    BOOST_TEST(sat{min} / sat{basis_type{-1}} == sat{max});
+    BOOST_TEST(-sat{min} == sat{max});
+    BOOST_TEST(-sat{basis_type{5}} == sat{basis_type{-5}});
+
+    BOOST_TEST(wrapping{max} + wrapping{basis_type{1}} == wrapping{min});
+    BOOST_TEST(-wrapping{min} == wrapping{min});
+
+    BOOST_TEST_THROWS(static_cast<void>(throwing{min} - throwing{basis_type{1}}), std::underflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(-throwing{min}), std::domain_error);
+    BOOST_TEST(-throwing{basis_type{3}} == throwing{basis_type{-3}});
+
+    sat value {min};
+    --value;
+    BOOST_TEST(value == sat{min});
+    value -= sat{basis_type{1}};
+    BOOST_TEST(value == sat{min});
+    value = sat{max};
+    value *= sat{basis_type{-2}};
+    BOOST_TEST(value == sat{min});
+
+    static_assert(noexcept(sat{} + sat{}));
+    static_assert(noexcept(-sat{}));
+    static_assert(!noexcept(-throwing{}));
+    static_assert(sizeof(sat) == sizeof(T));
+    static_assert(std::is_trivially_copyable_v<sat>);
+}
+
+// -----------------------------------------------
+// The sticky policy records into the context of the thread
+// -----------------------------------------------
+
+void test_sticky()
+{
+    using sticky_u32 = safe<u32, overflow_policy::sticky>;
+
+    thread_error_context().reset();
+
+    auto total {sticky_u32{UINT32_MAX - 1U}};
+    total += sticky_u32{1U};
+    BOOST_TEST(!thread_error_context().overflowed());
+
+    ++total;
+    BOOST_TEST(total == sticky_u32{0U});
+    BOOST_TEST(thread_error_context().overflowed());
+
+    thread_error_context().reset();
+}
+
+// -----------------------------------------------
+// Generic code written with operators
+// -----------------------------------------------
+
+template <typename Number>
+constexpr auto sum_of_squares(const std::span<const Number> values) noexcept(noexcept(Number{} + Number{} * Number{}))
+{
+    Number total {};
+    for (const auto value : values)
+    {
+        total += value * value;
+    }
+    return total;
+}
+
+void test_generic()
+{
+    using sat = safe<u16, overflow_policy::saturate>;
+
+    constexpr std::array<sat, 3> small {sat{std::uint16_t{1U}}, sat{std::uint16_t{2U}}, sat{std::uint16_t{3U}}};
+    static_assert(sum_of_squares(std::span<const sat>{small}) == sat{std::uint16_t{14U}});
+    static_assert(noexcept(sum_of_squares(std::span<const sat>{small})));
+
+    const std::array<sat, 2> large {sat{std::uint16_t{300U}}, sat{std::uint16_t{2U}}};
+    BOOST_TEST(sum_of_squares(std::span<const sat>{large}) == sat{UINT16_MAX});
+
+    const std::array<u16, 2> plain {u16{300U}, u16{2U}};
+    BOOST_TEST_THROWS(static_cast<void>(sum_of_squares(std::span<const u16>{plain})), std::overflow_error);
+}
+
+// -----------------------------------------------
+// Spans convert in both directions
+// -----------------------------------------------
+
+void test_spans()
+{
+    using sat = safe<u32, overflow_policy::saturate>;
+
+    std::array<u32, 4> values {u32{1U}, u32{2U}, u32{UINT32_MAX}, u32{4U}};
+
+    const auto safe_values {as_safe_span<overflow_policy::saturate>(std::span{values})};
+    static_assert(std::is_same_v<decltype(safe_values), const std::span<sat, 4>>);
+    BOOST_TEST_EQ(safe_values.size(), 4U);
+
+    for (auto& value : safe_values)
+    {
+        value += sat{1U};
+    }
+
+    BOOST_TEST(values[0] == u32{2U});
+    BOOST_TEST(values[2] == u32{UINT32_MAX});
+
+    const auto back {as_value_span(safe_values)};
+    BOOST_TEST(back.data() == values.data());
+
+    // The span functions of T accept the converted span
+    std::array<u32, 4> doubled {};
+    saturating_add(std::span<const u32>{back}, std::span<const u32>{back}, std::span{doubled});
+    BOOST_TEST(doubled[1] == u32{6U});
+    BOOST_TEST(doubled[2] == u32{UINT32_MAX});
+
+    const std::array<u32, 2> constant {u32{5U}, u32{6U}};
+    const auto const_safe {as_safe_span<overflow_policy::wrap>(std::span{constant})};
+    static_assert(std::is_same_v<decltype(const_safe), const std::span<const safe<u32, overflow_policy::wrap>, 2>>);
+    BOOST_TEST(const_safe[1] == (safe<u32, overflow_policy::wrap>{6U}));
+    BOOST_TEST(as_value_span(const_safe).data() == constant.data());
+}
+
+// -----------------------------------------------
+// constexpr
+// -----------------------------------------------
+
+// As for the named functions, an overflow during constant evaluation is a compile error whatever the policy
+static_assert(safe<u8, overflow_policy::saturate>{std::uint8_t{200U}} + safe<u8, overflow_policy::saturate>{std::uint8_t{50U}} ==
+              safe<u8, overflow_policy::saturate>{std::uint8_t{250U}});
+static_assert(-safe<i8, overflow_policy::wrap>{std::int8_t{127}} == safe<i8, overflow_policy::wrap>{std::int8_t{-127}});
+static_assert(safe<u64, overflow_policy::throw_exception>::policy == overflow_policy::throw_exception);
+static_assert(std::is_same_v<safe<u32, overflow_policy::wrap>::value_type, u32>);
+static_assert(std::is_same_v<safe<u32, overflow_policy::wrap>::basis_type, std::uint32_t>);
+
+int main()
+{
+    test_unsigned<u8>();
+    test_unsigned<u16>();
+    test_unsigned<u32>();
+    test_unsigned<u64>();
+    test_unsigned<u128>();
+
+    test_signed<i8>();
+    test_signed<i16>();
+    test_signed<i32>();
+    test_signed<i64>();
+    test_signed<i128>();
+
+    test_sticky();
+    test_generic();
+    test_spans();
+
+    return boost::report_errors();
+}
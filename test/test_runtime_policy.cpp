@@ -0,0 +1,204 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+// -----------------------------------------------
+// Span arithmetic gives the same results as with the policy as a template argument
+// -----------------------------------------------
+
+template <typename T>
+void test_span_arithmetic()
+{
+    using basis_type = typename T::basis_type;
+
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+    constexpr auto min {std::numeric_limits<basis_type>::min()};
+
+    const std::vector<T> lhs {T{max}, T{static_cast<basis_type>(3)}, T{min}, T{static_cast<basis_type>(7)}};
+    const std::vector<T> rhs {T{static_cast<basis_type>(2)}, T{static_cast<basis_type>(4)}, T{static_cast<basis_type>(1)}, T{static_cast<basis_type>(5)}};
+
+    std::vector<T> res(lhs.size());
+    std::vector<T> expected(lhs.size());
+
+    BOOST_TEST(add(overflow_policy::saturate, lhs, rhs, std::span{res}));
+    saturating_add(lhs, rhs, std::span{expected});
+    BOOST_TEST(res == expected);
+
+    BOOST_TEST(sub(overflow_policy::wrap, lhs, rhs, std::span{res}));
+    wrapping_sub(lhs, rhs, std::span{expected});
+    BOOST_TEST(res == expected);
+
+    BOOST_TEST(mul(overflow_policy::saturate, lhs, rhs, std::span{res}));
+    saturating_mul(lhs, rhs, std::span{expected});
+    BOOST_TEST(res == expected);
+
+    // Only checked reports the overflow in the return value
+    BOOST_TEST(!add(overflow_policy::checked, lhs, rhs, std::span{res}));
+    BOOST_TEST(!sub(overflow_policy::checked, lhs, rhs, std::span{res}));
+    BOOST_TEST(mul(overflow_policy::checked, std::span{lhs}.last(1), std::span{rhs}.last(1), std::span{res}.last(1)));
+    BOOST_TEST(res.back() == T{static_cast<basis_type>(35)});
+    BOOST_TEST(!add(overflow_policy::checked, lhs, rhs, std::span{res}.first(2)));
+
+    BOOST_TEST_THROWS(static_cast<void>(mul(overflow_policy::throw_exception, lhs, rhs, std::span{res})), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(add(overflow_policy::throw_exception, lhs, rhs, std::span{res}.first(2))), std::domain_error);
+
+    thread_error_context().reset();
+    BOOST_TEST(add(overflow_policy::sticky, std::span{lhs}.last(2), std::span{rhs}.last(2), std::span{res}.last(2)));
+    BOOST_TEST(!thread_error_context().overflowed());
+    BOOST_TEST(add(overflow_policy::sticky, lhs, rhs, std::span{res}));
+    BOOST_TEST(thread_error_context().overflowed());
+    thread_error_context().reset();
+
+    // The policies whose span functions do not have this form
+    BOOST_TEST_THROWS(static_cast<void>(add(overflow_policy::overflow_tuple, lhs, rhs, std::span{res})), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(add(overflow_policy::widen, lhs, rhs, std::span{res})), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(add(overflow_policy::expected, lhs, rhs, std::span{res})), std::domain_error);
+}
+
+template <typename T>
+void test_span_shifts()
+{
+    using basis_type = typename T::basis_type;
+
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+
+    const std::array<T, 3> lhs {T{max}, T{static_cast<basis_type>(1)}, T{static_cast<basis_type>(6)}};
+    const std::array<T, 3> amounts {T{static_cast<basis_type>(1)}, T{static_cast<basis_type>(2)}, T{static_cast<basis_type>(1)}};
+
+    std::array<T, 3> res {};
+    std::array<T, 3> expected {};
+
+    BOOST_TEST(shl(overflow_policy::saturate, lhs, amounts, std::span{res}));
+    saturating_shl(lhs, amounts, std::span{expected});
+    BOOST_TEST(res == expected);
+
+    BOOST_TEST(!shl(overflow_policy::checked, lhs, T{static_cast<basis_type>(1)}, std::span{res}));
+    BOOST_TEST(shr(overflow_policy::checked, lhs, T{static_cast<basis_type>(1)}, std::span{res}));
+    BOOST_TEST(res[2] == T{static_cast<basis_type>(3)});
+    BOOST_TEST(shr(overflow_policy::wrap, lhs, amounts, std::span{res}));
+    BOOST_TEST(res[1] == T{static_cast<basis_type>(0)});
+}
+
+// -----------------------------------------------
+// Scalar functions are looked up once
+// -----------------------------------------------
+
+template <typename T>
+void test_scalar_functions()
+{
+    using basis_type = typename T::basis_type;
+
+    constexpr T max {std::numeric_limits<basis_type>::max()};
+    constexpr T one {static_cast<basis_type>(1)};
+    constexpr T two {static_cast<basis_type>(2)};
+    constexpr T seven {static_cast<basis_type>(7)};
+
+    const auto& saturating {arithmetic_functions_for<T>(overflow_policy::saturate)};
+    BOOST_TEST(saturating.policy == overflow_policy::saturate);
+    BOOST_TEST(saturating.add(max, one) == max);
+    BOOST_TEST(saturating.mul(max, two) == max);
+    BOOST_TEST(saturating.div(seven, two) == T{static_cast<basis_type>(3)});
+    BOOST_TEST(saturating.mod(seven, two) == one);
+
+    const auto& wrapping {arithmetic_functions_for<T>(overflow_policy::wrap)};
+    BOOST_TEST(wrapping.add(max, one) == wrapping_add(max, one));
+    BOOST_TEST(wrapping.sub(T{}, one) == wrapping_sub(T{}, one));
+
+    const auto& throwing {arithmetic_functions_for<T>(overflow_policy::throw_exception)};
+    BOOST_TEST(throwing.sub(seven, two) == T{static_cast<basis_type>(5)});
+    BOOST_TEST_THROWS(static_cast<void>(throwing.add(max, one)), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(throwing.div(one, T{})), std::domain_error);
+
+    thread_error_context().reset();
+    const auto& sticky {arithmetic_functions_for<T>(overflow_policy::sticky)};
+    static_cast<void>(sticky.mul(max, two));
+    BOOST_TEST(thread_error_context().overflowed());
+    thread_error_context().reset();
+
+    // The same policy always gives the same table
+    BOOST_TEST(&arithmetic_functions_for<T>(overflow_policy::wrap) == &wrapping);
+
+    BOOST_TEST_THROWS(static_cast<void>(arithmetic_functions_for<T>(overflow_policy::checked)), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(arithmetic_functions_for<T>(overflow_policy::expected)), std::domain_error);
+}
+
+// -----------------------------------------------
+// constexpr
+// -----------------------------------------------
+
+constexpr auto sum_with_policy(const overflow_policy policy)
+{
+    const auto& functions {arithmetic_functions_for<u8>(policy)};
+
+    u8 total {};
+    for (const auto value : {u8{100U}, u8{100U}, u8{50U}})
+    {
+        total = functions.add(total, value);
+    }
+    return total;
+}
+
+static_assert(sum_with_policy(overflow_policy::wrap) == u8{250U});
+
+constexpr auto span_with_policy(const overflow_policy policy)
+{
+    const std::array<u16, 2> lhs {u16{1U}, u16{2U}};
+    std::array<u16, 2> res {};
+    static_cast<void>(add(policy, lhs, lhs, std::span{res}));
+    return res[1];
+}
+
+static_assert(span_with_policy(overflow_policy::saturate) == u16{4U});
+
+int main()
+{
+    test_span_arithmetic<u8>();
+    test_span_arithmetic<u16>();
+    test_span_arithmetic<u32>();
+    test_span_arithmetic<u64>();
+    test_span_arithmetic<u128>();
+
+    test_span_arithmetic<i8>();
+    test_span_arithmetic<i16>();
+    test_span_arithmetic<i32>();
+    test_span_arithmetic<i64>();
+    test_span_arithmetic<i128>();
+
+    test_span_shifts<u8>();
+    test_span_shifts<u32>();
+    test_span_shifts<u128>();
+
+    test_scalar_functions<u8>();
+    test_scalar_functions<u16>();
+    test_scalar_functions<u32>();
+    test_scalar_functions<u64>();
+    test_scalar_functions<u128>();
+
+    test_scalar_functions<i8>();
+    test_scalar_functions<i16>();
+    test_scalar_functions<i32>();
+    test_scalar_functions<i64>();
+    test_scalar_functions<i128>();
+
+    return boost::report_errors();
+}
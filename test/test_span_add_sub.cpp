@@ -0,0 +1,467 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+
+// Large enough that the vectorized main loop and the scalar tail are both exercised
+inline constexpr std::size_t N {1027};
+
+// lhs is drawn over the whole range of T. Each rhs is drawn the same way and then clamped
+// so that lhs + rhs is representable, which keeps the sums that would have overflowed at the limits of T.
+template <typename T>
+auto make_addends() -> std::pair<std::vector<T>, std::vector<T>>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs[i] = T{static_cast<basis_type>(dist(rng))};
+        rhs[i] = saturating_add(lhs[i], T{static_cast<basis_type>(dist(rng))}) - lhs[i];
+    }
+
+    return {lhs, rhs};
+}
+
+// As above, with each rhs clamped so that lhs - rhs is representable
+template <typename T>
+auto make_subtrahends() -> std::pair<std::vector<T>, std::vector<T>>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs[i] = T{static_cast<basis_type>(dist(rng))};
+        rhs[i] = lhs[i] - saturating_sub(lhs[i], T{static_cast<basis_type>(dist(rng))});
+    }
+
+    return {lhs, rhs};
+}
+
+// =============================================================================
+// No overflow: results match the scalar operators for every policy
+// =============================================================================
+
+template <typename T>
+void test_no_overflow()
+{
+    const auto [lhs, rhs] {make_addends<T>()};
+    std::vector<T> result(N);
+
+    add<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] + rhs[i]);
+    }
+
+    add<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] + rhs[i]);
+    }
+
+    BOOST_TEST(add<overflow_policy::checked>(lhs, rhs, std::span{result}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] + rhs[i]);
+    }
+
+    add<overflow_policy::strict>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] + rhs[i]);
+    }
+
+    const auto [minuends, subtrahends] {make_subtrahends<T>()};
+
+    sub<overflow_policy::throw_exception>(minuends, subtrahends, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == minuends[i] - subtrahends[i]);
+    }
+
+    BOOST_TEST(sub<overflow_policy::checked>(minuends, subtrahends, std::span{result}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == minuends[i] - subtrahends[i]);
+    }
+}
+
+// =============================================================================
+// Overflow in the middle of the span is reported at the first offending index
+// =============================================================================
+
+template <typename T>
+void test_unsigned_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    auto [lhs, rhs] {make_addends<T>()};
+    std::vector<T> result(N);
+
+    lhs[517] = std::numeric_limits<T>::max();
+    rhs[517] = T{static_cast<basis_type>(1U)};
+    lhs[900] = std::numeric_limits<T>::max();
+    rhs[900] = std::numeric_limits<T>::max();
+
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::overflow_error);
+    BOOST_TEST(!add<overflow_policy::checked>(lhs, rhs, std::span{result}));
+
+    try
+    {
+        add<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("at index 517 (lhs = ") != std::string::npos);
+    }
+
+    add<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    BOOST_TEST(result[517] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[900] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[516] == lhs[516] + rhs[516]);
+    BOOST_TEST(result[518] == lhs[518] + rhs[518]);
+
+    // Underflow only at index 3 where rhs is larger than lhs
+    auto [small, large] {make_subtrahends<T>()};
+    small[3] = T{static_cast<basis_type>(99U)};
+    large[3] = T{static_cast<basis_type>(100U)};
+
+    BOOST_TEST_THROWS(sub<overflow_policy::throw_exception>(small, large, std::span{result}), std::underflow_error);
+    BOOST_TEST(!sub<overflow_policy::checked>(small, large, std::span{result}));
+
+    try
+    {
+        sub<overflow_policy::throw_exception>(small, large, std::span{result});
+    }
+    catch (const std::underflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("at index 3 (lhs = ") != std::string::npos);
+    }
+
+    sub<overflow_policy::saturate>(small, large, std::span{result});
+    BOOST_TEST(result[3] == T{0U});
+    BOOST_TEST(result[4] == small[4] - large[4]);
+}
+
+template <typename T>
+void test_signed_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    auto [lhs, rhs] {make_addends<T>()};
+    std::vector<T> result(N);
+
+    lhs[41] = std::numeric_limits<T>::max();
+    rhs[41] = T{static_cast<basis_type>(1)};
+    lhs[700] = std::numeric_limits<T>::min();
+    rhs[700] = T{static_cast<basis_type>(-1)};
+
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::overflow_error);
+    BOOST_TEST(!add<overflow_policy::checked>(lhs, rhs, std::span{result}));
+
+    try
+    {
+        add<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("at index 41 (lhs = ") != std::string::npos);
+    }
+
+    add<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    BOOST_TEST(result[41] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[700] == std::numeric_limits<T>::min());
+    BOOST_TEST(result[42] == lhs[42] + rhs[42]);
+
+    // The first offending element underflows so the underflow is reported
+    lhs[41] = T{0};
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::underflow_error);
+
+    // Subtraction in both directions
+    auto [sub_lhs, sub_rhs] {make_subtrahends<T>()};
+    sub_lhs[10] = std::numeric_limits<T>::min();
+    sub_rhs[10] = T{1};
+    sub_lhs[20] = std::numeric_limits<T>::max();
+    sub_rhs[20] = T{static_cast<basis_type>(-1)};
+
+    BOOST_TEST_THROWS(sub<overflow_policy::throw_exception>(sub_lhs, sub_rhs, std::span{result}), std::underflow_error);
+    BOOST_TEST(!sub<overflow_policy::checked>(sub_lhs, sub_rhs, std::span{result}));
+
+    sub<overflow_policy::saturate>(sub_lhs, sub_rhs, std::span{result});
+    BOOST_TEST(result[10] == std::numeric_limits<T>::min());
+    BOOST_TEST(result[20] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[11] == sub_lhs[11] - sub_rhs[11]);
+
+    sub_lhs[10] = T{0};
+    BOOST_TEST_THROWS(sub<overflow_policy::throw_exception>(sub_lhs, sub_rhs, std::span{result}), std::overflow_error);
+}
+
+// =============================================================================
+// Mismatched span sizes
+// =============================================================================
+
+void test_size_mismatch()
+{
+    const std::array<u32, 4> lhs {u32{1U}, u32{2U}, u32{3U}, u32{4U}};
+    const std::array<u32, 3> rhs {u32{1U}, u32{2U}, u32{3U}};
+    std::array<u32, 4> result {};
+
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::domain_error);
+    BOOST_TEST_THROWS(add<overflow_policy::saturate>(lhs, rhs, std::span{result}), std::domain_error);
+    BOOST_TEST(!add<overflow_policy::checked>(lhs, rhs, std::span{result}));
+    BOOST_TEST(!sub<overflow_policy::checked>(lhs, rhs, std::span{result}));
+
+    // Empty spans are trivially valid
+    BOOST_TEST(add<overflow_policy::checked>(std::span<const u32>{}, std::span<const u32>{}, std::span<u32>{}));
+}
+
+// =============================================================================
+// In place operation
+// =============================================================================
+
+void test_in_place()
+{
+    std::vector<i32> values {i32{1}, i32{-2}, i32{3}, i32{-4}};
+    const std::vector<i32> rhs {i32{10}, i32{20}, i32{30}, i32{40}};
+
+    add<overflow_policy::throw_exception>(values, rhs, std::span{values});
+    BOOST_TEST(values[0] == i32{11});
+    BOOST_TEST(values[1] == i32{18});
+    BOOST_TEST(values[2] == i32{33});
+    BOOST_TEST(values[3] == i32{36});
+
+    values[2] = std::numeric_limits<i32>::max();
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(values, rhs, std::span{values}), std::overflow_error);
+
+    values[2] = std::numeric_limits<i32>::max();
+    add<overflow_policy::saturate>(values, rhs, std::span{values});
+    BOOST_TEST(values[2] == std::numeric_limits<i32>::max());
+
+    // In place errors are reported without an index, but with the same exception type as out of place ones
+    std::vector<u32> counts {u32{5U}, u32{1U}, u32{7U}};
+    const std::vector<u32> decrements {u32{1U}, u32{2U}, u32{3U}};
+
+    try
+    {
+        sub<overflow_policy::throw_exception>(counts, decrements, std::span{counts});
+        BOOST_TEST(false);
+    }
+    catch (const std::underflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Underflow detected in u32 subtraction");
+    }
+
+    std::vector<i32> balances {i32{10}, std::numeric_limits<i32>::min(), i32{-3}};
+    const std::vector<i32> withdrawals {i32{4}, i32{1}, i32{2}};
+
+    try
+    {
+        sub<overflow_policy::throw_exception>(balances, withdrawals, std::span{balances});
+        BOOST_TEST(false);
+    }
+    catch (const std::underflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.starts_with("Underflow"));
+    }
+
+    balances = {i32{10}, std::numeric_limits<i32>::min(), i32{-3}};
+    const std::vector<i32> deposits {i32{4}, i32{-1}, i32{2}};
+
+    BOOST_TEST_THROWS(add<overflow_policy::throw_exception>(balances, deposits, std::span{balances}), std::underflow_error);
+
+    balances = {i32{10}, std::numeric_limits<i32>::max(), i32{-3}};
+    BOOST_TEST_THROWS(sub<overflow_policy::throw_exception>(balances, std::span<const i32>{deposits}, std::span{balances}), std::overflow_error);
+
+    // The result overlaps lhs at an offset, so the element that overflowed is overwritten before it can be found again
+    std::vector<u8> shifted {u8{0U}, u8{250U}, u8{0U}, u8{0U}};
+    const std::vector<u8> increments {u8{10U}, u8{10U}, u8{0U}};
+    const std::span<const u8> shifted_lhs {shifted.data() + 1, 3U};
+
+    try
+    {
+        add<overflow_policy::throw_exception>(shifted_lhs, std::span<const u8>{increments}, std::span<u8>{shifted.data(), 3U});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 addition");
+    }
+
+    // The overwritten inputs would make an earlier element look like the one that overflowed,
+    // so an overlapping result is always reported without an index
+    std::vector<u8> buffer {u8{0U}, u8{0U}, u8{200U}, u8{0U}, u8{255U}};
+    const std::vector<u8> addends {u8{100U}, u8{50U}, u8{0U}, u8{1U}};
+
+    try
+    {
+        add<overflow_policy::throw_exception>(std::span<const u8>{buffer.data() + 1, 4U}, std::span<const u8>{addends}, std::span<u8>{buffer.data(), 4U});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 addition");
+    }
+
+    // The same holds when it is rhs that the result overlaps
+    std::vector<u8> rhs_buffer {u8{0U}, u8{1U}, u8{0U}, u8{1U}};
+    const std::vector<u8> bases {u8{0U}, u8{0U}, u8{255U}};
+
+    try
+    {
+        add<overflow_policy::throw_exception>(std::span<const u8>{bases}, std::span<const u8>{rhs_buffer.data() + 1, 3U}, std::span<u8>{rhs_buffer.data(), 3U});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 addition");
+    }
+
+    // Disjoint spans are rescanned and report the offending index
+    buffer = {u8{0U}, u8{0U}, u8{200U}, u8{0U}, u8{255U}};
+    std::vector<u8> disjoint(4U);
+
+    try
+    {
+        add<overflow_policy::throw_exception>(std::span<const u8>{buffer.data() + 1, 4U}, std::span<const u8>{addends}, std::span<u8>{disjoint});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST_CSTR_EQ(e.what(), "Overflow detected in u8 addition at index 3 (lhs = 255, rhs = 1)");
+    }
+}
+
+// =============================================================================
+// Constant evaluation
+// =============================================================================
+
+constexpr auto constexpr_add() -> bool
+{
+    const std::array<u16, 3> lhs {u16{static_cast<std::uint16_t>(1)}, u16{static_cast<std::uint16_t>(2)}, u16{static_cast<std::uint16_t>(3)}};
+    const std::array<u16, 3> rhs {u16{static_cast<std::uint16_t>(4)}, u16{static_cast<std::uint16_t>(5)}, u16{static_cast<std::uint16_t>(6)}};
+    std::array<u16, 3> result {};
+
+    add<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+
+    return result[0] == u16{static_cast<std::uint16_t>(5)} &&
+           result[1] == u16{static_cast<std::uint16_t>(7)} &&
+           result[2] == u16{static_cast<std::uint16_t>(9)};
+}
+
+static_assert(constexpr_add());
+
+int main()
+{
+    test_no_overflow<u8>();
+    test_no_overflow<u16>();
+    test_no_overflow<u32>();
+    test_no_overflow<u64>();
+    test_no_overflow<u128>();
+    test_no_overflow<i8>();
+    test_no_overflow<i16>();
+    test_no_overflow<i32>();
+    test_no_overflow<i64>();
+    test_no_overflow<i128>();
+
+    test_unsigned_overflow<u8>();
+    test_unsigned_overflow<u16>();
+    test_unsigned_overflow<u32>();
+    test_unsigned_overflow<u64>();
+    test_unsigned_overflow<u128>();
+
+    test_signed_overflow<i8>();
+    test_signed_overflow<i16>();
+    test_signed_overflow<i32>();
+    test_signed_overflow<i64>();
+    test_signed_overflow<i128>();
+
+    test_size_mismatch();
+    test_in_place();
+
+    return boost::report_errors();
+}
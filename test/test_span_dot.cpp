@@ -0,0 +1,378 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_reductions.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+
+inline constexpr std::size_t N {1027};
+
+// Drawn over the whole range of T
+template <typename T>
+auto make_random_values() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> values;
+    values.reserve(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.emplace_back(static_cast<basis_type>(dist(rng)));
+    }
+
+    return values;
+}
+
+// True when accumulator + 2 * lhs * rhs is representable, so fma_accumulate can be applied twice
+template <typename T>
+auto fits_twice(const T accumulator, const T lhs, const T rhs) -> bool
+{
+    const auto [product, product_overflowed] {overflowing_mul(lhs, rhs)};
+    if (product_overflowed)
+    {
+        return false;
+    }
+
+    const auto [doubled, doubled_overflowed] {overflowing_add(product, product)};
+    return !doubled_overflowed && !overflowing_add(accumulator, doubled).second;
+}
+
+// Every operand is drawn over the whole range of T, and each rhs is halved until fits_twice holds
+template <typename T>
+auto make_fma_operands() -> std::tuple<std::vector<T>, std::vector<T>, std::vector<T>>
+{
+    const auto lhs {make_random_values<T>()};
+    auto rhs {make_random_values<T>()};
+    const auto accumulator {make_random_values<T>()};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        while (!fits_twice(accumulator[i], lhs[i], rhs[i]))
+        {
+            rhs[i] = rhs[i] / T{2};
+        }
+    }
+
+    return {lhs, rhs, accumulator};
+}
+
+// =============================================================================
+// dot matches a loop of the checked operators when nothing overflows
+// =============================================================================
+
+template <typename T>
+void test_dot_no_overflow()
+{
+    const auto lhs {make_random_values<T>()};
+    auto rhs {make_random_values<T>()};
+
+    // Halve each rhs until both the product and the running sum are representable,
+    // so that the expected value can be computed with the checked operators
+    T expected {0};
+    for (std::size_t i {}; i < N; ++i)
+    {
+        while (overflowing_mul(lhs[i], rhs[i]).second || overflowing_add(expected, lhs[i] * rhs[i]).second)
+        {
+            rhs[i] = rhs[i] / T{2};
+        }
+
+        expected += lhs[i] * rhs[i];
+    }
+
+    BOOST_TEST(dot<overflow_policy::throw_exception>(std::span{lhs}, rhs) == expected);
+    BOOST_TEST(dot<overflow_policy::saturate>(std::span{lhs}, rhs) == expected);
+    BOOST_TEST(dot<overflow_policy::strict>(std::span{lhs}, rhs) == expected);
+    BOOST_TEST(*dot<overflow_policy::checked>(std::span{lhs}, rhs) == expected);
+
+    const auto [value, overflowed] {dot<overflow_policy::overflow_tuple>(std::span{lhs}, rhs)};
+    BOOST_TEST(value == expected);
+    BOOST_TEST(!overflowed);
+
+    BOOST_TEST(dot<overflow_policy::throw_exception>(std::span<const T>{}, std::span<const T>{}) == T{0});
+}
+
+// =============================================================================
+// Overflow and underflow are detected on the final result only
+// =============================================================================
+
+template <typename T>
+void test_dot_unsigned_overflow()
+{
+    const std::array<T, 2> lhs {std::numeric_limits<T>::max(), T{1}};
+    const std::array<T, 2> rhs {T{2}, T{1}};
+
+    BOOST_TEST_THROWS(static_cast<void>(dot<overflow_policy::throw_exception>(std::span{lhs}, rhs)), std::overflow_error);
+    BOOST_TEST(dot<overflow_policy::saturate>(std::span{lhs}, rhs) == std::numeric_limits<T>::max());
+    BOOST_TEST(!dot<overflow_policy::checked>(std::span{lhs}, rhs).has_value());
+
+    // 2 * max + 1 wraps to max
+    const auto [value, overflowed] {dot<overflow_policy::overflow_tuple>(std::span{lhs}, rhs)};
+    BOOST_TEST(value == std::numeric_limits<T>::max());
+    BOOST_TEST(overflowed);
+
+    // Every product overflows T, but not the wide accumulator
+    const std::vector<T> all_max(N, std::numeric_limits<T>::max());
+    BOOST_TEST_THROWS(static_cast<void>(dot<overflow_policy::throw_exception>(std::span{all_max}, all_max)), std::overflow_error);
+}
+
+template <typename T>
+void test_dot_signed()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    // max * max - max * max + 5 * 7 fits even though the first product does not
+    const std::array<T, 3> lhs {std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), T{static_cast<basis_type>(5)}};
+    const std::array<T, 3> rhs {std::numeric_limits<T>::max(), T{static_cast<basis_type>(-std::numeric_limits<basis_type>::max())}, T{static_cast<basis_type>(7)}};
+    BOOST_TEST(dot<overflow_policy::throw_exception>(std::span{lhs}, rhs) == T{static_cast<basis_type>(35)});
+
+    // min * min is positive and does not fit
+    const std::array<T, 1> min_values {std::numeric_limits<T>::min()};
+    BOOST_TEST_THROWS(static_cast<void>(dot<overflow_policy::throw_exception>(std::span{min_values}, min_values)), std::overflow_error);
+    BOOST_TEST(dot<overflow_policy::saturate>(std::span{min_values}, min_values) == std::numeric_limits<T>::max());
+
+    // min * max is negative and does not fit
+    const std::array<T, 1> max_values {std::numeric_limits<T>::max()};
+    BOOST_TEST_THROWS(static_cast<void>(dot<overflow_policy::throw_exception>(std::span{min_values}, max_values)), std::underflow_error);
+    BOOST_TEST(dot<overflow_policy::saturate>(std::span{min_values}, max_values) == std::numeric_limits<T>::min());
+
+    try
+    {
+        static_cast<void>(dot<overflow_policy::throw_exception>(std::span{min_values}, max_values));
+    }
+    catch (const std::underflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("dot product (lhs = ") != std::string::npos);
+    }
+}
+
+// =============================================================================
+// fma_accumulate
+// =============================================================================
+
+template <typename T>
+void test_fma_no_overflow()
+{
+    const auto [lhs, rhs, original] {make_fma_operands<T>()};
+    auto accumulator {original};
+
+    fma_accumulate<overflow_policy::throw_exception>(lhs, rhs, std::span{accumulator});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(accumulator[i] == original[i] + lhs[i] * rhs[i]);
+    }
+
+    BOOST_TEST(fma_accumulate<overflow_policy::checked>(lhs, rhs, std::span{accumulator}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(accumulator[i] == original[i] + lhs[i] * rhs[i] + lhs[i] * rhs[i]);
+    }
+}
+
+template <typename T>
+void test_fma_overflow()
+{
+    auto [lhs, rhs, accumulator] {make_fma_operands<T>()};
+
+    // lhs[i] * rhs[i] is positive at both indices
+    lhs[200] = T{3};
+    rhs[200] = T{5};
+    lhs[900] = T{1};
+    rhs[900] = T{1};
+    accumulator[200] = std::numeric_limits<T>::max();
+    accumulator[900] = std::numeric_limits<T>::max();
+    const auto original {accumulator};
+
+    try
+    {
+        fma_accumulate<overflow_policy::throw_exception>(lhs, rhs, std::span{accumulator});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("multiply-accumulate at index 200 (lhs = ") != std::string::npos);
+    }
+
+    // Blocks before the offending element are updated and the rest are not
+    BOOST_TEST(accumulator[0] == original[0] + lhs[0] * rhs[0]);
+    BOOST_TEST(accumulator[200] == original[200]);
+    BOOST_TEST(accumulator[N - 1U] == original[N - 1U]);
+
+    accumulator = original;
+    BOOST_TEST(!fma_accumulate<overflow_policy::checked>(lhs, rhs, std::span{accumulator}));
+
+    accumulator = original;
+    fma_accumulate<overflow_policy::saturate>(lhs, rhs, std::span{accumulator});
+    BOOST_TEST(accumulator[200] == std::numeric_limits<T>::max());
+    BOOST_TEST(accumulator[900] == std::numeric_limits<T>::max());
+    BOOST_TEST(accumulator[201] == original[201] + lhs[201] * rhs[201]);
+}
+
+template <typename T>
+void test_fma_signed_underflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    std::array<T, 3> accumulator {T{static_cast<basis_type>(1)}, std::numeric_limits<T>::min(), T{static_cast<basis_type>(1)}};
+    const std::array<T, 3> lhs {T{static_cast<basis_type>(2)}, T{static_cast<basis_type>(2)}, std::numeric_limits<T>::max()};
+    const std::array<T, 3> rhs {T{static_cast<basis_type>(3)}, T{static_cast<basis_type>(-1)}, T{static_cast<basis_type>(-1)}};
+
+    const auto original {accumulator};
+    BOOST_TEST_THROWS(fma_accumulate<overflow_policy::throw_exception>(lhs, rhs, std::span{accumulator}), std::underflow_error);
+
+    accumulator = original;
+    fma_accumulate<overflow_policy::saturate>(lhs, rhs, std::span{accumulator});
+    BOOST_TEST(accumulator[0] == T{static_cast<basis_type>(7)});
+    BOOST_TEST(accumulator[1] == std::numeric_limits<T>::min());
+    BOOST_TEST(accumulator[2] == T{static_cast<basis_type>(1)} - std::numeric_limits<T>::max());
+}
+
+void test_size_mismatch()
+{
+    const std::array<u32, 3> lhs {};
+    const std::array<u32, 2> rhs {};
+    std::array<u32, 3> accumulator {};
+
+    BOOST_TEST_THROWS(static_cast<void>(dot<overflow_policy::throw_exception>(std::span{lhs}, rhs)), std::domain_error);
+    BOOST_TEST(!dot<overflow_policy::checked>(std::span{lhs}, rhs).has_value());
+    BOOST_TEST_THROWS(fma_accumulate<overflow_policy::throw_exception>(lhs, rhs, std::span{accumulator}), std::domain_error);
+    BOOST_TEST(!fma_accumulate<overflow_policy::checked>(lhs, rhs, std::span{accumulator}));
+}
+
+// =============================================================================
+// Constant evaluation
+// =============================================================================
+
+constexpr auto constexpr_dot() -> bool
+{
+    const std::array<i64, 3> lhs {i64{3}, std::numeric_limits<i64>::max(), std::numeric_limits<i64>::max()};
+    const std::array<i64, 3> rhs {i64{4}, i64{2}, i64{-2}};
+    return dot<overflow_policy::throw_exception>(std::span{lhs}, rhs) == i64{12};
+}
+
+static_assert(constexpr_dot());
+
+int main()
+{
+    test_dot_no_overflow<u8>();
+    test_dot_no_overflow<u16>();
+    test_dot_no_overflow<u32>();
+    test_dot_no_overflow<u64>();
+    test_dot_no_overflow<i8>();
+    test_dot_no_overflow<i16>();
+    test_dot_no_overflow<i32>();
+    test_dot_no_overflow<i64>();
+
+    test_dot_unsigned_overflow<u8>();
+    test_dot_unsigned_overflow<u16>();
+    test_dot_unsigned_overflow<u32>();
+    test_dot_unsigned_overflow<u64>();
+
+    test_dot_signed<i8>();
+    test_dot_signed<i16>();
+    test_dot_signed<i32>();
+    test_dot_signed<i64>();
+
+    test_fma_no_overflow<u8>();
+    test_fma_no_overflow<u16>();
+    test_fma_no_overflow<u32>();
+    test_fma_no_overflow<u64>();
+    test_fma_no_overflow<i8>();
+    test_fma_no_overflow<i16>();
+    test_fma_no_overflow<i32>();
+    test_fma_no_overflow<i64>();
+
+    test_fma_overflow<u8>();
+    test_fma_overflow<u16>();
+    test_fma_overflow<u32>();
+    test_fma_overflow<u64>();
+    test_fma_overflow<i8>();
+    test_fma_overflow<i16>();
+    test_fma_overflow<i32>();
+    test_fma_overflow<i64>();
+
+    test_fma_signed_underflow<i8>();
+    test_fma_signed_underflow<i16>();
+    test_fma_signed_underflow<i32>();
+    test_fma_signed_underflow<i64>();
+
+    test_size_mismatch();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,290 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+
+// Large enough that the vectorized main loop and the scalar tail are both exercised
+inline constexpr std::size_t N {1027};
+
+// lhs and rhs are drawn over the whole range of T, and each rhs is halved until the product is representable.
+// Products that would have overflowed end up within a factor of two of the limits of T.
+template <typename T>
+auto make_factors() -> std::pair<std::vector<T>, std::vector<T>>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = detail::impl::span_lane_t<basis_type>;
+
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs[i] = T{static_cast<basis_type>(dist(rng))};
+        rhs[i] = T{static_cast<basis_type>(dist(rng))};
+
+        while (overflowing_mul(lhs[i], rhs[i]).second)
+        {
+            rhs[i] = rhs[i] / T{static_cast<basis_type>(2)};
+        }
+    }
+
+    return {lhs, rhs};
+}
+
+// =============================================================================
+// No overflow: results match the scalar operator for every policy
+// =============================================================================
+
+template <typename T>
+void test_no_overflow()
+{
+    const auto [lhs, rhs] {make_factors<T>()};
+    std::vector<T> result(N);
+
+    mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] * rhs[i]);
+    }
+
+    mul<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] * rhs[i]);
+    }
+
+    BOOST_TEST(mul<overflow_policy::checked>(lhs, rhs, std::span{result}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] * rhs[i]);
+    }
+
+    mul<overflow_policy::strict>(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == lhs[i] * rhs[i]);
+    }
+}
+
+// =============================================================================
+// Overflow is reported at the first offending index
+// =============================================================================
+
+template <typename T>
+void test_unsigned_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    auto [lhs, rhs] {make_factors<T>()};
+    std::vector<T> result(N);
+
+    lhs[300] = std::numeric_limits<T>::max();
+    rhs[300] = T{static_cast<basis_type>(2U)};
+    lhs[800] = std::numeric_limits<T>::max();
+    rhs[800] = std::numeric_limits<T>::max();
+
+    BOOST_TEST_THROWS(mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::overflow_error);
+    BOOST_TEST(!mul<overflow_policy::checked>(lhs, rhs, std::span{result}));
+
+    try
+    {
+        mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("multiplication at index 300 (lhs = ") != std::string::npos);
+    }
+
+    mul<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    BOOST_TEST(result[300] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[800] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[299] == lhs[299] * rhs[299]);
+    BOOST_TEST(result[301] == lhs[301] * rhs[301]);
+
+    // max * 1 and max * 0 do not overflow
+    lhs[300] = T{0U};
+    lhs[800] = T{0U};
+    lhs[10] = std::numeric_limits<T>::max();
+    rhs[10] = T{static_cast<basis_type>(1U)};
+    lhs[9] = std::numeric_limits<T>::max();
+    rhs[9] = T{static_cast<basis_type>(0U)};
+    BOOST_TEST(mul<overflow_policy::checked>(lhs, rhs, std::span{result}));
+    BOOST_TEST(result[10] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[9] == T{0U});
+}
+
+template <typename T>
+void test_signed_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    auto [lhs, rhs] {make_factors<T>()};
+    std::vector<T> result(N);
+
+    // Positive overflow, negative overflow, and the min * -1 special case
+    lhs[100] = std::numeric_limits<T>::max();
+    rhs[100] = T{static_cast<basis_type>(2)};
+    lhs[200] = std::numeric_limits<T>::min();
+    rhs[200] = T{static_cast<basis_type>(2)};
+    lhs[300] = std::numeric_limits<T>::min();
+    rhs[300] = T{static_cast<basis_type>(-1)};
+
+    BOOST_TEST_THROWS(mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::overflow_error);
+    BOOST_TEST(!mul<overflow_policy::checked>(lhs, rhs, std::span{result}));
+
+    try
+    {
+        mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result});
+    }
+    catch (const std::overflow_error& e)
+    {
+        BOOST_TEST(std::string{e.what()}.find("multiplication at index 100 (lhs = ") != std::string::npos);
+    }
+
+    mul<overflow_policy::saturate>(lhs, rhs, std::span{result});
+    BOOST_TEST(result[100] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[200] == std::numeric_limits<T>::min());
+    BOOST_TEST(result[300] == std::numeric_limits<T>::max());
+    BOOST_TEST(result[101] == lhs[101] * rhs[101]);
+
+    lhs[100] = T{0};
+    BOOST_TEST_THROWS(mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::underflow_error);
+
+    lhs[200] = T{0};
+    BOOST_TEST_THROWS(mul<overflow_policy::throw_exception>(lhs, rhs, std::span{result}), std::overflow_error);
+
+    // Negative products that fit
+    lhs[300] = std::numeric_limits<T>::min();
+    rhs[300] = T{static_cast<basis_type>(1)};
+    lhs[301] = std::numeric_limits<T>::max();
+    rhs[301] = T{static_cast<basis_type>(-1)};
+    BOOST_TEST(mul<overflow_policy::checked>(lhs, rhs, std::span{result}));
+    BOOST_TEST(result[300] == std::numeric_limits<T>::min());
+    BOOST_TEST(result[301] == -std::numeric_limits<T>::max());
+}
+
+// =============================================================================
+// Scaling a column by per-row factors in place
+// =============================================================================
+
+void test_in_place_scaling()
+{
+    std::vector<u32> quantities {u32{10U}, u32{20U}, u32{30U}, u32{40U}, u32{50U}};
+    const std::vector<u32> factors {u32{1U}, u32{2U}, u32{3U}, u32{4U}, u32{5U}};
+
+    mul<overflow_policy::throw_exception>(quantities, factors, std::span{quantities});
+    BOOST_TEST(quantities[0] == u32{10U});
+    BOOST_TEST(quantities[1] == u32{40U});
+    BOOST_TEST(quantities[2] == u32{90U});
+    BOOST_TEST(quantities[3] == u32{160U});
+    BOOST_TEST(quantities[4] == u32{250U});
+
+    const std::array<u32, 2> lhs {u32{1U}, u32{2U}};
+    std::array<u32, 3> result {};
+    BOOST_TEST_THROWS(mul<overflow_policy::throw_exception>(lhs, lhs, std::span{result}), std::domain_error);
+}
+
+int main()
+{
+    test_no_overflow<u8>();
+    test_no_overflow<u16>();
+    test_no_overflow<u32>();
+    test_no_overflow<u64>();
+    test_no_overflow<u128>();
+    test_no_overflow<i8>();
+    test_no_overflow<i16>();
+    test_no_overflow<i32>();
+    test_no_overflow<i64>();
+    test_no_overflow<i128>();
+
+    test_unsigned_overflow<u8>();
+    test_unsigned_overflow<u16>();
+    test_unsigned_overflow<u32>();
+    test_unsigned_overflow<u64>();
+    test_unsigned_overflow<u128>();
+
+    test_signed_overflow<i8>();
+    test_signed_overflow<i16>();
+    test_signed_overflow<i32>();
+    test_signed_overflow<i64>();
+    test_signed_overflow<i128>();
+
+    test_in_place_scaling();
+
+    return boost::report_errors();
+}
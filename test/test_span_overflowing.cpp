@@ -0,0 +1,236 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+
+// Not a multiple of the 64-bit bitmap word so that the partial last word is exercised
+inline constexpr std::size_t N {1027};
+
+auto bit_is_set(const std::vector<std::uint64_t>& bitmap, const std::size_t i) -> bool
+{
+    return ((bitmap[i / 64U] >> (i % 64U)) & 1U) == 1U;
+}
+
+// =============================================================================
+// Every element and every bit matches the scalar overflowing function
+// =============================================================================
+
+template <typename T>
+void test_matches_scalar()
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = std::make_unsigned_t<basis_type>;
+
+    // Spread the values across the whole range of T so that many elements overflow
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs[i] = T{static_cast<basis_type>(dist(rng))};
+        rhs[i] = T{static_cast<basis_type>(dist(rng))};
+    }
+    std::vector<T> result(N);
+    std::vector<std::uint64_t> bitmap(overflow_bitmap_size(N));
+
+    BOOST_TEST(overflowing_add(lhs, rhs, std::span{result}, std::span{bitmap}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto [value, overflowed] {overflowing_add(lhs[i], rhs[i])};
+        BOOST_TEST(result[i] == value);
+        BOOST_TEST(bit_is_set(bitmap, i) == overflowed);
+    }
+
+    BOOST_TEST(overflowing_sub(lhs, rhs, std::span{result}, std::span{bitmap}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto [value, overflowed] {overflowing_sub(lhs[i], rhs[i])};
+        BOOST_TEST(result[i] == value);
+        BOOST_TEST(bit_is_set(bitmap, i) == overflowed);
+    }
+
+    BOOST_TEST(overflowing_mul(lhs, rhs, std::span{result}, std::span{bitmap}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto [value, overflowed] {overflowing_mul(lhs[i], rhs[i])};
+        BOOST_TEST(result[i] == value);
+        BOOST_TEST(bit_is_set(bitmap, i) == overflowed);
+    }
+
+    // Bits past the last element are clear
+    BOOST_TEST((bitmap.back() >> (N % 64U)) == 0U);
+}
+
+// =============================================================================
+// A single overflow sets exactly one bit
+// =============================================================================
+
+template <typename T>
+void test_single_overflow()
+{
+    std::vector<T> lhs(N, T{1});
+    const std::vector<T> rhs(N, T{1});
+    std::vector<T> result(N);
+    std::vector<std::uint64_t> bitmap(overflow_bitmap_size(N));
+
+    BOOST_TEST(!overflowing_add(lhs, rhs, std::span{result}, std::span{bitmap}));
+    for (const auto word : bitmap)
+    {
+        BOOST_TEST(word == 0U);
+    }
+
+    lhs[777] = std::numeric_limits<T>::max();
+    BOOST_TEST(overflowing_add(lhs, rhs, std::span{result}, std::span{bitmap}));
+    BOOST_TEST(result[777] == std::numeric_limits<T>::min());
+
+    std::size_t overflow_count {};
+    for (const auto word : bitmap)
+    {
+        overflow_count += static_cast<std::size_t>(std::popcount(word));
+    }
+    BOOST_TEST(overflow_count == 1U);
+    BOOST_TEST(bit_is_set(bitmap, 777U));
+}
+
+// =============================================================================
+// Mismatched sizes
+// =============================================================================
+
+void test_size_mismatch()
+{
+    const std::vector<u16> lhs(65, u16{static_cast<std::uint16_t>(1)});
+    std::vector<u16> result(65);
+    std::vector<std::uint64_t> bitmap(1);
+
+    BOOST_TEST(overflow_bitmap_size(0U) == 0U);
+    BOOST_TEST(overflow_bitmap_size(64U) == 1U);
+    BOOST_TEST(overflow_bitmap_size(65U) == 2U);
+
+    BOOST_TEST_THROWS(overflowing_add(lhs, lhs, std::span{result}, std::span{bitmap}), std::domain_error);
+
+    std::vector<u16> short_result(64);
+    bitmap.resize(2);
+    BOOST_TEST_THROWS(overflowing_add(lhs, lhs, std::span{short_result}, std::span{bitmap}), std::domain_error);
+
+    BOOST_TEST(!overflowing_add(lhs, lhs, std::span{result}, std::span{bitmap}));
+    BOOST_TEST(!overflowing_add(std::span<const u16>{}, std::span<const u16>{}, std::span<u16>{}, std::span<std::uint64_t>{}));
+}
+
+// =============================================================================
+// Constant evaluation
+// =============================================================================
+
+constexpr auto constexpr_overflowing_sub() -> bool
+{
+    const std::array<i8, 3> lhs {i8{static_cast<std::int8_t>(-100)}, i8{static_cast<std::int8_t>(5)}, i8{static_cast<std::int8_t>(100)}};
+    const std::array<i8, 3> rhs {i8{static_cast<std::int8_t>(100)}, i8{static_cast<std::int8_t>(6)}, i8{static_cast<std::int8_t>(-100)}};
+    std::array<i8, 3> result {};
+    std::array<std::uint64_t, 1> bitmap {};
+
+    return overflowing_sub(lhs, rhs, std::span{result}, std::span{bitmap}) &&
+           bitmap[0] == 0b101U &&
+           result[1] == i8{static_cast<std::int8_t>(-1)};
+}
+
+static_assert(constexpr_overflowing_sub());
+
+int main()
+{
+    test_matches_scalar<u8>();
+    test_matches_scalar<u16>();
+    test_matches_scalar<u32>();
+    test_matches_scalar<u64>();
+    test_matches_scalar<i8>();
+    test_matches_scalar<i16>();
+    test_matches_scalar<i32>();
+    test_matches_scalar<i64>();
+
+    test_single_overflow<u8>();
+    test_single_overflow<u16>();
+    test_single_overflow<u32>();
+    test_single_overflow<u64>();
+    test_single_overflow<u128>();
+    test_single_overflow<i8>();
+    test_single_overflow<i16>();
+    test_single_overflow<i32>();
+    test_single_overflow<i64>();
+    test_single_overflow<i128>();
+
+    test_size_mismatch();
+
+    return boost::report_errors();
+}
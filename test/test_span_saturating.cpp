@@ -0,0 +1,234 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline std::mt19937_64 rng{42};
+
+// Not a multiple of any vector width so that the scalar tail is exercised
+inline constexpr std::size_t N {1027};
+
+// =============================================================================
+// Every element matches the scalar saturating function
+// =============================================================================
+
+template <typename T>
+void test_matches_scalar()
+{
+    using basis_type = detail::underlying_type_t<T>;
+    using unsigned_type = std::make_unsigned_t<basis_type>;
+
+    // Spread the values across the whole range of T so that many elements saturate
+    boost::random::uniform_int_distribution<unsigned_type> dist {std::numeric_limits<unsigned_type>::min(),
+                                                                 std::numeric_limits<unsigned_type>::max()};
+
+    std::vector<T> lhs(N);
+    std::vector<T> rhs(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        lhs[i] = T{static_cast<basis_type>(dist(rng))};
+        rhs[i] = T{static_cast<basis_type>(dist(rng))};
+    }
+    std::vector<T> result(N);
+
+    saturating_add(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == saturating_add(lhs[i], rhs[i]));
+    }
+
+    saturating_sub(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == saturating_sub(lhs[i], rhs[i]));
+    }
+
+    saturating_mul(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == saturating_mul(lhs[i], rhs[i]));
+    }
+
+    // Same as the generic function with the saturate policy
+    std::vector<T> policy_result(N);
+    saturating_add(lhs, rhs, std::span{result});
+    add<overflow_policy::saturate>(lhs, rhs, std::span{policy_result});
+    BOOST_TEST(result == policy_result);
+}
+
+// =============================================================================
+// Clamping at both ends of the range
+// =============================================================================
+
+template <typename T>
+void test_limits()
+{
+    constexpr auto max {std::numeric_limits<T>::max()};
+    constexpr auto min {std::numeric_limits<T>::min()};
+
+    std::vector<T> lhs(N, max);
+    std::vector<T> rhs(N, max);
+    std::vector<T> result(N);
+
+    saturating_add(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == max);
+    }
+
+    std::fill(lhs.begin(), lhs.end(), min);
+    saturating_sub(lhs, rhs, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == min);
+    }
+}
+
+// =============================================================================
+// In place brightening of an 8-bit image and gain on 16-bit audio samples
+// =============================================================================
+
+void test_in_place()
+{
+    std::vector<u8> pixels(N);
+    for (std::size_t i {}; i < N; ++i)
+    {
+        pixels[i] = u8{static_cast<std::uint8_t>(i)};
+    }
+    const std::vector<u8> brightness(N, u8{static_cast<std::uint8_t>(100)});
+
+    saturating_add(pixels, brightness, std::span{pixels});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto expected {(i % 256U) + 100U > 255U ? 255U : (i % 256U) + 100U};
+        BOOST_TEST(pixels[i] == u8{static_cast<std::uint8_t>(expected)});
+    }
+
+    std::vector<i16> samples {i16{static_cast<std::int16_t>(30000)}, i16{static_cast<std::int16_t>(-30000)}, i16{static_cast<std::int16_t>(5)}};
+    const std::vector<i16> offsets {i16{static_cast<std::int16_t>(10000)}, i16{static_cast<std::int16_t>(10000)}, i16{static_cast<std::int16_t>(-10)}};
+
+    saturating_add(samples, offsets, std::span{samples});
+    BOOST_TEST(samples[0] == std::numeric_limits<i16>::max());
+    BOOST_TEST(samples[1] == i16{static_cast<std::int16_t>(-20000)});
+    BOOST_TEST(samples[2] == i16{static_cast<std::int16_t>(-5)});
+
+    const std::array<u8, 2> small {};
+    std::array<u8, 3> mismatched {};
+    BOOST_TEST_THROWS(saturating_add(small, small, std::span{mismatched}), std::domain_error);
+}
+
+// =============================================================================
+// Constant evaluation takes the portable path
+// =============================================================================
+
+constexpr auto constexpr_saturating_sub() -> bool
+{
+    const std::array<u8, 3> lhs {u8{static_cast<std::uint8_t>(1)}, u8{static_cast<std::uint8_t>(200)}, u8{static_cast<std::uint8_t>(3)}};
+    const std::array<u8, 3> rhs {u8{static_cast<std::uint8_t>(4)}, u8{static_cast<std::uint8_t>(100)}, u8{static_cast<std::uint8_t>(3)}};
+    std::array<u8, 3> result {};
+
+    saturating_sub(lhs, rhs, std::span{result});
+
+    return result[0] == u8{static_cast<std::uint8_t>(0)} &&
+           result[1] == u8{static_cast<std::uint8_t>(100)} &&
+           result[2] == u8{static_cast<std::uint8_t>(0)};
+}
+
+static_assert(constexpr_saturating_sub());
+
+int main()
+{
+    test_matches_scalar<u8>();
+    test_matches_scalar<u16>();
+    test_matches_scalar<u32>();
+    test_matches_scalar<u64>();
+    test_matches_scalar<i8>();
+    test_matches_scalar<i16>();
+    test_matches_scalar<i32>();
+    test_matches_scalar<i64>();
+
+    test_limits<u8>();
+    test_limits<u16>();
+    test_limits<u32>();
+    test_limits<u64>();
+    test_limits<u128>();
+    test_limits<i8>();
+    test_limits<i16>();
+    test_limits<i32>();
+    test_limits<i64>();
+    test_limits<i128>();
+
+    test_in_place();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,367 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wold-style-cast"
+#  pragma clang diagnostic ignored "-Wundef"
+#  pragma clang diagnostic ignored "-Wconversion"
+#  pragma clang diagnostic ignored "-Wsign-conversion"
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#  pragma clang diagnostic ignored "-Wsign-compare"
+#  pragma clang diagnostic ignored "-Woverflow"
+
+#  if (__clang_major__ >= 10 && !defined(__APPLE__)) || __clang_major__ >= 13
+#    pragma clang diagnostic ignored "-Wdeprecated-copy"
+#  endif
+
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wold-style-cast"
+#  pragma GCC diagnostic ignored "-Wundef"
+#  pragma GCC diagnostic ignored "-Wconversion"
+#  pragma GCC diagnostic ignored "-Wsign-conversion"
+#  pragma GCC diagnostic ignored "-Wsign-compare"
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#  pragma GCC diagnostic ignored "-Woverflow"
+
+#elif defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4389)
+#  pragma warning(disable : 4127)
+#  pragma warning(disable : 4305)
+#  pragma warning(disable : 4309)
+#endif
+
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_COMPARE
+#define BOOST_SAFE_NUMBERS_DETAIL_INT128_ALLOW_SIGN_CONVERSION
+
+#include <boost/random/uniform_int_distribution.hpp>
+
+#ifdef __clang__
+#  pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_arithmetic.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+using wide_pattern = boost::int128::uint128_t;
+
+inline std::mt19937_64 rng{42};
+
+// Not a multiple of the 64-bit bitmap word so that the partial last word is exercised
+inline constexpr std::size_t N {1027};
+
+// Values of every bit width, so that a shift by the same amount overflows for some and not for others
+template <typename T>
+auto make_operands() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    boost::random::uniform_int_distribution<wide_pattern> dist {std::numeric_limits<wide_pattern>::min(),
+                                                                std::numeric_limits<wide_pattern>::max()};
+    boost::random::uniform_int_distribution<int> width_dist {0, 127};
+
+    std::vector<T> values;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.emplace_back(static_cast<basis_type>(dist(rng) >> width_dist(rng)));
+    }
+
+    return values;
+}
+
+// Shift amounts up to a few past the type width, with the occasional amount far beyond it
+template <typename T>
+auto make_shifts() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+    constexpr auto digits {static_cast<std::uint64_t>(std::numeric_limits<basis_type>::digits)};
+
+    boost::random::uniform_int_distribution<std::uint64_t> near_dist {0U, digits + 3U};
+    boost::random::uniform_int_distribution<std::uint64_t> far_dist {0U, std::numeric_limits<std::uint64_t>::max()};
+    boost::random::uniform_int_distribution<int> pick_dist {0, 15};
+
+    std::vector<T> shifts;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto value {pick_dist(rng) == 0 ? far_dist(rng) : near_dist(rng)};
+        shifts.emplace_back(static_cast<basis_type>(value));
+    }
+
+    return shifts;
+}
+
+auto bit_is_set(const std::vector<std::uint64_t>& bitmap, const std::size_t i) -> bool
+{
+    return ((bitmap[i / 64U] >> (i % 64U)) & 1U) == 1U;
+}
+
+// =============================================================================
+// Per-element shift amounts against the scalar functions
+// =============================================================================
+
+template <typename T>
+void test_per_element_shifts()
+{
+    const auto lhs {make_operands<T>()};
+    const auto rhs {make_shifts<T>()};
+    std::vector<T> result(N);
+    std::vector<std::uint64_t> bitmap(overflow_bitmap_size(N));
+
+    // Saturating
+
+    saturating_shl(std::span{lhs}, std::span{rhs}, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == saturating_shl(lhs[i], rhs[i]));
+    }
+
+    saturating_shr(std::span{lhs}, std::span{rhs}, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == saturating_shr(lhs[i], rhs[i]));
+    }
+
+    // Overflowing, which also gives the reference for the other policies
+
+    std::size_t first_shl_overflow {N};
+    BOOST_TEST(overflowing_shl(std::span{lhs}, std::span{rhs}, std::span{result}, std::span{bitmap}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto [wrapped, overflowed] {overflowing_shl(lhs[i], rhs[i])};
+        BOOST_TEST(result[i] == wrapped);
+        BOOST_TEST_EQ(bit_is_set(bitmap, i), overflowed);
+
+        if (overflowed && first_shl_overflow == N)
+        {
+            first_shl_overflow = i;
+        }
+    }
+
+    std::size_t first_shr_overflow {N};
+    BOOST_TEST(overflowing_shr(std::span{lhs}, std::span{rhs}, std::span{result}, std::span{bitmap}));
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto [wrapped, overflowed] {overflowing_shr(lhs[i], rhs[i])};
+        BOOST_TEST(result[i] == wrapped);
+        BOOST_TEST_EQ(bit_is_set(bitmap, i), overflowed);
+
+        if (overflowed && first_shr_overflow == N)
+        {
+            first_shr_overflow = i;
+        }
+    }
+
+    // Throwing names the first offending index
+
+    try
+    {
+        shl<overflow_policy::throw_exception>(std::span{lhs}, std::span{rhs}, std::span{result});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        const auto expected {std::string{detail::left_shift_overflow_msg<detail::underlying_type_t<T>>()} + " at index " + std::to_string(first_shl_overflow) + " (lhs = "};
+        BOOST_TEST(std::string{e.what()}.starts_with(expected));
+    }
+
+    try
+    {
+        shr<overflow_policy::throw_exception>(std::span{lhs}, std::span{rhs}, std::span{result});
+        BOOST_TEST(false);
+    }
+    catch (const std::overflow_error& e)
+    {
+        const auto expected {std::string{detail::right_shift_overflow_msg<detail::underlying_type_t<T>>()} + " at index " + std::to_string(first_shr_overflow) + " (lhs = "};
+        BOOST_TEST(std::string{e.what()}.starts_with(expected));
+    }
+
+    BOOST_TEST(!shl<overflow_policy::checked>(std::span{lhs}, std::span{rhs}, std::span{result}));
+    BOOST_TEST(!shr<overflow_policy::checked>(std::span{lhs}, std::span{rhs}, std::span{result}));
+
+    // Keeping the low half of the bits and shifting by less than half the width never overflows
+
+    const T half {static_cast<detail::underlying_type_t<T>>(std::numeric_limits<T>::digits / 2)};
+    std::vector<T> small_lhs;
+    std::vector<T> small_rhs;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        small_lhs.push_back(lhs[i] >> half);
+        small_rhs.push_back(rhs[i] % half);
+    }
+
+    shl<overflow_policy::throw_exception>(std::span{small_lhs}, std::span{small_rhs}, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == (small_lhs[i] << small_rhs[i]));
+    }
+
+    std::ranges::fill(result, T{0U});
+    shl<overflow_policy::strict>(std::span{small_lhs}, std::span{small_rhs}, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == (small_lhs[i] << small_rhs[i]));
+    }
+
+    BOOST_TEST(shl<overflow_policy::checked>(std::span{small_lhs}, std::span{small_rhs}, std::span{result}));
+    BOOST_TEST(!overflowing_shl(std::span{small_lhs}, std::span{small_rhs}, std::span{result}, std::span{bitmap}));
+
+    shr<overflow_policy::throw_exception>(std::span{small_lhs}, std::span{small_rhs}, std::span{result});
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST(result[i] == (small_lhs[i] >> small_rhs[i]));
+    }
+
+    // Mismatched sizes
+
+    std::vector<T> too_short(N - 1U);
+    BOOST_TEST_THROWS(shl<overflow_policy::throw_exception>(std::span{lhs}, std::span{too_short}, std::span{result}), std::domain_error);
+    BOOST_TEST_THROWS(saturating_shr(std::span{lhs}, std::span{rhs}, std::span{too_short}), std::domain_error);
+    BOOST_TEST(!shr<overflow_policy::checked>(std::span{too_short}, std::span{rhs}, std::span{result}));
+    BOOST_TEST_THROWS(overflowing_shl(std::span{lhs}, std::span{rhs}, std::span{result}, std::span{bitmap}.first(1U)), std::domain_error);
+}
+
+// =============================================================================
+// Uniform shift amounts against the scalar functions
+// =============================================================================
+
+template <typename T>
+void test_uniform_shifts()
+{
+    const auto lhs {make_operands<T>()};
+    std::vector<T> result(N);
+    std::vector<std::uint64_t> bitmap(overflow_bitmap_size(N));
+
+    for (int amount {}; amount <= std::numeric_limits<T>::digits + 1; ++amount)
+    {
+        const T rhs {static_cast<detail::underlying_type_t<T>>(amount)};
+
+        saturating_shl(std::span{lhs}, rhs, std::span{result});
+        for (std::size_t i {}; i < N; ++i)
+        {
+            BOOST_TEST(result[i] == saturating_shl(lhs[i], rhs));
+        }
+
+        saturating_shr(std::span{lhs}, rhs, std::span{result});
+        for (std::size_t i {}; i < N; ++i)
+        {
+            BOOST_TEST(result[i] == saturating_shr(lhs[i], rhs));
+        }
+
+        bool any_shl_overflow {};
+        const auto shl_overflowed {overflowing_shl(std::span{lhs}, rhs, std::span{result}, std::span{bitmap})};
+        for (std::size_t i {}; i < N; ++i)
+        {
+            const auto [wrapped, overflowed] {overflowing_shl(lhs[i], rhs)};
+            BOOST_TEST(result[i] == wrapped);
+            BOOST_TEST_EQ(bit_is_set(bitmap, i), overflowed);
+            any_shl_overflow = any_shl_overflow || overflowed;
+        }
+        BOOST_TEST_EQ(shl_overflowed, any_shl_overflow);
+        BOOST_TEST_EQ(shl<overflow_policy::checked>(std::span{lhs}, rhs, std::span{result}), !any_shl_overflow);
+
+        const auto shr_overflowed {overflowing_shr(std::span{lhs}, rhs, std::span{result}, std::span{bitmap})};
+        for (std::size_t i {}; i < N; ++i)
+        {
+            BOOST_TEST(result[i] == overflowing_shr(lhs[i], rhs).first);
+        }
+        BOOST_TEST_EQ(shr_overflowed, amount >= std::numeric_limits<T>::digits);
+
+        if (amount >= std::numeric_limits<T>::digits)
+        {
+            BOOST_TEST_THROWS(shr<overflow_policy::throw_exception>(std::span{lhs}, rhs, std::span{result}), std::overflow_error);
+        }
+        else
+        {
+            shr<overflow_policy::throw_exception>(std::span{lhs}, rhs, std::span{result});
+            for (std::size_t i {}; i < N; ++i)
+            {
+                BOOST_TEST(result[i] == (lhs[i] >> rhs));
+            }
+        }
+    }
+
+    // In place, where the offending index can no longer be found
+    auto values {lhs};
+    BOOST_TEST_THROWS(shl<overflow_policy::throw_exception>(std::span{values}, std::numeric_limits<T>::max(), std::span{values}), std::overflow_error);
+}
+
+// =============================================================================
+// Bit-packing: shifting fields into place
+// =============================================================================
+
+void test_bit_packing()
+{
+    const std::array<u32, 4> fields {u32{0x3U}, u32{0x1FU}, u32{0x1U}, u32{0x7FFU}};
+    const std::array<u32, 4> offsets {u32{0U}, u32{2U}, u32{7U}, u32{8U}};
+    std::array<u32, 4> placed {};
+
+    shl<overflow_policy::throw_exception>(std::span{fields}, std::span{offsets}, std::span{placed});
+    BOOST_TEST(placed[0] == u32{0x3U});
+    BOOST_TEST(placed[1] == u32{0x7CU});
+    BOOST_TEST(placed[2] == u32{0x80U});
+    BOOST_TEST(placed[3] == u32{0x7FF00U});
+
+    // A field that does not fit in the word
+    const std::array<u32, 4> too_far {u32{0U}, u32{2U}, u32{31U}, u32{8U}};
+    BOOST_TEST_THROWS(shl<overflow_policy::throw_exception>(std::span{fields}, std::span{too_far}, std::span{placed}), std::overflow_error);
+}
+
+consteval auto constexpr_shifts() -> bool
+{
+    constexpr std::array<u16, 3> lhs {u16{1U}, u16{0x007FU}, u16{0x0100U}};
+    std::array<u16, 3> result {};
+
+    saturating_shl(std::span{lhs}, u16{8U}, std::span{result});
+    return result[0] == u16{0x0100U} && result[1] == u16{0x7F00U} && result[2] == std::numeric_limits<u16>::max();
+}
+
+static_assert(constexpr_shifts());
+
+int main()
+{
+    test_per_element_shifts<u8>();
+    test_per_element_shifts<u16>();
+    test_per_element_shifts<u32>();
+    test_per_element_shifts<u64>();
+    test_per_element_shifts<u128>();
+
+    test_uniform_shifts<u8>();
+    test_uniform_shifts<u16>();
+    test_uniform_shifts<u32>();
+    test_uniform_shifts<u64>();
+    test_uniform_shifts<u128>();
+
+    test_bit_packing();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers/span_reductions.hpp>
+#include <boost/safe_numbers/unsigned_integers.hpp>
+#include <boost/safe_numbers/signed_integers.hpp>
+#include <boost/safe_numbers/bounded_integers.hpp>
+#include <boost/safe_numbers/limits.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+inline constexpr std::size_t N {1027};
+
+// =============================================================================
+// Sums that fit match a loop of the checked operator
+// =============================================================================
+
+template <typename T>
+void test_no_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    // Small enough in total to fit in 8 bits
+    std::vector<T> values;
+    for (std::size_t i {}; i < N; ++i)
+    {
+        values.emplace_back(static_cast<basis_type>(i % 64U == 0U ? (i / 64U) % 5U : 0U));
+    }
+
+    T expected {0};
+    for (const auto value : values)
+    {
+        expected += value;
+    }
+
+    BOOST_TEST(sum<overflow_policy::throw_exception>(std::span{values}) == expected);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{values}) == expected);
+    BOOST_TEST(sum<overflow_policy::strict>(std::span{values}) == expected);
+    BOOST_TEST(*sum<overflow_policy::checked>(std::span{values}) == expected);
+
+    const auto [wrapped, overflowed] {sum<overflow_policy::overflow_tuple>(std::span{values})};
+    BOOST_TEST(wrapped == expected);
+    BOOST_TEST(!overflowed);
+
+    BOOST_TEST(sum<overflow_policy::throw_exception>(std::span<const T>{}) == T{0});
+}
+
+// =============================================================================
+// Sums that do not fit
+// =============================================================================
+
+template <typename T>
+void test_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    std::vector<T> values(N, std::numeric_limits<T>::max());
+
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{values})), std::overflow_error);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{values}) == std::numeric_limits<T>::max());
+    BOOST_TEST(!sum<overflow_policy::checked>(std::span{values}).has_value());
+
+    // N copies of max wrap to N * max mod 2^digits, which is -N in the lane type
+    const auto [wrapped, overflowed] {sum<overflow_policy::overflow_tuple>(std::span{values})};
+    BOOST_TEST(overflowed);
+    BOOST_TEST(wrapped == T{static_cast<basis_type>(basis_type{0} - static_cast<basis_type>(N))});
+
+    // Two elements are enough
+    const std::array<T, 2> pair {std::numeric_limits<T>::max(), T{1}};
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{pair})), std::overflow_error);
+}
+
+template <typename T>
+void test_signed_overflow()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    std::vector<T> values(N, std::numeric_limits<T>::min());
+
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{values})), std::underflow_error);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{values}) == std::numeric_limits<T>::min());
+    BOOST_TEST(!sum<overflow_policy::checked>(std::span{values}).has_value());
+
+    std::fill(values.begin(), values.end(), std::numeric_limits<T>::max());
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{values})), std::overflow_error);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{values}) == std::numeric_limits<T>::max());
+
+    // Partial sums leave the range but the exact sum does not, so no error is reported
+    // 101 copies of max and 100 of min sum to max - 100
+    std::vector<T> alternating(201U);
+    for (std::size_t i {}; i < alternating.size(); ++i)
+    {
+        alternating[i] = i % 2U == 0U ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+    }
+    BOOST_TEST(sum<overflow_policy::throw_exception>(std::span{alternating}) == std::numeric_limits<T>::max() - T{static_cast<basis_type>(100)});
+
+    const std::array<T, 3> cancel {std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::min()};
+    BOOST_TEST(*sum<overflow_policy::checked>(std::span{cancel}) == std::numeric_limits<T>::max() + std::numeric_limits<T>::min() + std::numeric_limits<T>::max());
+}
+
+// =============================================================================
+// Bounded types report sums outside the bounds as domain errors
+// =============================================================================
+
+void test_bounded()
+{
+    using percent = bounded_uint<0u, 100u>;
+    const std::array<percent, 3> parts {percent{20u}, percent{30u}, percent{50u}};
+    BOOST_TEST(sum<overflow_policy::throw_exception>(std::span{parts}) == percent{100u});
+
+    const std::array<percent, 3> too_much {percent{20u}, percent{30u}, percent{51u}};
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{too_much})), std::domain_error);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{too_much}) == percent{100u});
+    BOOST_TEST(!sum<overflow_policy::checked>(std::span{too_much}).has_value());
+
+    // Overflow of the u8 basis is still an overflow
+    using byte_range = bounded_uint<10u, 255u>;
+    const std::array<byte_range, 2> bytes {byte_range{200u}, byte_range{100u}};
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{bytes})), std::overflow_error);
+
+    // An empty sum of a type that excludes zero is below the bounds
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span<const byte_range>{}) == byte_range{10u});
+
+    using delta = bounded_int<-10, 10>;
+    const std::array<delta, 4> deltas {delta{-10}, delta{-5}, delta{8}, delta{2}};
+    BOOST_TEST(sum<overflow_policy::throw_exception>(std::span{deltas}) == delta{-5});
+
+    const std::array<delta, 2> low {delta{-10}, delta{-1}};
+    BOOST_TEST_THROWS(static_cast<void>(sum<overflow_policy::throw_exception>(std::span{low})), std::domain_error);
+    BOOST_TEST(sum<overflow_policy::saturate>(std::span{low}) == delta{-10});
+}
+
+// =============================================================================
+// Constant evaluation
+// =============================================================================
+
+constexpr auto constexpr_sum() -> bool
+{
+    const std::array<i64, 3> values {i64{-1}, std::numeric_limits<i64>::max(), i64{1}};
+    return sum<overflow_policy::throw_exception>(std::span{values}) == std::numeric_limits<i64>::max();
+}
+
+static_assert(constexpr_sum());
+
+int main()
+{
+    test_no_overflow<u8>();
+    test_no_overflow<u16>();
+    test_no_overflow<u32>();
+    test_no_overflow<u64>();
+    test_no_overflow<u128>();
+    test_no_overflow<i8>();
+    test_no_overflow<i16>();
+    test_no_overflow<i32>();
+    test_no_overflow<i64>();
+    test_no_overflow<i128>();
+
+    test_overflow<u8>();
+    test_overflow<u16>();
+    test_overflow<u32>();
+    test_overflow<u64>();
+    test_overflow<u128>();
+
+    test_signed_overflow<i8>();
+    test_signed_overflow<i16>();
+    test_signed_overflow<i32>();
+    test_signed_overflow<i64>();
+    test_signed_overflow<i128>();
+
+    test_bounded();
+
+    return boost::report_errors();
+}
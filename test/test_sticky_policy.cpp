@@ -0,0 +1,266 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+// -----------------------------------------------
+// Scalar functions wrap and record as the overflowing functions do
+// -----------------------------------------------
+
+template <typename T>
+void test_scalar()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    constexpr T max {std::numeric_limits<basis_type>::max()};
+    constexpr T min {std::numeric_limits<basis_type>::min()};
+    constexpr T one {static_cast<basis_type>(1)};
+    constexpr T two {static_cast<basis_type>(2)};
+    constexpr T three {static_cast<basis_type>(3)};
+
+    error_context context {};
+    BOOST_TEST(!context.overflowed());
+
+    BOOST_TEST(sticky_add(two, three, context) == T{static_cast<basis_type>(5)});
+    BOOST_TEST(sticky_sub(three, two, context) == one);
+    BOOST_TEST(sticky_mul(two, three, context) == T{static_cast<basis_type>(6)});
+    BOOST_TEST(sticky_div(three, two, context) == one);
+    BOOST_TEST(sticky_mod(three, two, context) == one);
+    BOOST_TEST(!context.overflowed());
+
+    BOOST_TEST(sticky_add(max, two, context) == overflowing_add(max, two).first);
+    BOOST_TEST(context.overflowed());
+
+    // Later operations that do not overflow leave the flag set
+    BOOST_TEST(sticky_add(one, one, context) == two);
+    BOOST_TEST(context.overflowed());
+
+    context.reset();
+    BOOST_TEST(sticky_sub(min, one, context) == overflowing_sub(min, one).first);
+    BOOST_TEST(context.overflowed());
+
+    context.reset();
+    BOOST_TEST(sticky_mul(max, two, context) == overflowing_mul(max, two).first);
+    BOOST_TEST(context.overflowed());
+
+    context.reset();
+    BOOST_TEST_THROWS(static_cast<void>(sticky_div(one, T{}, context)), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(sticky_mod(one, T{}, context)), std::domain_error);
+    BOOST_TEST(!context.overflowed());
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        const T minus_one {static_cast<basis_type>(-1)};
+        BOOST_TEST(sticky_div(min, minus_one, context) == overflowing_div(min, minus_one).first);
+        BOOST_TEST(context.overflowed());
+    }
+
+    // The overloads without a context use the one of the calling thread
+    thread_error_context().reset();
+    BOOST_TEST(sticky_add(one, two) == three);
+    BOOST_TEST(!thread_error_context().overflowed());
+    BOOST_TEST(sticky_add(max, one) == overflowing_add(max, one).first);
+    BOOST_TEST(thread_error_context().overflowed());
+
+    // As does the generic interface
+    thread_error_context().reset();
+    BOOST_TEST(add<overflow_policy::sticky>(one, two) == three);
+    BOOST_TEST(sub<overflow_policy::sticky>(three, two) == one);
+    BOOST_TEST(mul<overflow_policy::sticky>(one, two) == two);
+    BOOST_TEST(div<overflow_policy::sticky>(three, one) == three);
+    BOOST_TEST(mod<overflow_policy::sticky>(three, two) == one);
+    BOOST_TEST(!thread_error_context().overflowed());
+    BOOST_TEST(mul<overflow_policy::sticky>(max, max) == overflowing_mul(max, max).first);
+    BOOST_TEST(thread_error_context().overflowed());
+    thread_error_context().reset();
+}
+
+void test_shifts()
+{
+    error_context context {};
+
+    BOOST_TEST(sticky_shl(u32{1U}, u32{4U}, context) == u32{16U});
+    BOOST_TEST(sticky_shr(u32{16U}, u32{4U}, context) == u32{1U});
+    BOOST_TEST(!context.overflowed());
+
+    BOOST_TEST(sticky_shl(u32{0x8000'0000U}, u32{1U}, context) == overflowing_shl(u32{0x8000'0000U}, u32{1U}).first);
+    BOOST_TEST(context.overflowed());
+
+    context.reset();
+    BOOST_TEST(sticky_shr(u8{1U}, u8{8U}, context) == overflowing_shr(u8{1U}, u8{8U}).first);
+    BOOST_TEST(context.overflowed());
+
+    thread_error_context().reset();
+    BOOST_TEST(shl<overflow_policy::sticky>(u16{1U}, u16{15U}) == overflowing_shl(u16{1U}, u16{15U}).first);
+    BOOST_TEST(thread_error_context().overflowed());
+    thread_error_context().reset();
+}
+
+// -----------------------------------------------
+// Merging a local context into another
+// -----------------------------------------------
+
+void test_merge()
+{
+    error_context total {};
+    error_context local {};
+
+    total.merge(local);
+    BOOST_TEST(!total.overflowed());
+
+    static_cast<void>(sticky_add(u8{255U}, u8{1U}, local));
+    total.merge(local);
+    BOOST_TEST(total.overflowed());
+
+    local.reset();
+    total.merge(local);
+    BOOST_TEST(total.overflowed());
+}
+
+// -----------------------------------------------
+// Every thread has its own context
+// -----------------------------------------------
+
+void test_threads()
+{
+    thread_error_context().reset();
+
+    bool other_thread_overflowed {};
+    std::thread worker {[&other_thread_overflowed]
+    {
+        static_cast<void>(sticky_add(u64{UINT64_MAX}, u64{1U}));
+        other_thread_overflowed = thread_error_context().overflowed();
+    }};
+    worker.join();
+
+    BOOST_TEST(other_thread_overflowed);
+    BOOST_TEST(!thread_error_context().overflowed());
+}
+
+// -----------------------------------------------
+// Spans wrap every element and record once
+// -----------------------------------------------
+
+template <typename T>
+void test_span()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    const std::vector<T> lhs {T{static_cast<basis_type>(1)}, T{std::numeric_limits<basis_type>::max()}, T{static_cast<basis_type>(7)}};
+    const std::vector<T> rhs {T{static_cast<basis_type>(2)}, T{static_cast<basis_type>(1)}, T{static_cast<basis_type>(3)}};
+    std::vector<T> result(lhs.size());
+
+    thread_error_context().reset();
+    add<overflow_policy::sticky>(std::span{lhs}.first(1U), std::span{rhs}.first(1U), std::span{result}.first(1U));
+    BOOST_TEST(!thread_error_context().overflowed());
+
+    add<overflow_policy::sticky>(lhs, rhs, std::span{result});
+    BOOST_TEST(thread_error_context().overflowed());
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(result[i] == overflowing_add(lhs[i], rhs[i]).first);
+    }
+
+    // Only the unsigned differences underflow
+    thread_error_context().reset();
+    sub<overflow_policy::sticky>(rhs, lhs, std::span{result});
+    BOOST_TEST(thread_error_context().overflowed() == !std::numeric_limits<basis_type>::is_signed);
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(result[i] == overflowing_sub(rhs[i], lhs[i]).first);
+    }
+
+    thread_error_context().reset();
+    mul<overflow_policy::sticky>(lhs, rhs, std::span{result});
+    BOOST_TEST(!thread_error_context().overflowed());
+
+    std::vector<T> too_short(lhs.size() - 1U);
+    BOOST_TEST_THROWS(add<overflow_policy::sticky>(lhs, rhs, std::span{too_short}), std::domain_error);
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        const std::vector<T> dividends {T{std::numeric_limits<basis_type>::min()}, T{static_cast<basis_type>(4)}};
+        std::vector<T> quotients(dividends.size());
+
+        thread_error_context().reset();
+        div<overflow_policy::sticky>(dividends, divider<T>{T{static_cast<basis_type>(-1)}}, std::span{quotients});
+        BOOST_TEST(thread_error_context().overflowed());
+        BOOST_TEST(quotients[1] == T{static_cast<basis_type>(-4)});
+    }
+    else
+    {
+        std::vector<T> shifted(lhs.size());
+
+        thread_error_context().reset();
+        shl<overflow_policy::sticky>(lhs, T{static_cast<basis_type>(1)}, std::span{shifted});
+        BOOST_TEST(thread_error_context().overflowed());
+        BOOST_TEST(shifted[2] == T{static_cast<basis_type>(14)});
+    }
+
+    thread_error_context().reset();
+}
+
+// -----------------------------------------------
+// constexpr with an explicit context
+// -----------------------------------------------
+
+consteval auto constexpr_sticky() -> bool
+{
+    error_context context {};
+
+    auto total {u8{0U}};
+    for (unsigned i {}; i < 10U; ++i)
+    {
+        total = sticky_add(total, u8{30U}, context);
+    }
+
+    return context.overflowed() && total == u8{44U};
+}
+
+static_assert(constexpr_sticky());
+
+int main()
+{
+    test_scalar<u8>();
+    test_scalar<u16>();
+    test_scalar<u32>();
+    test_scalar<u64>();
+    test_scalar<u128>();
+    test_scalar<i8>();
+    test_scalar<i16>();
+    test_scalar<i32>();
+    test_scalar<i64>();
+    test_scalar<i128>();
+
+    test_shifts();
+    test_merge();
+    test_threads();
+
+    test_span<u8>();
+    test_span<u32>();
+    test_span<u64>();
+    test_span<i16>();
+    test_span<i32>();
+
+    return boost::report_errors();
+}
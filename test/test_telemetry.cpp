@@ -0,0 +1,245 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_SAFE_NUMBERS_ENABLE_TELEMETRY
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/safe_numbers.hpp>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace boost::safe_numbers;
+
+auto find_counter(const telemetry_snapshot& snapshot, const std::uint_least32_t line, const telemetry_event event) -> const telemetry_counter*
+{
+    for (const auto& counter : snapshot.counters)
+    {
+        if (counter.line == line && counter.event == event && std::strstr(counter.file, "test_telemetry") != nullptr)
+        {
+            return &counter;
+        }
+    }
+
+    return nullptr;
+}
+
+auto count_at(const std::uint_least32_t line, const telemetry_event event) -> std::uint64_t
+{
+    const auto snapshot {take_telemetry_snapshot()};
+    const auto* counter {find_counter(snapshot, line, event)};
+    return counter != nullptr ? counter->count : 0U;
+}
+
+// -----------------------------------------------
+// Each call site counts only the calls that did not succeed
+// -----------------------------------------------
+
+void test_scalar_sites()
+{
+    std::uint_least32_t saturating_line {};
+    std::uint_least32_t checked_line {};
+    std::uint_least32_t overflowing_line {};
+
+    for (std::uint32_t i {}; i < 10U; ++i)
+    {
+        // Saturates for the last 4 values of i
+        saturating_line = __LINE__ + 1U;
+        static_cast<void>(saturating_add(u8{250U}, u8{static_cast<std::uint8_t>(i)}));
+
+        checked_line = __LINE__ + 1U;
+        static_cast<void>(checked_sub(i32{INT32_MIN + 5}, i32{static_cast<std::int32_t>(i)}));
+
+        overflowing_line = __LINE__ + 1U;
+        static_cast<void>(overflowing_mul(u32{UINT32_MAX / 2U}, u32{i}));
+    }
+
+    BOOST_TEST_EQ(count_at(saturating_line, telemetry_event::saturated), 4U);
+    BOOST_TEST_EQ(count_at(checked_line, telemetry_event::check_failed), 4U);
+    BOOST_TEST_EQ(count_at(overflowing_line, telemetry_event::overflowed), 7U);
+
+    const auto snapshot {take_telemetry_snapshot()};
+    const auto* counter {find_counter(snapshot, saturating_line, telemetry_event::saturated)};
+    BOOST_TEST(counter != nullptr);
+    if (counter != nullptr)
+    {
+        BOOST_TEST(counter->op == arithmetic_op::add);
+        BOOST_TEST_CSTR_EQ(counter->type, "u8");
+        BOOST_TEST(std::strstr(counter->function, "test_scalar_sites") != nullptr);
+    }
+
+    // The generic functions count where they were called too
+    const auto generic_line {__LINE__ + 1U};
+    static_cast<void>(sub<overflow_policy::saturate>(u16{0U}, u16{1U}));
+    BOOST_TEST_EQ(count_at(generic_line, telemetry_event::saturated), 1U);
+}
+
+// -----------------------------------------------
+// Conversions
+// -----------------------------------------------
+
+void test_conversions()
+{
+    const auto saturate_line {__LINE__ + 1U};
+    BOOST_TEST(saturate_cast<u8>(u32{300U}) == u8{255U});
+    const auto in_range_line {__LINE__ + 1U};
+    BOOST_TEST(saturate_cast<u8>(u32{200U}) == u8{200U});
+    const auto checked_line {__LINE__ + 1U};
+    BOOST_TEST(!checked_cast<u16>(i32{-1}).has_value());
+
+    BOOST_TEST_EQ(count_at(saturate_line, telemetry_event::saturated), 1U);
+    BOOST_TEST_EQ(count_at(in_range_line, telemetry_event::saturated), 0U);
+    BOOST_TEST_EQ(count_at(checked_line, telemetry_event::check_failed), 1U);
+
+    const auto snapshot {take_telemetry_snapshot()};
+    const auto* counter {find_counter(snapshot, checked_line, telemetry_event::check_failed)};
+    BOOST_TEST(counter != nullptr);
+    if (counter != nullptr)
+    {
+        BOOST_TEST(counter->op == arithmetic_op::conversion);
+        BOOST_TEST_CSTR_EQ(counter->type, "i32");
+    }
+}
+
+// -----------------------------------------------
+// Errors are counted where the library detected them, including bounded range errors
+// -----------------------------------------------
+
+auto count_errors(const arithmetic_op op) -> std::uint64_t
+{
+    std::uint64_t count {};
+    for (const auto& counter : take_telemetry_snapshot().counters)
+    {
+        if (counter.event == telemetry_event::error && counter.op == op)
+        {
+            count += counter.count;
+        }
+    }
+
+    return count;
+}
+
+void test_errors()
+{
+    const auto add_errors {count_errors(arithmetic_op::add)};
+    const auto conversion_errors {count_errors(arithmetic_op::conversion)};
+
+    BOOST_TEST_THROWS(static_cast<void>(u32{UINT32_MAX} + u32{1U}), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(u32{UINT32_MAX} + u32{2U}), std::overflow_error);
+    BOOST_TEST_THROWS(static_cast<void>(bounded_uint<0U, 100U>{101U}), std::domain_error);
+
+    BOOST_TEST_EQ(count_errors(arithmetic_op::add), add_errors + 2U);
+    BOOST_TEST_EQ(count_errors(arithmetic_op::conversion), conversion_errors + 1U);
+}
+
+// -----------------------------------------------
+// The counts of every thread are merged, including those that have exited
+// -----------------------------------------------
+
+void saturate_in_thread()
+{
+    static_cast<void>(saturating_add(u64{UINT64_MAX}, u64{1U}));
+}
+
+void test_threads()
+{
+    const auto site_count {[]
+    {
+        std::uint64_t count {};
+        for (const auto& counter : take_telemetry_snapshot().counters)
+        {
+            if (counter.type != nullptr && std::strcmp(counter.type, "u64") == 0 && counter.event == telemetry_event::saturated)
+            {
+                count += counter.count;
+            }
+        }
+        return count;
+    }};
+
+    constexpr int thread_count {4};
+    constexpr int calls_per_thread {1000};
+
+    const auto before {site_count()};
+
+    std::vector<std::thread> threads;
+    for (int t {}; t < thread_count; ++t)
+    {
+        threads.emplace_back([]
+        {
+            for (int i {}; i < calls_per_thread; ++i)
+            {
+                saturate_in_thread();
+            }
+        });
+    }
+
+    // Snapshots may be taken while the threads count
+    static_cast<void>(take_telemetry_snapshot());
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST_EQ(site_count(), before + static_cast<std::uint64_t>(thread_count * calls_per_thread));
+
+    // One site, however many threads counted it
+    std::size_t sites {};
+    for (const auto& counter : take_telemetry_snapshot().counters)
+    {
+        if (counter.type != nullptr && std::strcmp(counter.type, "u64") == 0 && counter.event == telemetry_event::saturated)
+        {
+            ++sites;
+        }
+    }
+    BOOST_TEST_EQ(sites, 1U);
+}
+
+// -----------------------------------------------
+// Text and JSON
+// -----------------------------------------------
+
+void test_output()
+{
+    telemetry_snapshot snapshot {};
+    snapshot.counters.push_back(telemetry_counter{"dir\\main.cpp", "int \"main\"()", 12U, 5U,
+                                                  telemetry_event::saturated, arithmetic_op::add, "u32", 1024U});
+    snapshot.counters.push_back(telemetry_counter{"main.cpp", "f()", 3U, 1U,
+                                                  telemetry_event::error, arithmetic_op::none, nullptr, 1U});
+    snapshot.unrecorded = 2U;
+
+    BOOST_TEST_EQ(to_text(snapshot), std::string {"1024 saturated add u32 at dir\\main.cpp:12:5 in int \"main\"()\n"
+                                                  "1 error none at main.cpp:3:1 in f()\n"
+                                                  "2 unrecorded\n"});
+
+    BOOST_TEST_EQ(to_json(snapshot), std::string {"{\"counters\":["
+        "{\"file\":\"dir\\\\main.cpp\",\"function\":\"int \\\"main\\\"()\",\"line\":12,\"column\":5,"
+        "\"event\":\"saturated\",\"op\":\"add\",\"type\":\"u32\",\"count\":1024},"
+        "{\"file\":\"main.cpp\",\"function\":\"f()\",\"line\":3,\"column\":1,"
+        "\"event\":\"error\",\"op\":\"none\",\"type\":null,\"count\":1}"
+        "],\"unrecorded\":2}"});
+
+    BOOST_TEST_EQ(to_json(telemetry_snapshot {}), std::string {"{\"counters\":[],\"unrecorded\":0}"});
+
+    // The counters of a snapshot are sorted by count
+    const auto taken {take_telemetry_snapshot()};
+    for (std::size_t i {1U}; i < taken.counters.size(); ++i)
+    {
+        BOOST_TEST(taken.counters[i - 1U].count >= taken.counters[i].count);
+    }
+}
+
+int main()
+{
+    test_scalar_sites();
+    test_conversions();
+    test_errors();
+    test_threads();
+    test_output();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,266 @@
+// Copyright 2026 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/lightweight_test.hpp>
+
+#ifdef BOOST_SAFE_NUMBERS_BUILD_MODULE
+
+import boost.safe_numbers;
+
+#else
+
+#include <boost/safe_numbers.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#endif
+
+using namespace boost::safe_numbers;
+
+// Every boundary of the type, and values either side of zero and of the half way points
+template <typename T>
+auto make_values() -> std::vector<T>
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    constexpr auto min {std::numeric_limits<basis_type>::min()};
+    constexpr auto max {std::numeric_limits<basis_type>::max()};
+    constexpr auto half {static_cast<basis_type>(max / 2)};
+
+    std::vector<T> values;
+    for (const auto base : {min, half, max, basis_type{0}, static_cast<basis_type>(min / 2)})
+    {
+        for (int offset {-3}; offset <= 3; ++offset)
+        {
+            // Computed in the lane type so that the neighbours of min and max wrap instead of overflowing
+            using lane_type = detail::impl::span_lane_t<basis_type>;
+            const auto value {static_cast<lane_type>(static_cast<lane_type>(base) + static_cast<lane_type>(offset))};
+            values.emplace_back(static_cast<basis_type>(value));
+        }
+    }
+
+    return values;
+}
+
+// -----------------------------------------------
+// The wrapping functions return the value of the overflowing functions
+// -----------------------------------------------
+
+template <typename T>
+void test_scalar()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    const auto values {make_values<T>()};
+
+    for (const auto lhs : values)
+    {
+        for (const auto rhs : values)
+        {
+            BOOST_TEST(wrapping_add(lhs, rhs) == overflowing_add(lhs, rhs).first);
+            BOOST_TEST(wrapping_sub(lhs, rhs) == overflowing_sub(lhs, rhs).first);
+            BOOST_TEST(wrapping_mul(lhs, rhs) == overflowing_mul(lhs, rhs).first);
+
+            BOOST_TEST(add<overflow_policy::wrap>(lhs, rhs) == overflowing_add(lhs, rhs).first);
+            BOOST_TEST(sub<overflow_policy::wrap>(lhs, rhs) == overflowing_sub(lhs, rhs).first);
+            BOOST_TEST(mul<overflow_policy::wrap>(lhs, rhs) == overflowing_mul(lhs, rhs).first);
+
+            if (rhs != T{})
+            {
+                BOOST_TEST(wrapping_div(lhs, rhs) == overflowing_div(lhs, rhs).first);
+                BOOST_TEST(wrapping_mod(lhs, rhs) == overflowing_mod(lhs, rhs).first);
+                BOOST_TEST(div<overflow_policy::wrap>(lhs, rhs) == overflowing_div(lhs, rhs).first);
+                BOOST_TEST(mod<overflow_policy::wrap>(lhs, rhs) == overflowing_mod(lhs, rhs).first);
+            }
+        }
+    }
+
+    constexpr T one {static_cast<basis_type>(1)};
+    BOOST_TEST_THROWS(static_cast<void>(wrapping_div(one, T{})), std::domain_error);
+    BOOST_TEST_THROWS(static_cast<void>(wrapping_mod(one, T{})), std::domain_error);
+
+    if constexpr (std::numeric_limits<basis_type>::is_signed)
+    {
+        constexpr T min {std::numeric_limits<basis_type>::min()};
+        const T minus_one {static_cast<basis_type>(-1)};
+        BOOST_TEST(wrapping_div(min, minus_one) == min);
+        BOOST_TEST(wrapping_mod(min, minus_one) == T{});
+    }
+}
+
+template <typename T>
+void test_shifts()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    constexpr auto digits {std::numeric_limits<basis_type>::digits};
+
+    for (const auto lhs : make_values<T>())
+    {
+        for (int amount {}; amount <= digits + 2; ++amount)
+        {
+            const T rhs {static_cast<basis_type>(amount)};
+
+            BOOST_TEST(wrapping_shl(lhs, rhs) == overflowing_shl(lhs, rhs).first);
+            BOOST_TEST(wrapping_shr(lhs, rhs) == overflowing_shr(lhs, rhs).first);
+            BOOST_TEST(shl<overflow_policy::wrap>(lhs, rhs) == overflowing_shl(lhs, rhs).first);
+            BOOST_TEST(shr<overflow_policy::wrap>(lhs, rhs) == overflowing_shr(lhs, rhs).first);
+        }
+
+        // Large amounts clear every bit rather than being reduced modulo the width
+        BOOST_TEST(wrapping_shl(lhs, T{std::numeric_limits<basis_type>::max()}) == T{});
+        BOOST_TEST(wrapping_shr(lhs, T{static_cast<basis_type>(digits + 1)}) == T{});
+    }
+}
+
+// -----------------------------------------------
+// Spans match the scalar functions
+// -----------------------------------------------
+
+template <typename T>
+void test_span()
+{
+    using basis_type = detail::underlying_type_t<T>;
+
+    const auto values {make_values<T>()};
+
+    std::vector<T> lhs;
+    std::vector<T> rhs;
+    for (const auto l : values)
+    {
+        for (const auto r : values)
+        {
+            lhs.push_back(l);
+            rhs.push_back(r);
+        }
+    }
+
+    std::vector<T> result(lhs.size());
+
+    wrapping_add(std::span<const T>{lhs}, std::span<const T>{rhs}, std::span{result});
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(result[i] == wrapping_add(lhs[i], rhs[i]));
+    }
+
+    wrapping_sub(std::span<const T>{lhs}, std::span<const T>{rhs}, std::span{result});
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(result[i] == wrapping_sub(lhs[i], rhs[i]));
+    }
+
+    wrapping_mul(std::span<const T>{lhs}, std::span<const T>{rhs}, std::span{result});
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(result[i] == wrapping_mul(lhs[i], rhs[i]));
+    }
+
+    // The generic interface, in place
+    auto in_place {lhs};
+    mul<overflow_policy::wrap>(std::span<const T>{in_place}, std::span<const T>{rhs}, std::span{in_place});
+    for (std::size_t i {}; i < lhs.size(); ++i)
+    {
+        BOOST_TEST(in_place[i] == wrapping_mul(lhs[i], rhs[i]));
+    }
+
+    if constexpr (!std::numeric_limits<basis_type>::is_signed)
+    {
+        std::vector<T> amounts(lhs.size());
+        for (std::size_t i {}; i < amounts.size(); ++i)
+        {
+            amounts[i] = T{static_cast<basis_type>(i % static_cast<std::size_t>(std::numeric_limits<basis_type>::digits + 3))};
+        }
+
+        wrapping_shl(std::span<const T>{lhs}, std::span<const T>{amounts}, std::span{result});
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            BOOST_TEST(result[i] == wrapping_shl(lhs[i], amounts[i]));
+        }
+
+        wrapping_shr(std::span<const T>{lhs}, std::span<const T>{amounts}, std::span{result});
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            BOOST_TEST(result[i] == wrapping_shr(lhs[i], amounts[i]));
+        }
+
+        const T uniform {static_cast<basis_type>(3)};
+        wrapping_shl(std::span<const T>{lhs}, uniform, std::span{result});
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            BOOST_TEST(result[i] == wrapping_shl(lhs[i], uniform));
+        }
+
+        shr<overflow_policy::wrap>(std::span<const T>{lhs}, uniform, std::span{result});
+        for (std::size_t i {}; i < lhs.size(); ++i)
+        {
+            BOOST_TEST(result[i] == wrapping_shr(lhs[i], uniform));
+        }
+    }
+    else
+    {
+        // min / -1 wraps to min
+        const std::vector<T> dividends {T{std::numeric_limits<basis_type>::min()}, T{static_cast<basis_type>(6)}};
+        std::vector<T> quotients(dividends.size());
+        div<overflow_policy::wrap>(std::span<const T>{dividends}, divider<T>{T{static_cast<basis_type>(-1)}}, std::span{quotients});
+        BOOST_TEST(quotients[0] == dividends[0]);
+        BOOST_TEST(quotients[1] == T{static_cast<basis_type>(-6)});
+    }
+
+    std::vector<T> too_short(lhs.size() - 1U);
+    BOOST_TEST_THROWS(wrapping_add(std::span<const T>{lhs}, std::span<const T>{rhs}, std::span{too_short}), std::domain_error);
+}
+
+// -----------------------------------------------
+// constexpr
+// -----------------------------------------------
+
+static_assert(wrapping_add(u8{200U}, u8{100U}) == u8{44U});
+static_assert(wrapping_sub(u16{1U}, u16{2U}) == u16{65'535U});
+static_assert(wrapping_mul(u16{65'535U}, u16{65'535U}) == u16{1U});
+static_assert(wrapping_mul(u32{0x1'0000U}, u32{0x1'0000U}) == u32{0U});
+static_assert(wrapping_shl(u8{0x81U}, u8{1U}) == u8{2U});
+static_assert(wrapping_shl(u32{1U}, u32{32U}) == u32{0U});
+static_assert(wrapping_shr(u64{UINT64_MAX}, u64{64U}) == u64{0U});
+static_assert(wrapping_add(i8{127}, i8{1}) == i8{-128});
+static_assert(wrapping_sub(i16{-32'768}, i16{1}) == i16{32'767});
+static_assert(wrapping_mul(i32{INT32_MIN}, i32{-1}) == i32{INT32_MIN});
+static_assert(wrapping_div(i64{INT64_MIN}, i64{-1}) == i64{INT64_MIN});
+static_assert(add<overflow_policy::wrap>(u32{UINT32_MAX}, u32{2U}) == u32{1U});
+
+int main()
+{
+    test_scalar<u8>();
+    test_scalar<u16>();
+    test_scalar<u32>();
+    test_scalar<u64>();
+    test_scalar<u128>();
+    test_scalar<i8>();
+    test_scalar<i16>();
+    test_scalar<i32>();
+    test_scalar<i64>();
+    test_scalar<i128>();
+
+    test_shifts<u8>();
+    test_shifts<u16>();
+    test_shifts<u32>();
+    test_shifts<u64>();
+    test_shifts<u128>();
+
+    test_span<u8>();
+    test_span<u16>();
+    test_span<u32>();
+    test_span<u64>();
+    test_span<u128>();
+    test_span<i8>();
+    test_span<i16>();
+    test_span<i32>();
+    test_span<i64>();
+    test_span<i128>();
+
+    return boost::report_errors();
+}